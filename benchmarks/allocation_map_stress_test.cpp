@@ -0,0 +1,109 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "umpire/util/AllocationMap.hpp"
+#include "umpire/util/AllocationRecord.hpp"
+#include "umpire/util/ShardedAllocationMap.hpp"
+
+constexpr std::size_t RECORDS_PER_THREAD{1 << 12}; // records each thread keeps registered at once
+constexpr std::size_t ROUNDS{64};                  // insert/find/remove rounds per thread
+constexpr std::size_t RECORD_SIZE{64};
+
+/*
+ * \brief Each thread registers a batch of records at addresses of its own,
+ *        looks each of them up once by its start address and once by an
+ *        interior address, and deregisters them again. Returns the wall time
+ *        for all threads to finish.
+ *
+ * \param map, the allocation map under test
+ * \param num_threads, number of threads using map concurrently
+ */
+template <typename Map>
+double run_threads(Map& map, std::size_t num_threads)
+{
+  std::vector<std::thread> threads;
+
+  auto begin{std::chrono::system_clock::now()};
+
+  for (std::size_t t{0}; t < num_threads; t++) {
+    threads.emplace_back([&map, t]() {
+      const std::uintptr_t base{(t + 1) * RECORDS_PER_THREAD * RECORD_SIZE * 2};
+
+      for (std::size_t round{0}; round < ROUNDS; round++) {
+        for (std::size_t i{0}; i < RECORDS_PER_THREAD; i++) {
+          void* ptr{reinterpret_cast<void*>(base + i * RECORD_SIZE)};
+          map.insert(ptr, umpire::util::AllocationRecord{ptr, RECORD_SIZE, nullptr});
+        }
+        for (std::size_t i{0}; i < RECORDS_PER_THREAD; i++) {
+          map.find(reinterpret_cast<void*>(base + i * RECORD_SIZE));
+        }
+        for (std::size_t i{0}; i < RECORDS_PER_THREAD; i++) {
+          map.find(reinterpret_cast<void*>(base + i * RECORD_SIZE + RECORD_SIZE / 2));
+        }
+        for (std::size_t i{0}; i < RECORDS_PER_THREAD; i++) {
+          map.remove(reinterpret_cast<void*>(base + i * RECORD_SIZE));
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto end{std::chrono::system_clock::now()};
+  return std::chrono::duration<double>(end - begin).count();
+}
+
+/*
+ * \brief Prints throughput (million map operations per second) and speedup
+ *        over the single threaded run for 1, 2, 4, ... max_threads.
+ */
+template <typename Map>
+void test_scaling(const std::string& name, std::size_t max_threads)
+{
+  std::cout << name << ":" << std::endl;
+
+  double base_rate{0.0};
+  for (std::size_t n{1}; n <= max_threads; n *= 2) {
+    Map map;
+    const double seconds{run_threads(map, n)};
+    const double rate{static_cast<double>(n * ROUNDS * RECORDS_PER_THREAD * 4) / seconds / 1.0e6};
+    if (n == 1)
+      base_rate = rate;
+
+    std::cout << "  threads: " << std::setw(3) << n << "  time: " << seconds << "(s)"
+              << "  rate: " << rate << "(Mops/s)"
+              << "  speedup: " << rate / base_rate << std::endl;
+  }
+
+  std::cout << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  std::cout << std::fixed << std::setprecision(3);
+
+  std::size_t max_threads{64};
+  if (argc > 1)
+    max_threads = std::strtoul(argv[1], nullptr, 10);
+  if (max_threads == 0)
+    max_threads = 1;
+
+  test_scaling<umpire::util::AllocationMap>("AllocationMap", max_threads);
+  test_scaling<umpire::util::ShardedAllocationMap>("ShardedAllocationMap", max_threads);
+
+  return 0;
+}
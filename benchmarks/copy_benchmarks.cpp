@@ -12,10 +12,57 @@
 
 #include "umpire/ResourceManager.hpp"
 #include "umpire/Allocator.hpp"
+#include "umpire/op/MemoryOperationRegistry.hpp"
+#include "umpire/strategy/NamedAllocationStrategy.hpp"
 
 constexpr int MIN = 4;
 constexpr int MAX = 4096;
 
+constexpr int64_t LARGE_MIN = int64_t{1} << 24; // 16MiB
+constexpr int64_t LARGE_MAX = int64_t{1} << 30; // 1GiB
+
+constexpr int64_t STREAMING_MIN = int64_t{1} << 12; // 4KiB
+constexpr int64_t STREAMING_MAX = int64_t{1} << 32; // 4GiB
+
+static umpire::Allocator get_host_allocator()
+{
+  return umpire::ResourceManager::getInstance().getAllocator("HOST");
+}
+
+// A HOST allocator whose copies and memsets use several threads
+static umpire::Allocator get_parallel_host_allocator()
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  if (!rm.isAllocator("HOST_PARALLEL")) {
+    auto allocator =
+        rm.makeAllocator<umpire::strategy::NamedAllocationStrategy>("HOST_PARALLEL", rm.getAllocator("HOST"));
+
+    auto& op_registry = umpire::op::MemoryOperationRegistry::getInstance();
+    op_registry.setAllocatorOperation(allocator.getAllocationStrategy(), "COPY", "PARALLEL_COPY");
+    op_registry.setAllocatorOperation(allocator.getAllocationStrategy(), "MEMSET", "PARALLEL_MEMSET");
+  }
+
+  return rm.getAllocator("HOST_PARALLEL");
+}
+
+// A HOST allocator whose copies and memsets use non-temporal stores
+static umpire::Allocator get_streaming_host_allocator()
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  if (!rm.isAllocator("HOST_STREAMING")) {
+    auto allocator =
+        rm.makeAllocator<umpire::strategy::NamedAllocationStrategy>("HOST_STREAMING", rm.getAllocator("HOST"));
+
+    auto& op_registry = umpire::op::MemoryOperationRegistry::getInstance();
+    op_registry.setAllocatorOperation(allocator.getAllocationStrategy(), "COPY", "STREAMING_COPY");
+    op_registry.setAllocatorOperation(allocator.getAllocationStrategy(), "MEMSET", "STREAMING_MEMSET");
+  }
+
+  return rm.getAllocator("HOST_STREAMING");
+}
+
 static void benchmark_copy(benchmark::State& state, std::string src, std::string dest) {
   auto& rm = umpire::ResourceManager::getInstance();
 
@@ -35,8 +82,75 @@ static void benchmark_copy(benchmark::State& state, std::string src, std::string
   dest_allocator.deallocate(dest_ptr);
 }
 
+static void benchmark_large_copy(benchmark::State& state, umpire::Allocator (*get_allocator)())
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto allocator = get_allocator();
+
+  auto size = state.range(0);
+
+  void* src_ptr = allocator.allocate(size);
+  void* dest_ptr = allocator.allocate(size);
+  rm.memset(src_ptr, 1);
+  rm.memset(dest_ptr, 0);
+
+  for (auto _ : state) {
+    rm.copy(dest_ptr, src_ptr);
+  }
+
+  state.SetBytesProcessed(state.iterations() * size);
+
+  allocator.deallocate(src_ptr);
+  allocator.deallocate(dest_ptr);
+}
+
+static void benchmark_large_memset(benchmark::State& state, umpire::Allocator (*get_allocator)())
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto allocator = get_allocator();
+
+  auto size = state.range(0);
+
+  void* ptr = allocator.allocate(size);
+  rm.memset(ptr, 0);
+
+  for (auto _ : state) {
+    rm.memset(ptr, 1);
+  }
+
+  state.SetBytesProcessed(state.iterations() * size);
+
+  allocator.deallocate(ptr);
+}
+
 BENCHMARK_CAPTURE(benchmark_copy, host_host, std::string("HOST"), std::string("HOST"))->Range(MIN, MAX);
 
+BENCHMARK_CAPTURE(benchmark_large_copy, host_host, get_host_allocator)->RangeMultiplier(4)->Range(LARGE_MIN, LARGE_MAX);
+BENCHMARK_CAPTURE(benchmark_large_copy, host_host_parallel, get_parallel_host_allocator)
+    ->RangeMultiplier(4)
+    ->Range(LARGE_MIN, LARGE_MAX);
+BENCHMARK_CAPTURE(benchmark_large_memset, host, get_host_allocator)->RangeMultiplier(4)->Range(LARGE_MIN, LARGE_MAX);
+BENCHMARK_CAPTURE(benchmark_large_memset, host_parallel, get_parallel_host_allocator)
+    ->RangeMultiplier(4)
+    ->Range(LARGE_MIN, LARGE_MAX);
+
+// Non-temporal stores against memcpy and memset, from well inside the cache
+// to well outside it
+BENCHMARK_CAPTURE(benchmark_large_copy, host_host_memcpy, get_host_allocator)
+    ->RangeMultiplier(8)
+    ->Range(STREAMING_MIN, STREAMING_MAX);
+BENCHMARK_CAPTURE(benchmark_large_copy, host_host_streaming, get_streaming_host_allocator)
+    ->RangeMultiplier(8)
+    ->Range(STREAMING_MIN, STREAMING_MAX);
+BENCHMARK_CAPTURE(benchmark_large_memset, host_memset, get_host_allocator)
+    ->RangeMultiplier(8)
+    ->Range(STREAMING_MIN, STREAMING_MAX);
+BENCHMARK_CAPTURE(benchmark_large_memset, host_streaming, get_streaming_host_allocator)
+    ->RangeMultiplier(8)
+    ->Range(STREAMING_MIN, STREAMING_MAX);
+
 #if defined(UMPIRE_ENABLE_DEVICE)
 BENCHMARK_CAPTURE(benchmark_copy, host_device, std::string("HOST"), std::string("DEVICE"))->Range(MIN, MAX);
 BENCHMARK_CAPTURE(benchmark_copy, device_host, std::string("DEVICE"), std::string("HOST"))->Range(MIN, MAX);
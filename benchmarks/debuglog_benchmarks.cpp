@@ -5,18 +5,112 @@
 // SPDX-License-Identifier: (MIT)
 //////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <streambuf>
+#include <string>
 
 #include "benchmark/benchmark.h"
 
+#include "umpire/config.hpp"
+
+#include "umpire/Allocator.hpp"
+#include "umpire/ResourceManager.hpp"
+#include "umpire/strategy/QuickPool.hpp"
+#include "umpire/util/Logger.hpp"
 #include "umpire/util/Macros.hpp"
+#include "umpire/util/io.hpp"
+
+//
+// The allocate benchmarks measure the cost of the logging and event hooks on
+// the allocation path. Compare:
+//
+//  * the default build, with UMPIRE_LOG_LEVEL, UMPIRE_REPLAY and
+//    UMPIRE_EVENTS unset: every hook is disabled at runtime,
+//  * a build with -DUMPIRE_ENABLE_LOGGING=Off -DUMPIRE_ENABLE_EVENTS=Off:
+//    every hook is compiled out,
+//  * running with UMPIRE_EVENTS=On: events are recorded.
+//
+// The label of each benchmark shows which hooks were compiled in.
+//
+
+namespace {
+
+class null_buffer : public std::streambuf {
+ protected:
+  int overflow(int c) override
+  {
+    return c;
+  }
+};
+
+std::string hooks_label()
+{
+  std::string label;
+#if defined(UMPIRE_ENABLE_LOGGING)
+  label += "logging";
+#endif
+#if defined(UMPIRE_ENABLE_EVENTS)
+  label += label.empty() ? "events" : " events";
+#endif
+  return label.empty() ? std::string{"no hooks"} : label;
+}
+
+umpire::Allocator& get_pool()
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+  static umpire::Allocator pool{rm.makeAllocator<umpire::strategy::QuickPool>("debuglog_pool", rm.getAllocator("HOST"))};
+  return pool;
+}
+
+} // namespace
 
 static void benchmark_DebugLogger(benchmark::State& state) {
   while (state.KeepRunning()) {
     UMPIRE_LOG(Debug, "(" << 22 << ")");
   }
 }
+
+static void benchmark_Allocate(benchmark::State& state) {
+  auto& pool = get_pool();
+
+  while (state.KeepRunning()) {
+    pool.deallocate(pool.allocate(64));
+  }
+
+  state.SetLabel(hooks_label());
+}
+
+//
+// Debug messages are formatted but written to a buffer that discards them,
+// so this measures the cost of the messages rather than of the output
+//
+static void benchmark_AllocateDebugLogging(benchmark::State& state) {
+  auto& pool = get_pool();
+  auto logger = umpire::util::Logger::getActiveLogger();
+  null_buffer discard;
+  auto buffer = umpire::log().rdbuf(&discard);
+  auto level = umpire::util::message::Error;
+
+  for (int i = 0; i < umpire::util::message::Num_Levels; ++i) {
+    if (logger->logLevelEnabled(static_cast<umpire::util::message::Level>(i)))
+      level = static_cast<umpire::util::message::Level>(i);
+  }
+
+  logger->setLoggingMsgLevel(umpire::util::message::Debug);
+
+  while (state.KeepRunning()) {
+    pool.deallocate(pool.allocate(64));
+  }
+
+  logger->setLoggingMsgLevel(level);
+  umpire::log().rdbuf(buffer);
+
+  state.SetLabel(hooks_label());
+}
+
 //
 // Register the function as a benchmark
 BENCHMARK(benchmark_DebugLogger);
+BENCHMARK(benchmark_Allocate);
+BENCHMARK(benchmark_AllocateDebugLogging);
 
 BENCHMARK_MAIN();
@@ -0,0 +1,121 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "umpire/event/async_event_recorder.hpp"
+#include "umpire/event/binary_file_store.hpp"
+#include "umpire/event/event.hpp"
+#include "umpire/event/event_store_recorder.hpp"
+#include "umpire/event/json_file_store.hpp"
+
+constexpr std::size_t EVENTS{1 << 20}; // allocate+deallocate event pairs recorded per run
+
+/*
+ * \brief Records EVENTS allocate/deallocate event pairs split across
+ *        num_threads threads, and returns the time taken by the recording
+ *        threads. Events still buffered by the recorder are not included.
+ *
+ * \param recorder, the recorder to time
+ * \param num_threads, number of threads recording events
+ */
+template <typename Recorder>
+double run_recorder(Recorder& recorder, std::size_t num_threads)
+{
+  std::vector<std::thread> threads;
+
+  auto begin{std::chrono::system_clock::now()};
+  for (std::size_t t{0}; t < num_threads; t++) {
+    threads.emplace_back([&recorder, num_threads, t] {
+      for (std::size_t i{t}; i < EVENTS; i += num_threads) {
+        void* ptr{reinterpret_cast<void*>(0x7f0000000000 + static_cast<std::uintptr_t>(i + 1) * 64)};
+        recorder.record(umpire::event::allocate{64, nullptr, ptr});
+        recorder.record(umpire::event::deallocate{nullptr, ptr});
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  auto end{std::chrono::system_clock::now()};
+
+  return std::chrono::duration<double>(end - begin).count();
+}
+
+long file_size(const std::string& filename)
+{
+  std::FILE* f{std::fopen(filename.c_str(), "rb")};
+  std::fseek(f, 0, SEEK_END);
+  const long size{std::ftell(f)};
+  std::fclose(f);
+  return size;
+}
+
+void report(const std::string& name, std::size_t num_threads, double seconds)
+{
+  std::cout << "  " << std::setw(24) << std::left << name << std::right << " threads: " << num_threads
+            << "  time: " << seconds << "(s)"
+            << "  latency: " << seconds / (2.0 * EVENTS) * 1.0e9 * num_threads << "(ns)" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  std::cout << std::fixed << std::setprecision(3);
+
+  std::size_t max_threads{4};
+  if (argc > 1)
+    max_threads = std::strtoul(argv[1], nullptr, 10);
+
+  const std::string filename{"event_recorder_stress_test.stats"};
+  const std::string binary_filename{"event_recorder_stress_test.stats.bin"};
+
+  // event_store_recorder writes to the store without locking, so only one
+  // thread may record into it
+  {
+    umpire::event::json_file_store store{filename};
+    umpire::event::event_store_recorder recorder{&store};
+
+    report("json_file_store", 1, run_recorder(recorder, 1));
+  }
+  {
+    umpire::event::binary_file_store store{binary_filename};
+    umpire::event::event_store_recorder recorder{&store};
+
+    report("binary_file_store", 1, run_recorder(recorder, 1));
+  }
+  std::cout << "  json size: " << file_size(filename) << "(B)  binary size: " << file_size(binary_filename)
+            << "(B)" << std::endl;
+  std::cout << std::endl;
+
+  for (auto policy : {umpire::event::async_event_recorder::overflow_policy::block,
+                      umpire::event::async_event_recorder::overflow_policy::drop}) {
+    const bool drop{policy == umpire::event::async_event_recorder::overflow_policy::drop};
+
+    for (std::size_t num_threads{1}; num_threads <= max_threads; num_threads *= 2) {
+      umpire::event::json_file_store store{filename};
+      umpire::event::async_event_recorder recorder{&store, policy};
+
+      report(drop ? "async_event_recorder drop" : "async_event_recorder", num_threads,
+             run_recorder(recorder, num_threads));
+      if (drop)
+        std::cout << "    dropped: " << recorder.get_dropped_count() << std::endl;
+    }
+    std::cout << std::endl;
+  }
+
+  std::remove(filename.c_str());
+  std::remove(binary_filename.c_str());
+
+  return 0;
+}
@@ -9,6 +9,8 @@
 #include <random>
 #include <numeric>
 #include <map>
+#include <vector>
+#include <algorithm>
 
 #include "umpire/config.hpp"
 #include "umpire/ResourceManager.hpp"
@@ -61,6 +63,52 @@ void test_deallocation_performance(umpire::Allocator alloc, std::size_t size, co
   std::cout << "    lifetime: " << alloc_t+dealloc_t << "(us)" << std::endl << std::endl;
 }
 
+/*
+ * \brief Function that tests how the FixedPool allocator scales with the number of live objects.
+ *     num_live objects are allocated and then deallocated in shuffled order, so that the pool grows to
+ *     num_live/OBJECTS_PER_BLOCK sub-pools, and the average allocation and deallocation times are printed.
+ *
+ * \param alloc, the Allocator used by the FixedPool
+ * \param num_live, number of objects allocated before any are deallocated
+ */
+void test_live_object_scaling(umpire::Allocator alloc, std::size_t num_live)
+{
+  auto& rm{umpire::ResourceManager::getInstance()};
+  constexpr std::size_t size{sizeof(double)};
+  constexpr std::size_t convert{1000000000}; //convert sec (s) to nanosec (ns)
+
+  umpire::Allocator pool_alloc = rm.makeAllocator<umpire::strategy::FixedPool, false>
+               ("fixed_pool_live" + std::to_string(num_live), alloc, size, OBJECTS_PER_BLOCK);
+
+  std::vector<void*> allocations(num_live);
+  std::vector<std::size_t> shuffle_order(num_live);
+  std::iota(shuffle_order.begin(), shuffle_order.end(), 0);
+  std::mt19937 gen(num_live);
+  std::shuffle(shuffle_order.begin(), shuffle_order.end(), gen);
+
+  auto begin_alloc{std::chrono::system_clock::now()};
+  for (std::size_t i{0}; i < num_live; i++) {
+    allocations[i] = pool_alloc.allocate(size);
+  }
+  auto end_alloc{std::chrono::system_clock::now()};
+
+  auto begin_dealloc{std::chrono::system_clock::now()};
+  for (std::size_t i{0}; i < num_live; i++) {
+    pool_alloc.deallocate(allocations[shuffle_order[i]]);
+  }
+  auto end_dealloc{std::chrono::system_clock::now()};
+
+  pool_alloc.release();
+
+  double alloc_t{std::chrono::duration<double>(end_alloc - begin_alloc).count()/num_live*convert};
+  double dealloc_t{std::chrono::duration<double>(end_dealloc - begin_dealloc).count()/num_live*convert};
+
+  std::cout << "  LIVE_OBJECTS (FixedPool - " << num_live << " objects, "
+            << (num_live + OBJECTS_PER_BLOCK - 1)/OBJECTS_PER_BLOCK << " sub-pools):" << std::endl;
+  std::cout << "    alloc: " << alloc_t << "(ns)" << std::endl;
+  std::cout << "    dealloc: " << dealloc_t << "(ns)" << std::endl << std::endl;
+}
+
 int main(int, char**)
 {
   //Set up formatting for output
@@ -101,5 +149,10 @@ int main(int, char**)
     }
   }
 
+  //grow a single FixedPool from one sub-pool up to 1M live objects
+  for(std::size_t num_live{OBJECTS_PER_BLOCK}; num_live <= (1<<20); num_live *= 8) {
+    test_live_object_scaling(alloc, num_live);
+  }
+
   return 0;
 }
@@ -0,0 +1,78 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include <cstdint>
+#include <cstring>
+
+#include "benchmark/benchmark.h"
+
+#include "umpire/config.hpp"
+
+#include "umpire/ResourceManager.hpp"
+#include "umpire/Allocator.hpp"
+#include "umpire/Umpire.hpp"
+
+/*
+ * Random 8 byte reads from a buffer much larger than the TLB can cover, so
+ * most reads miss the TLB when the buffer is backed by 4KiB pages.
+ */
+static const std::size_t RangeLow{std::size_t{1} << 26}; // 64MiB
+static const std::size_t RangeHi{std::size_t{1} << 30};  // 1GiB
+static const std::size_t Reads{std::size_t{1} << 22};
+
+static umpire::Allocator get_allocator(const std::string& name)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  if (name == "HUGEPAGE::huge" && !rm.isAllocator(name)) {
+    auto traits = umpire::get_default_resource_traits("HUGEPAGE");
+    traits.pages = umpire::MemoryResourceTraits::page_type::huge;
+    return rm.makeResource(name, traits);
+  }
+
+  return rm.getAllocator(name);
+}
+
+static void benchmark_random_access(benchmark::State& state, std::string name)
+{
+  auto allocator = get_allocator(name);
+
+  const std::size_t size{static_cast<std::size_t>(state.range(0))};
+  const std::size_t mask{size / sizeof(std::uint64_t) - 1};
+
+  auto data = static_cast<std::uint64_t*>(allocator.allocate(size));
+  std::memset(data, 1, size);
+
+  std::uint64_t x{88172645463325252ull};
+  std::uint64_t sum{0};
+
+  for (auto _ : state) {
+    for (std::size_t i{0}; i < Reads; ++i) {
+      x ^= x << 13;
+      x ^= x >> 7;
+      x ^= x << 17;
+      sum += data[x & mask];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * Reads * sizeof(std::uint64_t)));
+
+  allocator.deallocate(data);
+}
+
+BENCHMARK_CAPTURE(benchmark_random_access, host, std::string("HOST"))->RangeMultiplier(4)->Range(RangeLow, RangeHi);
+
+#if defined(UMPIRE_ENABLE_HUGEPAGE_RESOURCE)
+BENCHMARK_CAPTURE(benchmark_random_access, transparent_huge, std::string("HUGEPAGE"))
+    ->RangeMultiplier(4)
+    ->Range(RangeLow, RangeHi);
+BENCHMARK_CAPTURE(benchmark_random_access, huge, std::string("HUGEPAGE::huge"))
+    ->RangeMultiplier(4)
+    ->Range(RangeLow, RangeHi);
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,104 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include <numa.h>
+#include <omp.h>
+#include <sched.h>
+
+#include <cstring>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "umpire/ResourceManager.hpp"
+#include "umpire/Allocator.hpp"
+#include "umpire/strategy/NumaFirstTouchPolicy.hpp"
+#include "umpire/strategy/NumaInterleavePolicy.hpp"
+
+/*
+ * STREAM triad over arrays that are initialized by the main thread, as an
+ * application reading its input serially would. With the HOST allocator every
+ * page is on the node of the main thread; the NUMA policies place the pages
+ * before they are initialized.
+ */
+// Above the largest mmap threshold of glibc (32MiB), so HOST arrays are
+// always freshly mapped and can still be placed by the first touch policy
+static const std::size_t RangeLow{std::size_t{1} << 26}; // 64MiB
+static const std::size_t RangeHi{std::size_t{1} << 30};  // 1GiB
+
+// The node each OpenMP thread runs on, in the order of a static schedule
+static std::vector<int> thread_nodes()
+{
+  std::vector<int> nodes(omp_get_max_threads());
+
+#pragma omp parallel
+  {
+    nodes[omp_get_thread_num()] = numa_node_of_cpu(sched_getcpu());
+  }
+
+  return nodes;
+}
+
+static umpire::Allocator get_allocator(const std::string& name)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  if (rm.isAllocator(name)) {
+    return rm.getAllocator(name);
+  }
+
+  if (name == "interleave") {
+    return rm.makeAllocator<umpire::strategy::NumaInterleavePolicy>(name, rm.getAllocator("HOST"));
+  } else if (name == "first_touch") {
+    return rm.makeAllocator<umpire::strategy::NumaFirstTouchPolicy>(name, rm.getAllocator("HOST"), thread_nodes());
+  }
+
+  return rm.getAllocator(name);
+}
+
+static void benchmark_triad(benchmark::State& state, std::string name)
+{
+  auto allocator = get_allocator(name);
+
+  const std::size_t size{static_cast<std::size_t>(state.range(0))};
+  const long n{static_cast<long>(size / sizeof(double))};
+
+  auto a = static_cast<double*>(allocator.allocate(size));
+  auto b = static_cast<double*>(allocator.allocate(size));
+  auto c = static_cast<double*>(allocator.allocate(size));
+
+  std::memset(a, 0, size);
+  for (long i = 0; i < n; ++i) {
+    b[i] = 1.0;
+    c[i] = 2.0;
+  }
+
+  const double scalar{3.0};
+
+  for (auto _ : state) {
+#pragma omp parallel for schedule(static)
+    for (long i = 0; i < n; ++i) {
+      a[i] = b[i] + scalar * c[i];
+    }
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * 3 * size));
+
+  allocator.deallocate(a);
+  allocator.deallocate(b);
+  allocator.deallocate(c);
+}
+
+BENCHMARK_CAPTURE(benchmark_triad, host, std::string("HOST"))->RangeMultiplier(4)->Range(RangeLow, RangeHi);
+BENCHMARK_CAPTURE(benchmark_triad, interleave, std::string("interleave"))
+    ->RangeMultiplier(4)
+    ->Range(RangeLow, RangeHi);
+BENCHMARK_CAPTURE(benchmark_triad, first_touch, std::string("first_touch"))
+    ->RangeMultiplier(4)
+    ->Range(RangeLow, RangeHi);
+
+BENCHMARK_MAIN();
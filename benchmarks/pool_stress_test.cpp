@@ -17,6 +17,7 @@
 #include "umpire/strategy/MixedPool.hpp"
 #include "umpire/strategy/DynamicPoolList.hpp"
 #include "umpire/strategy/QuickPool.hpp"
+#include "umpire/strategy/SegregatedFitPool.hpp"
 
 #if defined (UMPIRE_ENABLE_CUDA) || defined (UMPIRE_ENABLE_HIP)
   constexpr std::size_t ALLOC_SIZE {8589934592ULL}; //8GiB total size of all allocations together
@@ -110,6 +111,7 @@ int main(int, char**) {
   //Call template function to run tests for each pool
   do_test<umpire::strategy::DynamicPoolList> ("DynamicPoolList", indexing_pairs);
   do_test<umpire::strategy::QuickPool> ("QuickPool", indexing_pairs);
+  do_test<umpire::strategy::SegregatedFitPool> ("SegregatedFitPool", indexing_pairs);
   do_test<umpire::strategy::MixedPool> ("MixedPool", indexing_pairs);
 
   return 0;
@@ -0,0 +1,103 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "umpire/Allocator.hpp"
+#include "umpire/ResourceManager.hpp"
+#include "umpire/config.hpp"
+#include "umpire/strategy/QuickPool.hpp"
+#include "umpire/strategy/SegregatedFitPool.hpp"
+
+constexpr std::size_t OPS{1 << 20}; // allocate+deallocate pairs timed per pool
+
+/*
+ * \brief Fragments the pool by allocating num_chunks blocks of random size and
+ *        freeing every other one, so that the pool holds about num_chunks/2
+ *        free chunks that cannot be merged. Then times OPS allocate/deallocate
+ *        pairs of random sizes against the fragmented pool.
+ *
+ * \param alloc, a given pool allocator
+ * \param num_chunks, number of blocks used to fragment the pool
+ */
+double run_fragmented(umpire::Allocator alloc, std::size_t num_chunks)
+{
+  std::mt19937 gen(num_chunks);
+  std::uniform_int_distribution<std::size_t> dist(16, 4096);
+
+  std::vector<void*> blocks(num_chunks);
+  for (auto& ptr : blocks) {
+    ptr = alloc.allocate(dist(gen));
+  }
+  for (std::size_t i{0}; i < num_chunks; i += 2) {
+    alloc.deallocate(blocks[i]);
+  }
+
+  std::vector<void*> live(64);
+
+  auto begin{std::chrono::system_clock::now()};
+  for (std::size_t i{0}; i < OPS / live.size(); i++) {
+    for (auto& ptr : live) {
+      ptr = alloc.allocate(dist(gen));
+    }
+    for (auto ptr : live) {
+      alloc.deallocate(ptr);
+    }
+  }
+  auto end{std::chrono::system_clock::now()};
+
+  for (std::size_t i{1}; i < num_chunks; i += 2) {
+    alloc.deallocate(blocks[i]);
+  }
+  alloc.release();
+
+  return std::chrono::duration<double>(end - begin).count();
+}
+
+template <typename Pool>
+void test_fragmented(const std::string& pool_name, std::size_t max_chunks)
+{
+  auto& rm{umpire::ResourceManager::getInstance()};
+
+  std::cout << pool_name << ":" << std::endl;
+
+  const std::size_t first_block{Pool::s_default_first_block_size};
+  const std::size_t next_block{Pool::s_default_next_block_size};
+  const std::size_t alignment{Pool::s_default_alignment};
+
+  for (std::size_t n{1024}; n <= max_chunks; n *= 4) {
+    // Untracked and with coalescing disabled so that only the free chunk
+    // lookup is measured.
+    auto alloc = rm.makeAllocator<Pool, false>(pool_name + "_" + std::to_string(n), rm.getAllocator("HOST"),
+                                               first_block, next_block, alignment, Pool::percent_releasable(0));
+
+    const double seconds{run_fragmented(alloc, n)};
+    std::cout << "  free chunks: " << std::setw(8) << n / 2 << "  time: " << seconds << "(s)"
+              << "  latency: " << seconds / (2.0 * OPS) * 1.0e9 << "(ns)" << std::endl;
+  }
+
+  std::cout << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  std::cout << std::fixed << std::setprecision(3);
+
+  std::size_t max_chunks{1 << 18};
+  if (argc > 1)
+    max_chunks = std::strtoul(argv[1], nullptr, 10);
+
+  test_fragmented<umpire::strategy::QuickPool>("QuickPool", max_chunks);
+  test_fragmented<umpire::strategy::SegregatedFitPool>("SegregatedFitPool", max_chunks);
+
+  return 0;
+}
@@ -0,0 +1,97 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "umpire/Allocator.hpp"
+#include "umpire/ResourceManager.hpp"
+#include "umpire/config.hpp"
+#include "umpire/strategy/MixedPool.hpp"
+#include "umpire/strategy/QuickPool.hpp"
+#include "umpire/strategy/SlabPool.hpp"
+
+constexpr std::size_t OPS{1 << 20}; // allocate+deallocate pairs timed per pool
+
+/*
+ * \brief Times OPS allocate/deallocate pairs of random sizes between 16 and
+ *        4096 bytes, keeping num_live allocations alive at a time.
+ *
+ * \param alloc, a given pool allocator
+ * \param num_live, number of allocations held before they are freed
+ */
+double run_small_objects(umpire::Allocator alloc, std::size_t num_live)
+{
+  std::mt19937 gen(num_live);
+  std::uniform_int_distribution<std::size_t> dist(16, 4096);
+
+  std::vector<void*> live(num_live);
+
+  auto begin{std::chrono::system_clock::now()};
+  for (std::size_t i{0}; i < OPS / num_live; i++) {
+    for (auto& ptr : live) {
+      ptr = alloc.allocate(dist(gen));
+    }
+    for (auto ptr : live) {
+      alloc.deallocate(ptr);
+    }
+  }
+  auto end{std::chrono::system_clock::now()};
+
+  alloc.release();
+
+  return std::chrono::duration<double>(end - begin).count();
+}
+
+void report(umpire::Allocator alloc, std::size_t num_live)
+{
+  const double seconds{run_small_objects(alloc, num_live)};
+  std::cout << "  live objects: " << std::setw(8) << num_live << "  time: " << seconds << "(s)"
+            << "  latency: " << seconds / (2.0 * OPS) * 1.0e9 << "(ns)" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  auto& rm{umpire::ResourceManager::getInstance()};
+
+  std::cout << std::fixed << std::setprecision(3);
+
+  std::size_t max_live{1 << 14};
+  if (argc > 1)
+    max_live = std::strtoul(argv[1], nullptr, 10);
+
+  // Untracked so that only the pools themselves are measured
+  std::cout << "QuickPool:" << std::endl;
+  for (std::size_t n{16}; n <= max_live; n *= 8) {
+    report(rm.makeAllocator<umpire::strategy::QuickPool, false>("quick_pool_" + std::to_string(n),
+                                                                rm.getAllocator("HOST")),
+           n);
+  }
+  std::cout << std::endl;
+
+  std::cout << "MixedPool:" << std::endl;
+  for (std::size_t n{16}; n <= max_live; n *= 8) {
+    report(rm.makeAllocator<umpire::strategy::MixedPool, false>("mixed_pool_" + std::to_string(n),
+                                                                rm.getAllocator("HOST")),
+           n);
+  }
+  std::cout << std::endl;
+
+  std::cout << "SlabPool:" << std::endl;
+  for (std::size_t n{16}; n <= max_live; n *= 8) {
+    report(rm.makeAllocator<umpire::strategy::SlabPool, false>("slab_pool_" + std::to_string(n),
+                                                               rm.getAllocator("HOST")),
+           n);
+  }
+  std::cout << std::endl;
+
+  return 0;
+}
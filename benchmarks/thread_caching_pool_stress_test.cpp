@@ -0,0 +1,114 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "umpire/Allocator.hpp"
+#include "umpire/ResourceManager.hpp"
+#include "umpire/config.hpp"
+#include "umpire/strategy/QuickPool.hpp"
+#include "umpire/strategy/ThreadCachingPool.hpp"
+#include "umpire/strategy/ThreadSafeAllocator.hpp"
+
+constexpr std::size_t OPS_PER_THREAD{1 << 20}; // allocate+deallocate pairs per thread
+constexpr std::size_t LIVE_PER_THREAD{64};     // allocations each thread keeps live at once
+
+/*
+ * \brief Each thread repeatedly fills a small window of live allocations of
+ *        random sizes between 16 and 4096 bytes and frees them again. Returns
+ *        the wall time for all threads to finish.
+ *
+ * \param alloc, the allocator under test
+ * \param num_threads, number of threads hammering alloc concurrently
+ */
+double run_threads(umpire::Allocator alloc, std::size_t num_threads)
+{
+  std::vector<std::thread> threads;
+
+  auto begin{std::chrono::system_clock::now()};
+
+  for (std::size_t t{0}; t < num_threads; t++) {
+    threads.emplace_back([=]() mutable {
+      std::mt19937 gen(static_cast<unsigned int>(t));
+      std::uniform_int_distribution<std::size_t> dist(16, 4096);
+      std::vector<void*> live(LIVE_PER_THREAD);
+
+      for (std::size_t i{0}; i < OPS_PER_THREAD / LIVE_PER_THREAD; i++) {
+        for (auto& ptr : live) {
+          ptr = alloc.allocate(dist(gen));
+        }
+        for (auto ptr : live) {
+          alloc.deallocate(ptr);
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto end{std::chrono::system_clock::now()};
+  return std::chrono::duration<double>(end - begin).count();
+}
+
+/*
+ * \brief Prints throughput (million allocate/deallocate pairs per second) and
+ *        speedup over the single threaded run for 1, 2, 4, ... max_threads.
+ */
+void test_scaling(umpire::Allocator alloc, const std::string& name, std::size_t max_threads)
+{
+  std::cout << name << ":" << std::endl;
+
+  double base_rate{0.0};
+  for (std::size_t n{1}; n <= max_threads; n *= 2) {
+    const double seconds{run_threads(alloc, n)};
+    const double rate{static_cast<double>(n * OPS_PER_THREAD) / seconds / 1.0e6};
+    if (n == 1)
+      base_rate = rate;
+
+    std::cout << "  threads: " << std::setw(3) << n << "  time: " << seconds << "(s)"
+              << "  rate: " << rate << "(Mops/s)"
+              << "  speedup: " << rate / base_rate << std::endl;
+  }
+
+  alloc.release();
+  std::cout << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  std::cout << std::fixed << std::setprecision(3);
+
+  std::size_t max_threads{std::thread::hardware_concurrency()};
+  if (argc > 1)
+    max_threads = std::strtoul(argv[1], nullptr, 10);
+  if (max_threads == 0)
+    max_threads = 1;
+
+  auto& rm{umpire::ResourceManager::getInstance()};
+  umpire::Allocator alloc{rm.getAllocator("HOST")};
+
+  // Untracked so the comparison measures the strategies rather than the
+  // shared allocation map.
+  auto quick_pool = rm.makeAllocator<umpire::strategy::QuickPool, false>("quick_pool", alloc);
+  auto thread_safe_pool =
+      rm.makeAllocator<umpire::strategy::ThreadSafeAllocator, false>("thread_safe_quick_pool", quick_pool);
+  auto thread_caching_pool =
+      rm.makeAllocator<umpire::strategy::ThreadCachingPool, false>("thread_caching_pool", alloc);
+
+  test_scaling(thread_safe_pool, "ThreadSafeAllocator(QuickPool)", max_threads);
+  test_scaling(thread_caching_pool, "ThreadCachingPool", max_threads);
+
+  return 0;
+}
@@ -18,6 +18,10 @@ if(WIN32 OR APPLE)
   set(UMPIRE_ENABLE_FILE_RESOURCE Off CACHE BOOL "")
 endif()
 option(UMPIRE_ENABLE_FILE_RESOURCE "Enable File Resource" On)
+if(WIN32 OR APPLE)
+  set(UMPIRE_ENABLE_HUGEPAGE_RESOURCE Off CACHE BOOL "")
+endif()
+option(UMPIRE_ENABLE_HUGEPAGE_RESOURCE "Enable host resource backed by huge pages" On)
 option(UMPIRE_ENABLE_UMAP "Enable UMAP allocator" Off)
 
 option(UMPIRE_ENABLE_SYCL "Build Umpire with SYCL" Off)
@@ -25,6 +29,7 @@ option(UMPIRE_ENABLE_NUMA "Build Umpire with NUMA support" Off)
 option(UMPIRE_ENABLE_OPENMP_TARGET "Build Umpire with OPENMP target" Off)
 
 option(UMPIRE_ENABLE_LOGGING "Build Umpire with Logging enabled" On)
+option(UMPIRE_ENABLE_EVENTS "Build Umpire with event recording (UMPIRE_REPLAY, UMPIRE_EVENTS) enabled" On)
 option(UMPIRE_ENABLE_SLIC "Build Umpire with SLIC logging" Off)
 option(UMPIRE_ENABLE_BACKTRACE "Build Umpire with allocation backtrace enabled" Off)
 option(UMPIRE_ENABLE_BACKTRACE_SYMBOLS "Build Umpire with symbol support" Off)
@@ -39,6 +44,7 @@ option(UMPIRE_ENABLE_SANITIZER_TESTS "Enable address sanitizer tests" Off)
 option(UMPIRE_ENABLE_DEVICE_ALLOCATOR "Enable Device Allocator" Off)
 option(UMPIRE_ENABLE_SQLITE_EXPERIMENTAL "Build with sqlite event integration (experimental)" Off)
 option(UMPIRE_DISABLE_ALLOCATIONMAP_DEBUG "Disable verbose output from AllocationMap during debug builds" Off)
+option(UMPIRE_ENABLE_SHARDED_ALLOCATION_MAP "Track allocations in a sharded map to reduce lock contention" Off)
 set(UMPIRE_FMT_TARGET fmt::fmt-header-only CACHE STRING "Name of fmt target to use") 
 
 if (UMPIRE_ENABLE_INACCESSIBILITY_TESTS)
@@ -66,6 +66,11 @@ std::size_t Allocator::getAllocationCount() const noexcept
   return m_allocator->getAllocationCount();
 }
 
+util::AllocationCounters::Snapshot Allocator::getStatistics() const noexcept
+{
+  return m_allocator->getStatistics();
+}
+
 const std::string& Allocator::getName() const noexcept
 {
   return m_allocator->getName();
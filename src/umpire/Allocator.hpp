@@ -12,6 +12,7 @@
 #include <mutex>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "umpire/strategy/AllocationStrategy.hpp"
 #include "umpire/strategy/mixins/AllocateNull.hpp"
@@ -79,6 +80,54 @@ class Allocator : private strategy::mixins::Inspector, strategy::mixins::Allocat
    */
   inline void deallocate(void* ptr);
 
+  /*!
+   * \brief Free the memory at ptr once the work queued on resource has
+   * completed.
+   *
+   * The memory may still be in use by asynchronous work on resource, such as
+   * a copy made with ResourceManager::copy, when this is called. Strategies
+   * such as DeferredFreePool keep the memory until that work is done, so
+   * this call does not wait for it; other strategies synchronize with
+   * resource before freeing the memory.
+   *
+   * \param ptr Pointer to free (If nullptr, it will be ignored.)
+   * \param resource Resource that work using ptr was queued on.
+   */
+  inline void deallocate(void* ptr, camp::resources::Resource& resource);
+
+  /*!
+   * \brief Free the memory at ptr once event has completed.
+   *
+   * \param ptr Pointer to free (If nullptr, it will be ignored.)
+   * \param event Event marking the end of the work that uses ptr.
+   */
+  inline void deallocate(void* ptr, const camp::resources::Event& event);
+
+  /*!
+   * \brief Allocate a buffer of sizes[i] bytes for each entry of sizes.
+   *
+   * This is equivalent to calling allocate for each size, but a thread safe
+   * Allocator is locked once, the allocations are registered together, and
+   * pools such as QuickPool can carve all of the buffers from one block. If
+   * any of the allocations fails, none of the buffers remain allocated.
+   *
+   * \param sizes Number of bytes to allocate for each buffer.
+   * \param ptrs Resized to the number of buffers, and set to their pointers.
+   */
+  inline void allocate_batch(const std::vector<std::size_t>& sizes, std::vector<void*>& ptrs);
+
+  /*!
+   * \brief Free the memory at each of ptrs.
+   *
+   * This is equivalent to calling deallocate for each pointer, with the
+   * same batching as allocate_batch. Null pointers are ignored. If a pointer
+   * was not allocated by this Allocator, an umpire::runtime_error is thrown
+   * and none of the pointers are freed.
+   *
+   * \param ptrs Pointers to free.
+   */
+  inline void deallocate_batch(const std::vector<void*>& ptrs);
+
   /*!
    * \brief Release any and all unused memory held by this Allocator.
    */
@@ -131,6 +180,15 @@ class Allocator : private strategy::mixins::Inspector, strategy::mixins::Allocat
    */
   std::size_t getAllocationCount() const noexcept;
 
+  /*!
+   * \brief Return the current size, high watermark and allocation count of
+   * this Allocator together.
+   *
+   * Reading the statistics does not take a lock, so this may be polled from
+   * a monitoring thread while other threads use the Allocator.
+   */
+  util::AllocationCounters::Snapshot getStatistics() const noexcept;
+
   /*!
    * \brief Get the name of this Allocator.
    *
@@ -214,10 +272,16 @@ class Allocator : private strategy::mixins::Inspector, strategy::mixins::Allocat
   inline void* thread_safe_allocate(std::size_t bytes);
   inline void* thread_safe_named_allocate(const std::string& name, std::size_t bytes);
   inline void thread_safe_deallocate(void* ptr);
+  inline void thread_safe_deallocate(void* ptr, const camp::resources::Event& completion_event);
+  inline void thread_safe_allocate_batch(const std::vector<std::size_t>& sizes, std::vector<void*>& ptrs);
+  inline void thread_safe_deallocate_batch(const std::vector<void*>& ptrs);
 
   inline void* do_allocate(std::size_t bytes);
   inline void* do_named_allocate(const std::string& name, std::size_t bytes);
   inline void do_deallocate(void* ptr);
+  inline void do_deallocate(void* ptr, const camp::resources::Event& completion_event);
+  inline void do_allocate_batch(const std::vector<std::size_t>& sizes, std::vector<void*>& ptrs);
+  inline void do_deallocate_batch(const std::vector<void*>& ptrs);
 
   bool m_thread_safe{false};
   std::mutex* m_thread_safe_mutex{nullptr};
@@ -7,6 +7,8 @@
 #ifndef UMPIRE_Allocator_INL
 #define UMPIRE_Allocator_INL
 
+#include <algorithm>
+
 #include "umpire/Allocator.hpp"
 #include "umpire/config.hpp"
 #include "umpire/event/event.hpp"
@@ -111,6 +113,129 @@ inline void Allocator::do_deallocate(void* ptr)
   }
 }
 
+inline void Allocator::thread_safe_deallocate(void* ptr, const camp::resources::Event& completion_event)
+{
+  std::lock_guard<std::mutex> lock(*m_thread_safe_mutex);
+  return do_deallocate(ptr, completion_event);
+}
+
+inline void Allocator::do_deallocate(void* ptr, const camp::resources::Event& completion_event)
+{
+  umpire::event::record<umpire::event::deallocate>([&](auto& event) { event.ref((void*)m_allocator).ptr(ptr); });
+
+  UMPIRE_LOG(Debug, "(" << ptr << ")");
+
+  if (!ptr) {
+    UMPIRE_LOG(Info, "Deallocating a null pointer (This behavior is intentionally allowed and ignored)");
+    return;
+  } else {
+    if (m_tracking) {
+      auto record = deregisterAllocation(ptr, m_allocator);
+      if (!deallocateNull(ptr)) {
+        m_allocator->deallocate_after(ptr, record.size, completion_event);
+      }
+    } else {
+      if (!deallocateNull(ptr)) {
+        m_allocator->deallocate_after(ptr, 0, completion_event);
+      }
+    }
+  }
+}
+
+inline void Allocator::thread_safe_allocate_batch(const std::vector<std::size_t>& sizes, std::vector<void*>& ptrs)
+{
+  std::lock_guard<std::mutex> lock(*m_thread_safe_mutex);
+  do_allocate_batch(sizes, ptrs);
+}
+
+inline void Allocator::thread_safe_deallocate_batch(const std::vector<void*>& ptrs)
+{
+  std::lock_guard<std::mutex> lock(*m_thread_safe_mutex);
+  do_deallocate_batch(ptrs);
+}
+
+inline void Allocator::do_allocate_batch(const std::vector<std::size_t>& sizes, std::vector<void*>& ptrs)
+{
+  const std::size_t count{sizes.size()};
+
+  UMPIRE_ASSERT(UMPIRE_VERSION_OK());
+
+  UMPIRE_LOG(Debug, "(count=" << count << ")");
+
+  ptrs.resize(count);
+
+  // Zero-byte allocations come from a separate pool, so a batch that has
+  // them is allocated one buffer at a time
+  if (std::find(sizes.begin(), sizes.end(), 0) != sizes.end()) {
+    std::size_t i{0};
+    try {
+      for (; i < count; ++i) {
+        ptrs[i] = do_allocate(sizes[i]);
+      }
+    } catch (...) {
+      while (i > 0) {
+        do_deallocate(ptrs[--i]);
+      }
+      throw;
+    }
+    return;
+  }
+
+  try {
+    m_allocator->allocate_batch(sizes.data(), count, ptrs.data());
+  } catch (umpire::out_of_memory_error& e) {
+    e.set_allocator_id(this->getId());
+    throw;
+  }
+
+  if (m_tracking) {
+    registerAllocations(ptrs.data(), sizes.data(), count, m_allocator);
+  }
+
+  for (std::size_t i = 0; i < count; ++i) {
+    umpire::event::record<umpire::event::allocate>(
+        [&](auto& event) { event.size(sizes[i]).ref((void*)m_allocator).ptr(ptrs[i]); });
+  }
+}
+
+inline void Allocator::do_deallocate_batch(const std::vector<void*>& ptrs)
+{
+  for (auto ptr : ptrs) {
+    umpire::event::record<umpire::event::deallocate>([&](auto& event) { event.ref((void*)m_allocator).ptr(ptr); });
+  }
+
+  UMPIRE_LOG(Debug, "(count=" << ptrs.size() << ")");
+
+  std::vector<void*> live_ptrs;
+  live_ptrs.reserve(ptrs.size());
+  for (auto ptr : ptrs) {
+    if (ptr) {
+      live_ptrs.push_back(ptr);
+    }
+  }
+
+  std::vector<std::size_t> sizes(live_ptrs.size(), 0);
+
+  if (m_tracking) {
+    std::vector<util::AllocationRecord> records(live_ptrs.size());
+    deregisterAllocations(live_ptrs.data(), live_ptrs.size(), m_allocator, records.data());
+    for (std::size_t i = 0; i < records.size(); ++i) {
+      sizes[i] = records[i].size;
+    }
+  }
+
+  std::size_t count{0};
+  for (std::size_t i = 0; i < live_ptrs.size(); ++i) {
+    if (!deallocateNull(live_ptrs[i])) {
+      live_ptrs[count] = live_ptrs[i];
+      sizes[count] = sizes[i];
+      ++count;
+    }
+  }
+
+  m_allocator->deallocate_batch(live_ptrs.data(), sizes.data(), count);
+}
+
 inline void* Allocator::allocate(std::size_t bytes)
 {
   return m_thread_safe ? thread_safe_allocate(bytes) : do_allocate(bytes);
@@ -126,6 +251,26 @@ inline void Allocator::deallocate(void* ptr)
   m_thread_safe ? thread_safe_deallocate(ptr) : do_deallocate(ptr);
 }
 
+inline void Allocator::deallocate(void* ptr, camp::resources::Resource& resource)
+{
+  deallocate(ptr, resource.get_event());
+}
+
+inline void Allocator::deallocate(void* ptr, const camp::resources::Event& event)
+{
+  m_thread_safe ? thread_safe_deallocate(ptr, event) : do_deallocate(ptr, event);
+}
+
+inline void Allocator::allocate_batch(const std::vector<std::size_t>& sizes, std::vector<void*>& ptrs)
+{
+  m_thread_safe ? thread_safe_allocate_batch(sizes, ptrs) : do_allocate_batch(sizes, ptrs);
+}
+
+inline void Allocator::deallocate_batch(const std::vector<void*>& ptrs)
+{
+  m_thread_safe ? thread_safe_deallocate_batch(ptrs) : do_deallocate_batch(ptrs);
+}
+
 } // end of namespace umpire
 
 #endif // UMPIRE_Allocator_INL
@@ -350,6 +350,27 @@ util::AllocationRecord ResourceManager::deregisterAllocation(void* ptr)
   return m_allocations.remove(ptr);
 }
 
+void ResourceManager::registerAllocations(util::AllocationRecord* records, std::size_t count)
+{
+  UMPIRE_LOG(Debug, "(count=" << count << ") with " << this);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    if (!records[i].ptr) {
+      UMPIRE_ERROR(runtime_error, "Cannot register nullptr!");
+    }
+
+    UMPIRE_RECORD_BACKTRACE(records[i]);
+  }
+
+  m_allocations.insert(records, count);
+}
+
+void ResourceManager::deregisterAllocations(void* const* ptrs, std::size_t count, util::AllocationRecord* records)
+{
+  UMPIRE_LOG(Debug, "(count=" << count << ")");
+  m_allocations.remove(ptrs, count, records);
+}
+
 const util::AllocationRecord* ResourceManager::findAllocationRecord(void* ptr) const
 {
   auto alloc_record = m_allocations.find(ptr);
@@ -680,6 +701,10 @@ void* ResourceManager::reallocate_impl(void* current_ptr, std::size_t new_size,
                      fmt::format("Cannot reallocate an offset ptr (ptr={}, base={})", current_ptr, alloc_record->ptr));
       }
 
+      if (reallocate_in_place(alloc_record, new_size)) {
+        return current_ptr;
+      }
+
       std::shared_ptr<umpire::op::MemoryOperation> op;
       if (alloc_record->strategy->getPlatform() == Platform::host &&
           getAllocator("HOST").getId() != alloc_record->strategy->getId()) {
@@ -731,6 +756,10 @@ void* ResourceManager::reallocate_impl(void* current_ptr, std::size_t new_size,
                      fmt::format("Cannot reallocate an offset ptr (ptr={}, base={})", current_ptr, alloc_record->ptr));
       }
 
+      if (reallocate_in_place(alloc_record, new_size)) {
+        return current_ptr;
+      }
+
       std::shared_ptr<umpire::op::MemoryOperation> op;
       if (alloc_record->strategy->getPlatform() == Platform::host &&
           getAllocator("HOST").getId() != alloc_record->strategy->getId()) {
@@ -746,6 +775,29 @@ void* ResourceManager::reallocate_impl(void* current_ptr, std::size_t new_size,
   return new_ptr;
 }
 
+//
+// Lets the allocator grow or shrink the allocation without copying it, and
+// updates the record and allocator statistics to the new size if it does.
+//
+bool ResourceManager::reallocate_in_place(util::AllocationRecord* record, std::size_t new_size)
+{
+  const std::size_t old_size{record->size};
+  auto strategy = record->strategy;
+
+  // Zero-byte allocations all share the same pointer
+  if (old_size == 0 || !strategy->try_resize(record->ptr, old_size, new_size)) {
+    return false;
+  }
+
+  UMPIRE_LOG(Debug, "(ptr=" << record->ptr << ", old_size=" << old_size << ", new_size=" << new_size
+                            << ") resized in place");
+
+  record->size = new_size;
+  strategy->m_counters.resizeAllocation(old_size, new_size);
+
+  return true;
+}
+
 void* ResourceManager::move(void* ptr, Allocator allocator)
 {
   UMPIRE_LOG(Debug, "(src_ptr=" << ptr << ", allocator=" << allocator.getName() << ")");
@@ -849,6 +901,14 @@ void ResourceManager::deallocate(void* ptr)
   allocator.deallocate(ptr);
 }
 
+void ResourceManager::deallocate(void* ptr, camp::resources::Resource& ctx)
+{
+  UMPIRE_LOG(Debug, "(ptr=" << ptr << ")");
+  Allocator allocator{findAllocatorForPointer(ptr)};
+
+  allocator.deallocate(ptr, ctx);
+}
+
 std::size_t ResourceManager::getSize(void* ptr) const
 {
   auto record = m_allocations.find(ptr);
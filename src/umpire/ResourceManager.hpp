@@ -19,7 +19,9 @@
 #include "umpire/Tracking.hpp"
 #include "umpire/resource/MemoryResourceTypes.hpp"
 #include "umpire/strategy/AllocationStrategy.hpp"
+#include "umpire/config.hpp"
 #include "umpire/util/AllocationMap.hpp"
+#include "umpire/util/ShardedAllocationMap.hpp"
 
 namespace umpire {
 
@@ -181,6 +183,17 @@ class ResourceManager {
    */
   util::AllocationRecord deregisterAllocation(void* ptr);
 
+  /*!
+   * \brief register count allocations with the manager at once.
+   */
+  void registerAllocations(util::AllocationRecord* records, std::size_t count);
+
+  /*!
+   * \brief de-register count addresses with the manager at once, storing the
+   * removed allocation records in records.
+   */
+  void deregisterAllocations(void* const* ptrs, std::size_t count, util::AllocationRecord* records);
+
   /*!
    * \brief Find the allocation record associated with an address ptr.
    *
@@ -280,6 +293,17 @@ class ResourceManager {
    */
   void deallocate(void* ptr);
 
+  /*!
+   * \brief Deallocate any pointer allocated by an Umpire-managed resource,
+   * once the work queued on ctx has completed.
+   *
+   * \param ptr Pointer to deallocate.
+   * \param ctx Resource that work using ptr was queued on.
+   *
+   * \see Allocator::deallocate(void*, camp::resources::Resource&)
+   */
+  void deallocate(void* ptr, camp::resources::Resource& ctx);
+
   /*!
    * \brief Asynchronously prefetch memory ptr to device.
    *
@@ -325,7 +349,13 @@ class ResourceManager {
 
   void* reallocate_impl(void* current_ptr, std::size_t new_size, Allocator allocator, camp::resources::Resource& ctx);
 
+  bool reallocate_in_place(util::AllocationRecord* record, std::size_t new_size);
+
+#if defined(UMPIRE_ENABLE_SHARDED_ALLOCATION_MAP)
+  util::ShardedAllocationMap m_allocations;
+#else
   util::AllocationMap m_allocations;
+#endif
 
   std::list<std::unique_ptr<strategy::AllocationStrategy>> m_allocators;
 
@@ -0,0 +1,97 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_StaticAllocator_HPP
+#define UMPIRE_StaticAllocator_HPP
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+#include "umpire/Allocator.hpp"
+#include "umpire/strategy/AllocationStrategy.hpp"
+#include "umpire/strategy/ThreadSafeAllocator.hpp"
+#include "umpire/strategy/mixins/AllocateNull.hpp"
+#include "umpire/strategy/mixins/Inspector.hpp"
+
+namespace umpire {
+
+/*!
+ * \brief Allocator whose AllocationStrategy type is known at compile time.
+ *
+ * A StaticAllocator behaves like the Allocator it is constructed from:
+ * allocations are tracked by the ResourceManager, counted in the
+ * Allocator's statistics and recorded as events. Calls into the
+ * AllocationStrategy name Strategy directly instead of going through the
+ * AllocationStrategy vtable, so they can be inlined when Strategy's
+ * allocate and deallocate are visible, as they are for the memory
+ * resources.
+ *
+ * The Allocator's strategy must be exactly a Strategy, not a type derived
+ * from it, and a StaticAllocator cannot be used with a ThreadSafeAllocator.
+ *
+ * \code
+ *   auto pool = rm.makeAllocator<umpire::strategy::QuickPool>("pool", rm.getAllocator("HOST"));
+ *   umpire::StaticAllocator<umpire::strategy::QuickPool> static_pool{pool};
+ *
+ *   void* scratch = static_pool.allocate(256);
+ *   static_pool.deallocate(scratch);
+ * \endcode
+ *
+ * \see Allocator
+ */
+template <typename Strategy>
+class StaticAllocator : private strategy::mixins::Inspector, strategy::mixins::AllocateNull {
+  static_assert(std::is_base_of<strategy::AllocationStrategy, Strategy>::value,
+                "StaticAllocator requires an AllocationStrategy");
+  static_assert(!std::is_same<Strategy, strategy::ThreadSafeAllocator>::value,
+                "StaticAllocator cannot lock a ThreadSafeAllocator, use Allocator instead");
+
+ public:
+  /*!
+   * \brief Construct a StaticAllocator that allocates from the same
+   * AllocationStrategy as allocator.
+   *
+   * Throws an umpire::runtime_error if the strategy of allocator is not a
+   * Strategy.
+   */
+  explicit StaticAllocator(Allocator allocator);
+
+  /*!
+   * \brief Allocate bytes of memory.
+   *
+   * \see Allocator::allocate
+   */
+  inline void* allocate(std::size_t bytes);
+
+  /*!
+   * \brief Free the memory at ptr.
+   *
+   * \see Allocator::deallocate
+   */
+  inline void deallocate(void* ptr);
+
+  /*!
+   * \brief Get the Allocator this StaticAllocator was constructed from.
+   */
+  Allocator getAllocator() const noexcept;
+
+  /*!
+   * \brief Get the AllocationStrategy used by this StaticAllocator.
+   */
+  Strategy* getAllocationStrategy() const noexcept;
+
+ private:
+  Allocator m_allocator;
+  Strategy* m_strategy;
+  bool m_tracking;
+};
+
+} // end of namespace umpire
+
+#include "umpire/StaticAllocator.inl"
+
+#endif // UMPIRE_StaticAllocator_HPP
@@ -0,0 +1,101 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_StaticAllocator_INL
+#define UMPIRE_StaticAllocator_INL
+
+#include <typeinfo>
+
+#include "umpire/event/event.hpp"
+#include "umpire/util/Macros.hpp"
+#include "umpire/util/error.hpp"
+
+namespace umpire {
+
+template <typename Strategy>
+StaticAllocator<Strategy>::StaticAllocator(Allocator allocator)
+    : strategy::mixins::Inspector{},
+      strategy::mixins::AllocateNull{},
+      m_allocator{allocator},
+      m_strategy{dynamic_cast<Strategy*>(allocator.getAllocationStrategy())},
+      m_tracking{allocator.isTracked()}
+{
+  // Calls to m_strategy are not virtual, so they would skip the overrides of
+  // a type derived from Strategy
+  if (!m_strategy || typeid(*m_strategy) != typeid(Strategy)) {
+    UMPIRE_ERROR(runtime_error, fmt::format("Allocator \"{}\" is a {}, not a {}", allocator.getName(),
+                                            allocator.getStrategyName(), typeid(Strategy).name()));
+  }
+}
+
+template <typename Strategy>
+inline void* StaticAllocator<Strategy>::allocate(std::size_t bytes)
+{
+  void* ret = nullptr;
+
+  UMPIRE_LOG(Debug, "(" << bytes << ")");
+
+  if (0 == bytes) {
+    ret = allocateNull();
+  } else {
+    try {
+      ret = m_strategy->Strategy::allocate(bytes);
+    } catch (umpire::out_of_memory_error& e) {
+      e.set_allocator_id(m_allocator.getId());
+      e.set_requested_size(bytes);
+      throw;
+    }
+  }
+
+  if (m_tracking) {
+    registerAllocation(ret, bytes, m_strategy);
+  }
+
+  umpire::event::record<umpire::event::allocate>(
+      [&](auto& event) { event.size(bytes).ref((void*)m_strategy).ptr(ret); });
+
+  return ret;
+}
+
+template <typename Strategy>
+inline void StaticAllocator<Strategy>::deallocate(void* ptr)
+{
+  umpire::event::record<umpire::event::deallocate>([&](auto& event) { event.ref((void*)m_strategy).ptr(ptr); });
+
+  UMPIRE_LOG(Debug, "(" << ptr << ")");
+
+  if (!ptr) {
+    UMPIRE_LOG(Info, "Deallocating a null pointer (This behavior is intentionally allowed and ignored)");
+    return;
+  }
+
+  if (m_tracking) {
+    auto record = deregisterAllocation(ptr, m_strategy);
+    if (!deallocateNull(ptr)) {
+      m_strategy->Strategy::deallocate(ptr, record.size);
+    }
+  } else {
+    if (!deallocateNull(ptr)) {
+      m_strategy->Strategy::deallocate(ptr, 0);
+    }
+  }
+}
+
+template <typename Strategy>
+Allocator StaticAllocator<Strategy>::getAllocator() const noexcept
+{
+  return m_allocator;
+}
+
+template <typename Strategy>
+Strategy* StaticAllocator<Strategy>::getAllocationStrategy() const noexcept
+{
+  return m_strategy;
+}
+
+} // end of namespace umpire
+
+#endif // UMPIRE_StaticAllocator_INL
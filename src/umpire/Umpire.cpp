@@ -21,6 +21,7 @@
 #include "umpire/resource/MemoryResource.hpp"
 #include "umpire/strategy/DynamicPoolList.hpp"
 #include "umpire/strategy/QuickPool.hpp"
+#include "umpire/strategy/SegregatedFitPool.hpp"
 #include "umpire/util/wrap_allocator.hpp"
 
 #if !defined(_MSC_VER)
@@ -303,6 +304,12 @@ bool try_coalesce(Allocator a)
     coalesced = true;
   }
 
+  strategy::SegregatedFitPool* sfp{dynamic_cast<strategy::SegregatedFitPool*>(s)};
+  if (sfp) {
+    sfp->coalesce();
+    coalesced = true;
+  }
+
   return coalesced;
 }
 
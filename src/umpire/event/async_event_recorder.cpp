@@ -0,0 +1,332 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+
+#include "umpire/event/async_event_recorder.hpp"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+#include "umpire/event/event.hpp"
+
+namespace umpire {
+namespace event {
+
+namespace {
+
+std::atomic<std::uint64_t> s_next_recorder_id{0};
+
+// Set once the calling thread has started destroying its thread_local
+// objects, after which its rings can no longer be used
+thread_local bool t_thread_exiting{false};
+
+std::size_t round_up_to_power_of_two(std::size_t n) noexcept
+{
+  std::size_t power{1};
+  while (power < n)
+    power <<= 1;
+  return power;
+}
+
+} // namespace
+
+constexpr std::size_t async_event_recorder::s_default_capacity;
+constexpr std::chrono::milliseconds async_event_recorder::s_default_flush_interval;
+
+//
+// The rings that a thread records into, one for each recorder that it has
+// used. Rings are shared with their recorder, which frees them once the
+// thread has exited and they have been drained.
+//
+struct async_event_recorder::thread_rings {
+  ~thread_rings()
+  {
+    t_thread_exiting = true;
+    for (auto& entry : rings) {
+      entry.second->retired.store(true, std::memory_order_release);
+    }
+  }
+
+  std::vector<std::pair<std::uint64_t, std::shared_ptr<ring>>> rings;
+};
+
+async_event_recorder::ring::ring(std::size_t capacity) : slots(capacity), mask{capacity - 1}
+{
+}
+
+async_event_recorder::async_event_recorder(event_store* db, overflow_policy policy, std::size_t capacity,
+                                           std::chrono::milliseconds flush_interval)
+    : m_database{db},
+      m_policy{policy},
+      m_capacity{round_up_to_power_of_two(std::max(capacity, std::size_t{2}))},
+      m_flush_interval{flush_interval},
+      m_id{s_next_recorder_id++}
+{
+  m_thread = std::thread{[this] { background_flush(); }};
+}
+
+async_event_recorder::~async_event_recorder()
+{
+  try {
+    shutdown();
+
+    //
+    // Anything still pending is waiting on an event from a thread that is
+    // part way through recording, so write what we have.
+    //
+    std::lock_guard<std::mutex> lock{m_mutex};
+    for (const auto& r : m_pending) {
+      write(r);
+    }
+    m_pending.clear();
+  } catch (...) {
+  }
+}
+
+void async_event_recorder::record(const event& e)
+{
+  push([&e](record_type& r) {
+    r.type = kind::event;
+    r.payload = new event{e};
+  });
+}
+
+void async_event_recorder::record(const allocate& e)
+{
+  push([&e](record_type& r) {
+    r.type = kind::allocate;
+    r.size = e.size;
+    r.ref = e.ref;
+    r.ptr = e.ptr;
+    r.timestamp = e.timestamp;
+    r.thread = e.thread;
+  });
+}
+
+void async_event_recorder::record(const named_allocate& e)
+{
+  push([&e](record_type& r) {
+    r.type = kind::named_allocate;
+    r.payload = new named_allocate{e};
+  });
+}
+
+void async_event_recorder::record(const deallocate& e)
+{
+  push([&e](record_type& r) {
+    r.type = kind::deallocate;
+    r.ref = e.ref;
+    r.ptr = e.ptr;
+    r.timestamp = e.timestamp;
+    r.thread = e.thread;
+  });
+}
+
+void async_event_recorder::flush()
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+  drain();
+
+  if (m_error) {
+    std::exception_ptr error{m_error};
+    m_error = nullptr;
+    std::rethrow_exception(error);
+  }
+}
+
+void async_event_recorder::shutdown()
+{
+  {
+    std::lock_guard<std::mutex> lock{m_wake_mutex};
+    m_stopped = true;
+  }
+  m_wake_cv.notify_one();
+
+  if (m_thread.joinable()) {
+    m_thread.join();
+  }
+
+  flush();
+}
+
+void async_event_recorder::set_overflow_policy(overflow_policy policy) noexcept
+{
+  m_policy.store(policy);
+}
+
+async_event_recorder::overflow_policy async_event_recorder::get_overflow_policy() const noexcept
+{
+  return m_policy.load();
+}
+
+std::size_t async_event_recorder::get_dropped_count() const noexcept
+{
+  return m_dropped.load();
+}
+
+async_event_recorder::ring* async_event_recorder::get_ring()
+{
+  static thread_local thread_rings t_rings;
+
+  if (t_thread_exiting) {
+    return nullptr;
+  }
+
+  for (auto& entry : t_rings.rings) {
+    if (entry.first == m_id) {
+      return entry.second.get();
+    }
+  }
+
+  auto r = std::make_shared<ring>(m_capacity);
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_rings.push_back(r);
+  }
+  t_rings.rings.emplace_back(m_id, r);
+
+  return r.get();
+}
+
+template <typename Fill>
+void async_event_recorder::push(Fill&& fill)
+{
+  ring* r{m_stopped.load(std::memory_order_relaxed) ? nullptr : get_ring()};
+
+  if (r == nullptr) {
+    //
+    // There is no background thread, or this thread is exiting, so write the
+    // event from here.
+    //
+    record_type rec;
+    fill(rec);
+
+    std::lock_guard<std::mutex> lock{m_mutex};
+    rec.sequence = m_sequence.fetch_add(1, std::memory_order_relaxed);
+    m_pending.push_back(rec);
+    drain();
+    return;
+  }
+
+  const std::size_t tail{r->tail.load(std::memory_order_relaxed)};
+
+  while (tail - r->head.load(std::memory_order_acquire) == m_capacity) {
+    if (m_policy.load(std::memory_order_relaxed) == overflow_policy::drop) {
+      m_dropped.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+
+    flush();
+  }
+
+  record_type& rec = r->slots[tail & r->mask];
+  fill(rec);
+
+  //
+  // The sequence number is taken once the slot is reserved, so dropped events
+  // never leave a gap that the background thread would wait on.
+  //
+  rec.sequence = m_sequence.fetch_add(1, std::memory_order_relaxed);
+  r->tail.store(tail + 1, std::memory_order_release);
+
+  if (tail + 1 - r->head.load(std::memory_order_relaxed) == m_capacity / 2) {
+    if (!m_wake.exchange(true)) {
+      m_wake_cv.notify_one();
+    }
+  }
+}
+
+void async_event_recorder::drain()
+{
+  for (auto it = m_rings.begin(); it != m_rings.end();) {
+    ring& r = **it;
+
+    const bool retired{r.retired.load(std::memory_order_acquire)};
+    std::size_t head{r.head.load(std::memory_order_relaxed)};
+    const std::size_t tail{r.tail.load(std::memory_order_acquire)};
+
+    for (; head != tail; ++head) {
+      m_pending.push_back(r.slots[head & r.mask]);
+    }
+    r.head.store(head, std::memory_order_release);
+
+    if (retired) {
+      it = m_rings.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  //
+  // Events from different threads are written in the order that they took
+  // their sequence numbers. An event is held back until every event before
+  // it has been drained.
+  //
+  std::sort(m_pending.begin(), m_pending.end(),
+            [](const record_type& a, const record_type& b) { return a.sequence < b.sequence; });
+
+  auto it = m_pending.begin();
+  try {
+    for (; it != m_pending.end() && it->sequence == m_next_sequence; ++it, ++m_next_sequence) {
+      write(*it);
+    }
+  } catch (...) {
+    // Skip the event that could not be written so later events are not held back
+    ++it;
+    ++m_next_sequence;
+    m_pending.erase(m_pending.begin(), it);
+    throw;
+  }
+  m_pending.erase(m_pending.begin(), it);
+}
+
+void async_event_recorder::write(const record_type& r)
+{
+  switch (r.type) {
+    case kind::allocate:
+      m_database->insert(allocate{r.size, r.ref, r.ptr, r.timestamp, r.thread});
+      break;
+    case kind::deallocate:
+      m_database->insert(deallocate{r.ref, r.ptr, r.timestamp, r.thread});
+      break;
+    case kind::named_allocate: {
+      std::unique_ptr<named_allocate> e{static_cast<named_allocate*>(r.payload)};
+      m_database->insert(*e);
+      break;
+    }
+    case kind::event: {
+      std::unique_ptr<event> e{static_cast<event*>(r.payload)};
+      m_database->insert(*e);
+      break;
+    }
+  }
+}
+
+void async_event_recorder::background_flush()
+{
+  std::unique_lock<std::mutex> wake_lock{m_wake_mutex};
+
+  while (!m_stopped) {
+    m_wake_cv.wait_for(wake_lock, m_flush_interval, [this] { return m_wake.load() || m_stopped.load(); });
+    m_wake = false;
+
+    wake_lock.unlock();
+    {
+      std::lock_guard<std::mutex> lock{m_mutex};
+      try {
+        drain();
+      } catch (...) {
+        // Hand the error to the next thread that flushes
+        m_error = std::current_exception();
+      }
+    }
+    wake_lock.lock();
+  }
+}
+
+} // namespace event
+} // namespace umpire
@@ -0,0 +1,143 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_async_event_recorder_HPP
+#define UMPIRE_async_event_recorder_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "umpire/event/event_store.hpp"
+
+namespace umpire {
+namespace event {
+
+struct allocate;
+struct named_allocate;
+struct deallocate;
+struct event;
+
+//
+// Recorder that hands events to a background thread instead of writing them
+// to the event_store on the recording thread.
+//
+// Each recording thread gets its own fixed size ring buffer, which it fills
+// without taking a lock. The background thread periodically, or when a ring
+// is half full, drains every ring and writes the events to the store in the
+// order that they were recorded. When a ring is full, the overflow_policy
+// decides whether the recording thread drains the rings itself (block) or
+// the event is discarded (drop).
+//
+class async_event_recorder {
+ public:
+  enum class overflow_policy { block, drop };
+
+  static constexpr std::size_t s_default_capacity{4096};
+  static constexpr std::chrono::milliseconds s_default_flush_interval{10};
+
+  // capacity is the number of events buffered per thread, rounded up to a
+  // power of two
+  async_event_recorder(event_store* db, overflow_policy policy = overflow_policy::block,
+                       std::size_t capacity = s_default_capacity,
+                       std::chrono::milliseconds flush_interval = s_default_flush_interval);
+
+  ~async_event_recorder();
+
+  async_event_recorder(const async_event_recorder&) = delete;
+  async_event_recorder& operator=(const async_event_recorder&) = delete;
+
+  void record(const event& e);
+  void record(const allocate& e);
+  void record(const named_allocate& e);
+  void record(const deallocate& e);
+
+  // Write every event recorded so far to the store
+  void flush();
+
+  // Stop the background thread and flush. Events recorded afterwards are
+  // written to the store by the recording thread.
+  void shutdown();
+
+  void set_overflow_policy(overflow_policy policy) noexcept;
+  overflow_policy get_overflow_policy() const noexcept;
+
+  // Number of events discarded by overflow_policy::drop
+  std::size_t get_dropped_count() const noexcept;
+
+ private:
+  enum class kind : std::uint8_t { event, allocate, named_allocate, deallocate };
+
+  // Fixed size record of an event. Events that are not a fixed size are
+  // copied to the heap and owned by payload until they are written.
+  struct record_type {
+    std::uint64_t sequence;
+    kind type;
+    std::size_t size;
+    void* ref;
+    void* ptr;
+    std::chrono::time_point<std::chrono::system_clock> timestamp;
+    std::uint64_t thread;
+    void* payload;
+  };
+
+  // Single producer, single consumer ring of records
+  struct ring {
+    explicit ring(std::size_t capacity);
+
+    std::vector<record_type> slots;
+    const std::size_t mask;
+    std::atomic<bool> retired{false};
+    char pad0[64];
+    std::atomic<std::size_t> head{0};
+    char pad1[64];
+    std::atomic<std::size_t> tail{0};
+    char pad2[64];
+  };
+
+  struct thread_rings;
+
+  ring* get_ring();
+
+  template <typename Fill>
+  void push(Fill&& fill);
+
+  void drain();
+  void write(const record_type& r);
+  void background_flush();
+
+  event_store* m_database;
+  std::atomic<overflow_policy> m_policy;
+  const std::size_t m_capacity;
+  const std::chrono::milliseconds m_flush_interval;
+  const std::uint64_t m_id;
+
+  std::atomic<std::uint64_t> m_sequence{0};
+  std::atomic<std::size_t> m_dropped{0};
+
+  // Guards the store, m_rings, m_pending, m_next_sequence and m_error
+  std::mutex m_mutex;
+  std::vector<std::shared_ptr<ring>> m_rings;
+  std::vector<record_type> m_pending;
+  std::uint64_t m_next_sequence{0};
+  std::exception_ptr m_error{nullptr};
+
+  std::atomic<bool> m_stopped{false};
+  std::atomic<bool> m_wake{false};
+  std::mutex m_wake_mutex;
+  std::condition_variable m_wake_cv;
+  std::thread m_thread;
+};
+
+} // namespace event
+} // namespace umpire
+#endif // UMPIRE_async_event_recorder_HPP
@@ -0,0 +1,389 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+
+#include "umpire/event/binary_file_store.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "fmt/format.h"
+#include "umpire/event/event.hpp"
+#include "umpire/event/event_json.hpp"
+#include "umpire/json/json.hpp"
+#include "umpire/util/error.hpp"
+
+namespace umpire {
+namespace event {
+
+namespace {
+
+constexpr char s_magic[8]{'U', 'M', 'P', 'E', 'V', 'E', 'N', 'T'};
+constexpr std::uint32_t s_version{1};
+constexpr std::size_t s_slot_size{32};
+constexpr std::size_t s_buffer_size{1 << 20};
+
+struct header {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t slot_size;
+  char reserved[16];
+};
+
+static_assert(sizeof(header) == s_slot_size, "binary_file_store header must fill one slot");
+
+std::size_t slots_for(std::size_t bytes)
+{
+  return (bytes + s_slot_size - 1) / s_slot_size;
+}
+
+std::int64_t to_nanoseconds(const std::chrono::time_point<std::chrono::system_clock>& t)
+{
+  return static_cast<std::int64_t>(std::chrono::time_point_cast<std::chrono::nanoseconds>(t).time_since_epoch().count());
+}
+
+std::chrono::time_point<std::chrono::system_clock> from_nanoseconds(std::int64_t ns)
+{
+  return std::chrono::time_point<std::chrono::system_clock>{
+      std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds{ns})};
+}
+
+std::string pointer_string(const void* ptr)
+{
+  // Same formatting as json_file_store, so events compare equal after conversion
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), "%p", ptr);
+  return buffer;
+}
+
+//
+// Store used by get_events, which turns the fixed size events back into the
+// generic events that json_file_store::get_events returns.
+//
+class event_vector_store : public event_store {
+ public:
+  void insert(const event& e) override
+  {
+    events.push_back(e);
+  }
+
+  void insert(const allocate& e) override
+  {
+    event ev{operation_event("allocate", e.ref, e.ptr, e.timestamp, e.thread)};
+    ev.numeric_args["size"] = e.size;
+    events.push_back(std::move(ev));
+  }
+
+  void insert(const named_allocate& e) override
+  {
+    event ev{operation_event("named_allocate", e.ref, e.ptr, e.timestamp, e.thread)};
+    ev.numeric_args["size"] = e.size;
+    ev.string_args["allocation_name"] = e.name;
+    events.push_back(std::move(ev));
+  }
+
+  void insert(const deallocate& e) override
+  {
+    events.push_back(operation_event("deallocate", e.ref, e.ptr, e.timestamp, e.thread));
+  }
+
+  std::vector<event> get_events() override
+  {
+    return events;
+  }
+
+  std::vector<event> events;
+
+ private:
+  static event operation_event(const std::string& name, void* ref, void* ptr,
+                               std::chrono::time_point<std::chrono::system_clock> timestamp, std::uint64_t thread)
+  {
+    event ev;
+    ev.name = name;
+    ev.cat = category::operation;
+    if (thread != 0) {
+      ev.numeric_args["thread"] = thread;
+    }
+    ev.string_args["allocator_ref"] = pointer_string(ref);
+    ev.string_args["pointer"] = pointer_string(ptr);
+    ev.tags["replay"] = "true";
+    ev.timestamp = timestamp;
+    return ev;
+  }
+};
+
+} // namespace
+
+binary_file_store::binary_file_store(const std::string& filename, bool read_only)
+    : m_filename{filename}, m_read_only{read_only}
+{
+}
+
+binary_file_store::~binary_file_store()
+{
+  if (m_fstream != NULL) {
+    fclose(m_fstream);
+  }
+}
+
+void binary_file_store::insert(const event& e)
+{
+  open_store();
+
+  nlohmann::json json_event = e;
+  std::stringstream ss;
+  ss << json_event;
+  const std::string text{ss.str()};
+
+  write(op::event, text.size(), nullptr, 0, 0, to_nanoseconds(e.timestamp));
+  write_text(text);
+}
+
+void binary_file_store::insert(const allocate& e)
+{
+  open_store();
+  set_thread(e.thread);
+  write(op::allocate, e.size, e.ptr, allocator_id(e.ref), 0, to_nanoseconds(e.timestamp));
+}
+
+void binary_file_store::insert(const named_allocate& e)
+{
+  open_store();
+  set_thread(e.thread);
+  write(op::named_allocate, e.size, e.ptr, allocator_id(e.ref), string_id(e.name), to_nanoseconds(e.timestamp));
+}
+
+void binary_file_store::insert(const deallocate& e)
+{
+  open_store();
+  set_thread(e.thread);
+  write(op::deallocate, 0, e.ptr, allocator_id(e.ref), 0, to_nanoseconds(e.timestamp));
+}
+
+std::vector<event> binary_file_store::get_events()
+{
+  event_vector_store store;
+  copy_to(store);
+  return std::move(store.events);
+}
+
+void binary_file_store::copy_to(event_store& store)
+{
+  open_store();
+
+  //
+  // The records are read in one go and decoded in place. Allocator and
+  // string ids are defined before their first use, so a single pass is
+  // enough.
+  //
+  std::vector<record> records;
+  if (fseek(m_fstream, 0, SEEK_END) == 0) {
+    const long bytes{ftell(m_fstream)};
+    if (bytes > static_cast<long>(s_slot_size)) {
+      records.resize(static_cast<std::size_t>(bytes) / s_slot_size - 1);
+    }
+  }
+
+  if (fseek(m_fstream, s_slot_size, SEEK_SET) != 0
+      || fread(records.data(), s_slot_size, records.size(), m_fstream) != records.size()) {
+    UMPIRE_ERROR(umpire::runtime_error, fmt::format("binary_file_store: Failed to read {}", m_filename));
+  }
+
+  std::vector<void*> allocators{nullptr};
+  std::vector<std::string> strings{std::string{}};
+  std::uint64_t thread{0};
+
+  auto text_at = [&](std::size_t index) {
+    const record& r = records[index];
+    if (index + 1 + slots_for(r.size) > records.size()) {
+      UMPIRE_ERROR(umpire::runtime_error,
+                   fmt::format("binary_file_store: Truncated record #{} in {}", index, m_filename));
+    }
+    return std::string{reinterpret_cast<const char*>(&records[index + 1]), static_cast<std::size_t>(r.size)};
+  };
+
+  auto lookup = [&](const auto& table, std::uint32_t id, std::size_t index) {
+    if (id >= table.size()) {
+      UMPIRE_ERROR(umpire::runtime_error,
+                   fmt::format("binary_file_store: Undefined id {} in record #{} of {}", id, index, m_filename));
+    }
+    return table[id];
+  };
+
+  for (std::size_t i = 0; i < records.size(); ++i) {
+    const record& r = records[i];
+    const op o{static_cast<op>(r.type & 0xff)};
+    const std::uint32_t string{r.type >> 8};
+    void* ptr{reinterpret_cast<void*>(static_cast<std::uintptr_t>(r.ptr))};
+
+    switch (o) {
+      case op::allocate:
+        store.insert(
+            allocate{r.size, lookup(allocators, r.allocator, i), ptr, from_nanoseconds(r.timestamp), thread});
+        break;
+      case op::deallocate:
+        store.insert(deallocate{lookup(allocators, r.allocator, i), ptr, from_nanoseconds(r.timestamp), thread});
+        break;
+      case op::named_allocate:
+        store.insert(named_allocate{r.size, lookup(allocators, r.allocator, i), ptr, lookup(strings, string, i),
+                                    from_nanoseconds(r.timestamp), thread});
+        break;
+      case op::event: {
+        event e;
+        try {
+          e = nlohmann::json::parse(text_at(i));
+        } catch (const umpire::runtime_error&) {
+          throw;
+        } catch (...) {
+          UMPIRE_ERROR(umpire::runtime_error,
+                       fmt::format("binary_file_store: Error parsing record #{} of {}", i, m_filename));
+        }
+        store.insert(e);
+        i += slots_for(r.size);
+        break;
+      }
+      case op::string:
+        strings.push_back(text_at(i));
+        i += slots_for(r.size);
+        break;
+      case op::allocator:
+        allocators.push_back(ptr);
+        break;
+      case op::thread:
+        thread = r.size;
+        break;
+      default:
+        UMPIRE_ERROR(umpire::runtime_error,
+                     fmt::format("binary_file_store: Unknown record type {} in record #{} of {}", r.type & 0xff, i,
+                                 m_filename));
+    }
+  }
+}
+
+bool binary_file_store::is_binary_file(const std::string& filename)
+{
+  FILE* f{fopen(filename.c_str(), "rb")};
+  if (f == NULL) {
+    return false;
+  }
+
+  header h;
+  const bool is_binary{fread(&h, sizeof(h), 1, f) == 1 && std::memcmp(h.magic, s_magic, sizeof(s_magic)) == 0};
+  fclose(f);
+
+  return is_binary;
+}
+
+void binary_file_store::open_store()
+{
+  if (m_fstream != NULL) {
+    return;
+  }
+
+  m_fstream = fopen(m_filename.c_str(), m_read_only ? "rb" : "wb");
+
+  if (m_fstream == NULL) {
+    UMPIRE_ERROR(umpire::runtime_error, fmt::format("Failed to open {}", m_filename));
+  }
+
+  header h{};
+  if (m_read_only) {
+    if (fread(&h, sizeof(h), 1, m_fstream) != 1 || std::memcmp(h.magic, s_magic, sizeof(s_magic)) != 0) {
+      UMPIRE_ERROR(umpire::runtime_error, fmt::format("{} is not a binary event file", m_filename));
+    }
+    if (h.version != s_version || h.slot_size != s_slot_size) {
+      UMPIRE_ERROR(umpire::runtime_error,
+                   fmt::format("{} has unsupported binary event format version {}", m_filename, h.version));
+    }
+  } else {
+    setvbuf(m_fstream, NULL, _IOFBF, s_buffer_size);
+
+    std::memcpy(h.magic, s_magic, sizeof(s_magic));
+    h.version = s_version;
+    h.slot_size = s_slot_size;
+    fwrite(&h, sizeof(h), 1, m_fstream);
+  }
+}
+
+void binary_file_store::write(op o, std::uint64_t size, const void* ptr, std::uint32_t allocator,
+                              std::uint32_t string, std::int64_t timestamp)
+{
+  const record r{timestamp, size, static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(ptr)), allocator,
+                 static_cast<std::uint32_t>(o) | (string << 8)};
+
+  if (fwrite(&r, sizeof(r), 1, m_fstream) != 1) {
+    UMPIRE_ERROR(umpire::runtime_error, fmt::format("binary_file_store: Failed to write to {}", m_filename));
+  }
+}
+
+void binary_file_store::write_text(const std::string& text)
+{
+  static const char padding[s_slot_size]{};
+
+  const std::size_t pad{slots_for(text.size()) * s_slot_size - text.size()};
+  if (fwrite(text.data(), 1, text.size(), m_fstream) != text.size() || fwrite(padding, 1, pad, m_fstream) != pad) {
+    UMPIRE_ERROR(umpire::runtime_error, fmt::format("binary_file_store: Failed to write to {}", m_filename));
+  }
+}
+
+void binary_file_store::set_thread(std::uint64_t thread)
+{
+  if (thread != m_thread) {
+    write(op::thread, thread, nullptr, 0, 0, 0);
+    m_thread = thread;
+  }
+}
+
+std::uint32_t binary_file_store::allocator_id(void* ref)
+{
+  // Runs of events usually come from the same allocator
+  if (ref == m_last_allocator && m_last_allocator_id != 0) {
+    return m_last_allocator_id;
+  }
+
+  auto it = m_allocator_ids.find(ref);
+  if (it != m_allocator_ids.end()) {
+    m_last_allocator = ref;
+    m_last_allocator_id = it->second;
+    return it->second;
+  }
+
+  // Id 0 is reserved for events without an allocator
+  const std::uint32_t id{static_cast<std::uint32_t>(m_allocator_ids.size() + 1)};
+  write(op::allocator, 0, ref, id, 0, 0);
+  m_allocator_ids.emplace(ref, id);
+  m_last_allocator = ref;
+  m_last_allocator_id = id;
+
+  return id;
+}
+
+std::uint32_t binary_file_store::string_id(const std::string& s)
+{
+  auto it = m_string_ids.find(s);
+  if (it != m_string_ids.end()) {
+    return it->second;
+  }
+
+  // Ids share the type field with the operation, which leaves them 24 bits
+  const std::uint32_t id{static_cast<std::uint32_t>(m_string_ids.size() + 1)};
+  if (id >= (1u << 24)) {
+    UMPIRE_ERROR(umpire::runtime_error,
+                 fmt::format("binary_file_store: Too many distinct allocation names in {}", m_filename));
+  }
+
+  write(op::string, s.size(), nullptr, 0, id, 0);
+  write_text(s);
+  m_string_ids.emplace(s, id);
+
+  return id;
+}
+
+} // namespace event
+} // namespace umpire
@@ -0,0 +1,103 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-20, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_binary_file_store_HPP
+#define UMPIRE_binary_file_store_HPP
+
+#include <stdio.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "umpire/event/event_store.hpp"
+
+namespace umpire {
+namespace event {
+
+struct event;
+struct allocate;
+struct named_allocate;
+struct deallocate;
+
+//
+// Event store that writes events as fixed size binary records.
+//
+// The file is a sequence of 32 byte slots in native byte order. The first
+// slot is a header, and every other record starts on a slot boundary:
+//
+//   timestamp  int64   nanoseconds since the epoch
+//   size       uint64  allocation size, or length of the text that follows
+//   ptr        uint64  allocation address, or the id being defined
+//   allocator  uint32  id of the allocator, 0 if none
+//   type       uint32  operation in the low 8 bits, string id in the rest
+//
+// Allocator references and allocation names are replaced by small ids that
+// are defined by allocator and string records the first time they are used.
+// The recording thread is not stored per record. Instead a thread record is
+// written whenever it changes, starting from thread 0.
+// Events other than allocate and deallocate are stored as their JSON text,
+// which like string text is padded to a whole number of slots after the
+// record.
+//
+class binary_file_store : public event_store {
+ public:
+  binary_file_store(const std::string& filename, bool read_only = false);
+  ~binary_file_store();
+
+  binary_file_store(const binary_file_store&) = delete;
+  binary_file_store& operator=(const binary_file_store&) = delete;
+
+  virtual void insert(const event& e) override;
+  virtual void insert(const allocate& e) override;
+  virtual void insert(const named_allocate& e) override;
+  virtual void insert(const deallocate& e) override;
+
+  // Returns events in the same form as json_file_store::get_events
+  virtual std::vector<event> get_events() override;
+
+  // Read every event in the file and insert it into store
+  void copy_to(event_store& store);
+
+  // Returns true if filename starts with a binary_file_store header
+  static bool is_binary_file(const std::string& filename);
+
+ private:
+  enum class op : std::uint8_t { allocate = 1, deallocate, named_allocate, event, string, allocator, thread };
+
+  struct record {
+    std::int64_t timestamp;
+    std::uint64_t size;
+    std::uint64_t ptr;
+    std::uint32_t allocator;
+    std::uint32_t type;
+  };
+
+  static_assert(sizeof(record) == 32, "binary_file_store records must be 32 bytes");
+
+  void open_store();
+  void write(op o, std::uint64_t size, const void* ptr, std::uint32_t allocator, std::uint32_t string,
+             std::int64_t timestamp);
+  void write_text(const std::string& text);
+  void set_thread(std::uint64_t thread);
+  std::uint32_t allocator_id(void* ref);
+  std::uint32_t string_id(const std::string& s);
+
+  FILE* m_fstream{nullptr};
+  std::string m_filename;
+  bool m_read_only;
+
+  std::unordered_map<void*, std::uint32_t> m_allocator_ids;
+  void* m_last_allocator{nullptr};
+  std::uint32_t m_last_allocator_id{0};
+  std::unordered_map<std::string, std::uint32_t> m_string_ids;
+  std::uint64_t m_thread{0};
+};
+
+} // namespace event
+} // namespace umpire
+#endif // UMPIRE_binary_file_store_HPP
@@ -7,12 +7,14 @@
 #ifndef UMPIRE_event_HPP
 #define UMPIRE_event_HPP
 
+#include <atomic>
 #include <cstdint>
 #include <map>
 #include <sstream>
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "camp/camp.hpp"
 #include "umpire/event/recorder_factory.hpp"
@@ -31,6 +33,18 @@ static const bool event_build_enabled{enable_replay || enable_event};
 
 enum class category { operation, statistic, metadata };
 
+//
+// Returns a small index for the calling thread, assigned in the order that
+// threads first record an event. Replay uses it to split the operations back
+// into per-thread streams.
+//
+inline std::uint64_t thread_index() noexcept
+{
+  static std::atomic<std::uint64_t> s_next_index{0};
+  static thread_local const std::uint64_t t_index{s_next_index++};
+  return t_index;
+}
+
 struct event {
   std::string name{"anon"};
   category cat{category::statistic};
@@ -45,6 +59,7 @@ struct allocate {
   void* ref;
   void* ptr;
   std::chrono::time_point<std::chrono::system_clock> timestamp{std::chrono::system_clock::now()};
+  std::uint64_t thread{thread_index()};
 };
 
 struct named_allocate {
@@ -53,12 +68,14 @@ struct named_allocate {
   void* ptr;
   std::string name;
   std::chrono::time_point<std::chrono::system_clock> timestamp{std::chrono::system_clock::now()};
+  std::uint64_t thread{thread_index()};
 };
 
 struct deallocate {
   void* ref;
   void* ptr;
   std::chrono::time_point<std::chrono::system_clock> timestamp{std::chrono::system_clock::now()};
+  std::uint64_t thread{thread_index()};
 };
 
 template <typename E = event>
@@ -143,6 +160,16 @@ class builder {
     return arg(k, to_string(v));
   }
 
+  template <typename T>
+  builder& arg(const std::string& k, const std::vector<T>& v)
+  {
+    std::stringstream ss;
+    for (std::size_t i = 0; i < v.size(); ++i) {
+      ss << (i == 0 ? "" : ",") << v[i];
+    }
+    return arg(k, ss.str());
+  }
+
   template <typename... Ts, std::size_t... N>
   builder& args_impl(std::index_sequence<N...>, Ts... as)
   {
@@ -173,6 +200,10 @@ class builder {
   template <typename Recorder = decltype(recorder_factory::get_recorder())>
   void record(Recorder r = recorder_factory::get_recorder())
   {
+    // Thread 0 is left implicit so single threaded logs are unchanged
+    if (e.cat == category::operation && thread_index() != 0) {
+      e.numeric_args["thread"] = thread_index();
+    }
     r.record(e);
   }
 
@@ -276,21 +307,29 @@ class builder<deallocate> {
 template <typename Lambda>
 void record(Lambda&& l)
 {
-  if (event_build_enabled) {
+#if defined(UMPIRE_ENABLE_EVENTS)
+  if (UMPIRE_UNLIKELY(event_build_enabled)) {
     umpire::event::builder<> e;
     l(e);
     e.record();
   }
+#else
+  UMPIRE_USE_VAR(l);
+#endif
 }
 
 template <typename B, typename Lambda>
 void record(Lambda&& l)
 {
-  if (event_build_enabled) {
+#if defined(UMPIRE_ENABLE_EVENTS)
+  if (UMPIRE_UNLIKELY(event_build_enabled)) {
     umpire::event::builder<B> e;
     l(e);
     e.record();
   }
+#else
+  UMPIRE_USE_VAR(l);
+#endif
 }
 
 } // namespace event
@@ -16,6 +16,7 @@
 
 #include "fmt/format.h"
 #include "umpire/event/event_json.hpp"
+#include "umpire/event/thread_arg.hpp"
 #include "umpire/json/json.hpp"
 #include "umpire/util/error.hpp"
 
@@ -27,6 +28,13 @@ json_file_store::json_file_store(const std::string& filename, bool read_only)
 {
 }
 
+json_file_store::~json_file_store()
+{
+  if (m_fstream != NULL) {
+    fclose(m_fstream);
+  }
+}
+
 void json_file_store::insert(const event& e)
 {
   open_store();
@@ -38,41 +46,44 @@ void json_file_store::insert(const event& e)
 
 void json_file_store::insert(const allocate& e)
 {
+  open_store();
   fprintf(m_fstream,
           R"({"category":"operation","name":"allocate")"
-          R"(,"numeric_args":{"size":%ld})"
+          R"(,"numeric_args":{"size":%ld%s})"
           R"(,"string_args":{"allocator_ref":"%p","pointer":"%p"})"
           R"(,"tags":{"replay":"true"})"
           R"(,"timestamp":%lld})"
           "\n",
-          e.size, e.ref, e.ptr,
+          e.size, thread_arg{e.thread, R"(,"thread":%llu)"}.text, e.ref, e.ptr,
           static_cast<long long>(
               std::chrono::time_point_cast<std::chrono::nanoseconds>(e.timestamp).time_since_epoch().count()));
 }
 
 void json_file_store::insert(const named_allocate& e)
 {
+  open_store();
   fprintf(m_fstream,
           R"({"category":"operation","name":"named_allocate")"
-          R"(,"numeric_args":{"size":%ld})"
+          R"(,"numeric_args":{"size":%ld%s})"
           R"(,"string_args":{"allocator_ref":"%p","pointer":"%p","allocation_name":"%s"})"
           R"(,"tags":{"replay":"true"})"
           R"(,"timestamp":%lld})"
           "\n",
-          e.size, e.ref, e.ptr, e.name.c_str(),
+          e.size, thread_arg{e.thread, R"(,"thread":%llu)"}.text, e.ref, e.ptr, e.name.c_str(),
           static_cast<long long>(
               std::chrono::time_point_cast<std::chrono::nanoseconds>(e.timestamp).time_since_epoch().count()));
 }
 
 void json_file_store::insert(const deallocate& e)
 {
+  open_store();
   fprintf(m_fstream,
           R"({"category":"operation","name":"deallocate")"
-          R"(,"string_args":{"allocator_ref":"%p","pointer":"%p"})"
+          R"(%s,"string_args":{"allocator_ref":"%p","pointer":"%p"})"
           R"(,"tags":{"replay":"true"})"
           R"(,"timestamp":%lld})"
           "\n",
-          e.ref, e.ptr,
+          thread_arg{e.thread, R"(,"numeric_args":{"thread":%llu})"}.text, e.ref, e.ptr,
           static_cast<long long>(
               std::chrono::time_point_cast<std::chrono::nanoseconds>(e.timestamp).time_since_epoch().count()));
 }
@@ -25,6 +25,10 @@ struct deallocate;
 class json_file_store : public event_store {
  public:
   json_file_store(const std::string& filename, bool read_only = false);
+  ~json_file_store();
+
+  json_file_store(const json_file_store&) = delete;
+  json_file_store& operator=(const json_file_store&) = delete;
 
   virtual void insert(const event& e);
   virtual void insert(const allocate& e);
@@ -7,6 +7,9 @@
 
 #include "umpire/event/recorder_factory.hpp"
 
+#include <cstdlib>
+#include <string>
+
 #include "umpire/config.hpp"
 
 #ifndef WIN32
@@ -16,9 +19,11 @@
 #ifdef UMPIRE_ENABLE_SQLITE_EXPERIMENTAL
 #include "umpire/event/sqlite_database.hpp"
 #else
+#include "umpire/event/binary_file_store.hpp"
 #include "umpire/event/json_file_store.hpp"
 #endif // UMPIRE_ENABLE_SQLITE_EXPERIMENTAL
 
+#include "umpire/util/Macros.hpp"
 #include "umpire/util/io.hpp"
 
 #if !defined(_MSC_VER)
@@ -32,21 +37,76 @@
 namespace umpire {
 namespace event {
 
-store_type& recorder_factory::get_recorder()
+namespace {
+
+async_event_recorder::overflow_policy overflow_policy_from_env()
 {
-  static const std::string filename{
-      util::make_unique_filename(util::get_io_output_dir(), util::get_io_output_basename(), getpid(), "stats")};
+  const char* policy_env{std::getenv("UMPIRE_EVENTS_OVERFLOW")};
+
+  if (policy_env != nullptr && std::string{policy_env} == "drop") {
+    return async_event_recorder::overflow_policy::drop;
+  }
 
+  return async_event_recorder::overflow_policy::block;
+}
+
+#ifndef UMPIRE_ENABLE_SQLITE_EXPERIMENTAL
+bool binary_format_from_env()
+{
+  const char* format_env{std::getenv("UMPIRE_EVENTS_FORMAT")};
+
+  return format_env != nullptr && std::string{format_env} == "binary";
+}
+#endif // UMPIRE_ENABLE_SQLITE_EXPERIMENTAL
+
+struct shutdown_at_thread_exit {
+  ~shutdown_at_thread_exit()
+  {
+    try {
+      recorder->shutdown();
+    } catch (...) {
+    }
+  }
+
+  async_event_recorder* recorder;
+};
+
+} // namespace
+
+store_type& recorder_factory::get_recorder()
+{
   // static quest_database db{"localhost", "9009", "db"};
-  // static binary_file_database db{"test.bin"};
+
+  //
+  // The store and recorder are never destroyed, as events are recorded by
+  // the destructors of other static objects. Instead, the background thread
+  // is stopped when the thread that created the recorder exits, which for
+  // the main thread is before any static objects that writing the events
+  // relies on are destroyed. Events recorded after that are written by the
+  // recording thread.
+  //
 #ifdef UMPIRE_ENABLE_SQLITE_EXPERIMENTAL
-  static sqlite_database db{filename};
+  static const std::string filename{
+      util::make_unique_filename(util::get_io_output_dir(), util::get_io_output_basename(), getpid(), "stats")};
+  static sqlite_database* db{new sqlite_database{filename}};
 #else
-  static json_file_store db{filename};
+  static event_store* db{[]() -> event_store* {
+    if (binary_format_from_env()) {
+      return new binary_file_store{util::make_unique_filename(util::get_io_output_dir(),
+                                                              util::get_io_output_basename(), getpid(), "stats.bin")};
+    }
+    return new json_file_store{
+        util::make_unique_filename(util::get_io_output_dir(), util::get_io_output_basename(), getpid(), "stats")};
+  }()};
 #endif // UMPIRE_ENABLE_SQLITE_EXPERIMENTAL
-  static event_store_recorder recorder(&db);
+  static async_event_recorder* recorder{[]() {
+    auto r = new async_event_recorder{db, overflow_policy_from_env()};
+    static thread_local shutdown_at_thread_exit shutdown_guard{r};
+    UMPIRE_USE_VAR(shutdown_guard);
+    return r;
+  }()};
 
-  return recorder;
+  return *recorder;
 }
 
 } // namespace event
@@ -7,12 +7,12 @@
 #ifndef UMPIRE_recorder_factory_HPP
 #define UMPIRE_recorder_factory_HPP
 
-#include "umpire/event/event_store_recorder.hpp"
+#include "umpire/event/async_event_recorder.hpp"
 
 namespace umpire {
 namespace event {
 
-using store_type = event_store_recorder;
+using store_type = async_event_recorder;
 
 class recorder_factory {
  public:
@@ -17,6 +17,7 @@
 #include "umpire/config.hpp"
 #include "umpire/event/event.hpp"
 #include "umpire/event/event_json.hpp"
+#include "umpire/event/thread_arg.hpp"
 #include "umpire/json/json.hpp"
 
 namespace umpire {
@@ -68,12 +69,12 @@ void sqlite_database::insert(const allocate& e)
   sprintf(buffer,
           "INSERT INTO EVENTS VALUES(json('"
           R"({"category":"operation","name":"allocate")"
-          R"(,"numeric_args":{"size":%ld})"
+          R"(,"numeric_args":{"size":%ld%s})"
           R"(,"string_args":{"allocator_ref":"%p","pointer":"%p"})"
           R"(,"tags":{"replay":"true"})"
           R"(,"timestamp":%lld})"
           "'));",
-          e.size, e.ref, e.ptr,
+          e.size, thread_arg{e.thread, R"(,"thread":%llu)"}.text, e.ref, e.ptr,
           static_cast<long long>(
               std::chrono::time_point_cast<std::chrono::nanoseconds>(e.timestamp).time_since_epoch().count()));
 
@@ -87,12 +88,12 @@ void sqlite_database::insert(const named_allocate& e)
   sprintf(buffer,
           "INSERT INTO EVENTS VALUES(json('"
           R"({"category":"operation","name":"named_allocate")"
-          R"(,"numeric_args":{"size":%ld})"
+          R"(,"numeric_args":{"size":%ld%s})"
           R"(,"string_args":{"allocator_ref":"%p","pointer":"%p","allocation_name":"%s"})"
           R"(,"tags":{"replay":"true"})"
           R"(,"timestamp":%lld})"
           "'));",
-          e.size, e.ref, e.ptr, e.name.c_str(),
+          e.size, thread_arg{e.thread, R"(,"thread":%llu)"}.text, e.ref, e.ptr, e.name.c_str(),
           static_cast<long long>(
               std::chrono::time_point_cast<std::chrono::nanoseconds>(e.timestamp).time_since_epoch().count()));
 
@@ -106,11 +107,11 @@ void sqlite_database::insert(const deallocate& e)
   sprintf(buffer,
           "INSERT INTO EVENTS VALUES(json('"
           R"({"category":"operation","name":"deallocate")"
-          R"(,"string_args":{"allocator_ref":"%p","pointer":"%p"})"
+          R"(%s,"string_args":{"allocator_ref":"%p","pointer":"%p"})"
           R"(,"tags":{"replay":"true"})"
           R"(,"timestamp":%lld})"
           "'));",
-          e.ref, e.ptr,
+          thread_arg{e.thread, R"(,"numeric_args":{"thread":%llu})"}.text, e.ref, e.ptr,
           static_cast<long long>(
               std::chrono::time_point_cast<std::chrono::nanoseconds>(e.timestamp).time_since_epoch().count()));
 
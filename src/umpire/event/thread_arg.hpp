@@ -0,0 +1,36 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_thread_arg_HPP
+#define UMPIRE_thread_arg_HPP
+
+#include <stdio.h>
+
+#include <cstdint>
+
+namespace umpire {
+namespace event {
+
+/*!
+ * \brief The thread of an event formatted for a store, or an empty string
+ * for the first thread, matching builder<event>.
+ */
+struct thread_arg {
+  thread_arg(std::uint64_t thread, const char* format)
+  {
+    text[0] = '\0';
+    if (thread != 0) {
+      snprintf(text, sizeof(text), format, static_cast<unsigned long long>(thread));
+    }
+  }
+
+  char text[64];
+};
+
+} // namespace event
+} // namespace umpire
+
+#endif // UMPIRE_thread_arg_HPP
@@ -0,0 +1,38 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/op/HostParallelCopyOperation.hpp"
+
+#include <cstring>
+
+#include "umpire/util/Macros.hpp"
+#include "umpire/util/parallel_chunks.hpp"
+
+namespace umpire {
+namespace op {
+
+HostParallelCopyOperation::HostParallelCopyOperation(std::size_t min_chunk_size, std::size_t num_threads) noexcept
+    : m_min_chunk_size{min_chunk_size}, m_num_threads{num_threads}
+{
+}
+
+void HostParallelCopyOperation::transform(void* src_ptr, void** dst_ptr,
+                                          util::AllocationRecord* UMPIRE_UNUSED_ARG(src_allocation),
+                                          util::AllocationRecord* UMPIRE_UNUSED_ARG(dst_allocation),
+                                          std::size_t length)
+{
+  char* dst{static_cast<char*>(*dst_ptr)};
+  const char* src{static_cast<const char*>(src_ptr)};
+
+  // Chunks follow the pages of the destination, which is written
+  util::parallel_for_each_chunk(dst, length, m_min_chunk_size, m_num_threads,
+                                [=](std::size_t offset, std::size_t bytes) {
+                                  std::memcpy(dst + offset, src + offset, bytes);
+                                });
+}
+
+} // end of namespace op
+} // end of namespace umpire
@@ -0,0 +1,56 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_HostParallelCopyOperation_HPP
+#define UMPIRE_HostParallelCopyOperation_HPP
+
+#include "umpire/op/MemoryOperation.hpp"
+
+namespace umpire {
+namespace op {
+
+/*!
+ * \brief Copy memory between two allocations in CPU memory using several
+ * threads.
+ *
+ * Copies of at least twice min_chunk_size bytes are split into one chunk per
+ * thread with util::parallel_for_each_chunk, smaller copies use a single
+ * memcpy. This operation is registered as "PARALLEL_COPY", and is used for
+ * the copies of an allocator selected with
+ * MemoryOperationRegistry::setAllocatorOperation.
+ */
+class HostParallelCopyOperation : public MemoryOperation {
+ public:
+  static constexpr std::size_t s_default_min_chunk_size{4 * 1024 * 1024};
+
+  /*!
+   * \param min_chunk_size Smallest number of bytes given to a thread
+   * \param num_threads Largest number of threads to use, 0 for
+   * util::parallel_chunk_threads()
+   */
+  HostParallelCopyOperation(std::size_t min_chunk_size = s_default_min_chunk_size,
+                            std::size_t num_threads = 0) noexcept;
+
+  /*
+   * \copybrief MemoryOperation::transform
+   *
+   * Perform a parallel memcpy to move length bytes of data from src_ptr to
+   * dst_ptr
+   *
+   * \copydetails MemoryOperation::transform
+   */
+  void transform(void* src_ptr, void** dst_ptr, umpire::util::AllocationRecord* src_allocation,
+                 umpire::util::AllocationRecord* dst_allocation, std::size_t length);
+
+ private:
+  std::size_t m_min_chunk_size;
+  std::size_t m_num_threads;
+};
+
+} // namespace op
+} // end of namespace umpire
+
+#endif // UMPIRE_HostParallelCopyOperation_HPP
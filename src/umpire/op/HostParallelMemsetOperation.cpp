@@ -0,0 +1,34 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/op/HostParallelMemsetOperation.hpp"
+
+#include <cstring>
+
+#include "umpire/util/Macros.hpp"
+#include "umpire/util/parallel_chunks.hpp"
+
+namespace umpire {
+namespace op {
+
+HostParallelMemsetOperation::HostParallelMemsetOperation(std::size_t min_chunk_size, std::size_t num_threads) noexcept
+    : m_min_chunk_size{min_chunk_size}, m_num_threads{num_threads}
+{
+}
+
+void HostParallelMemsetOperation::apply(void* src_ptr, util::AllocationRecord* UMPIRE_UNUSED_ARG(allocation),
+                                        int value, std::size_t length)
+{
+  char* ptr{static_cast<char*>(src_ptr)};
+
+  util::parallel_for_each_chunk(ptr, length, m_min_chunk_size, m_num_threads,
+                                [=](std::size_t offset, std::size_t bytes) {
+                                  std::memset(ptr + offset, value, bytes);
+                                });
+}
+
+} // end of namespace op
+} // end of namespace umpire
@@ -0,0 +1,51 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_HostParallelMemsetOperation_HPP
+#define UMPIRE_HostParallelMemsetOperation_HPP
+
+#include "umpire/op/MemoryOperation.hpp"
+
+namespace umpire {
+namespace op {
+
+/*!
+ * \brief Memset an allocation in CPU memory using several threads.
+ *
+ * Like HostParallelCopyOperation, this splits large memsets into one chunk
+ * per thread. It is registered as "PARALLEL_MEMSET".
+ */
+class HostParallelMemsetOperation : public MemoryOperation {
+ public:
+  static constexpr std::size_t s_default_min_chunk_size{4 * 1024 * 1024};
+
+  /*!
+   * \param min_chunk_size Smallest number of bytes given to a thread
+   * \param num_threads Largest number of threads to use, 0 for
+   * util::parallel_chunk_threads()
+   */
+  HostParallelMemsetOperation(std::size_t min_chunk_size = s_default_min_chunk_size,
+                              std::size_t num_threads = 0) noexcept;
+
+  /*!
+   * \copybrief MemoryOperation::apply
+   *
+   * Uses a parallel std::memset to set the first length bytes of src_ptr to
+   * value.
+   *
+   * \copydetails MemoryOperation::apply
+   */
+  void apply(void* src_ptr, util::AllocationRecord* allocation, int value, std::size_t length);
+
+ private:
+  std::size_t m_min_chunk_size;
+  std::size_t m_num_threads;
+};
+
+} // end of namespace op
+} // end of namespace umpire
+
+#endif // UMPIRE_HostParallelMemsetOperation_HPP
@@ -0,0 +1,35 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/op/HostStreamingCopyOperation.hpp"
+
+#include <cstring>
+
+#include "umpire/util/Macros.hpp"
+#include "umpire/util/streaming.hpp"
+
+namespace umpire {
+namespace op {
+
+HostStreamingCopyOperation::HostStreamingCopyOperation(std::size_t threshold) noexcept
+    : m_threshold{threshold == 0 ? util::last_level_cache_size() : threshold}
+{
+}
+
+void HostStreamingCopyOperation::transform(void* src_ptr, void** dst_ptr,
+                                           util::AllocationRecord* UMPIRE_UNUSED_ARG(src_allocation),
+                                           util::AllocationRecord* UMPIRE_UNUSED_ARG(dst_allocation),
+                                           std::size_t length)
+{
+  if (length > m_threshold) {
+    util::streaming_memcpy(*dst_ptr, src_ptr, length);
+  } else {
+    std::memcpy(*dst_ptr, src_ptr, length);
+  }
+}
+
+} // end of namespace op
+} // end of namespace umpire
@@ -0,0 +1,51 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_HostStreamingCopyOperation_HPP
+#define UMPIRE_HostStreamingCopyOperation_HPP
+
+#include "umpire/op/MemoryOperation.hpp"
+
+namespace umpire {
+namespace op {
+
+/*!
+ * \brief Copy memory between two allocations in CPU memory with
+ * non-temporal stores.
+ *
+ * Copies of more than threshold bytes use util::streaming_memcpy, which does
+ * not read the destination into the cache or evict data from it, smaller
+ * copies use memcpy. This operation is registered as "STREAMING_COPY", and
+ * is used for the copies of an allocator selected with
+ * MemoryOperationRegistry::setAllocatorOperation.
+ */
+class HostStreamingCopyOperation : public MemoryOperation {
+ public:
+  /*!
+   * \param threshold Largest number of bytes copied with memcpy, 0 for
+   * util::last_level_cache_size()
+   */
+  HostStreamingCopyOperation(std::size_t threshold = 0) noexcept;
+
+  /*
+   * \copybrief MemoryOperation::transform
+   *
+   * Perform a memcpy with non-temporal stores to move length bytes of data
+   * from src_ptr to dst_ptr
+   *
+   * \copydetails MemoryOperation::transform
+   */
+  void transform(void* src_ptr, void** dst_ptr, umpire::util::AllocationRecord* src_allocation,
+                 umpire::util::AllocationRecord* dst_allocation, std::size_t length);
+
+ private:
+  std::size_t m_threshold;
+};
+
+} // namespace op
+} // end of namespace umpire
+
+#endif // UMPIRE_HostStreamingCopyOperation_HPP
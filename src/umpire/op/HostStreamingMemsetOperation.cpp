@@ -0,0 +1,33 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/op/HostStreamingMemsetOperation.hpp"
+
+#include <cstring>
+
+#include "umpire/util/Macros.hpp"
+#include "umpire/util/streaming.hpp"
+
+namespace umpire {
+namespace op {
+
+HostStreamingMemsetOperation::HostStreamingMemsetOperation(std::size_t threshold) noexcept
+    : m_threshold{threshold == 0 ? util::last_level_cache_size() : threshold}
+{
+}
+
+void HostStreamingMemsetOperation::apply(void* src_ptr, util::AllocationRecord* UMPIRE_UNUSED_ARG(allocation),
+                                         int value, std::size_t length)
+{
+  if (length > m_threshold) {
+    util::streaming_memset(src_ptr, value, length);
+  } else {
+    std::memset(src_ptr, value, length);
+  }
+}
+
+} // end of namespace op
+} // end of namespace umpire
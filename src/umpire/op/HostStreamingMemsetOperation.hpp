@@ -0,0 +1,48 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_HostStreamingMemsetOperation_HPP
+#define UMPIRE_HostStreamingMemsetOperation_HPP
+
+#include "umpire/op/MemoryOperation.hpp"
+
+namespace umpire {
+namespace op {
+
+/*!
+ * \brief Set memory in CPU memory with non-temporal stores.
+ *
+ * Memsets of more than threshold bytes use util::streaming_memset, smaller
+ * ones use memset. This operation is registered as "STREAMING_MEMSET".
+ *
+ * \see HostStreamingCopyOperation
+ */
+class HostStreamingMemsetOperation : public MemoryOperation {
+ public:
+  /*!
+   * \param threshold Largest number of bytes set with memset, 0 for
+   * util::last_level_cache_size()
+   */
+  HostStreamingMemsetOperation(std::size_t threshold = 0) noexcept;
+
+  /*!
+   * \copybrief MemoryOperation::apply
+   *
+   * Uses non-temporal stores to set the first length bytes of src_ptr to
+   * value.
+   *
+   * \copydetails MemoryOperation::apply
+   */
+  void apply(void* src_ptr, util::AllocationRecord* allocation, int value, std::size_t length);
+
+ private:
+  std::size_t m_threshold;
+};
+
+} // namespace op
+} // end of namespace umpire
+
+#endif // UMPIRE_HostStreamingMemsetOperation_HPP
@@ -10,7 +10,11 @@
 #include "umpire/op/GenericReallocateOperation.hpp"
 #include "umpire/op/HostCopyOperation.hpp"
 #include "umpire/op/HostMemsetOperation.hpp"
+#include "umpire/op/HostParallelCopyOperation.hpp"
+#include "umpire/op/HostParallelMemsetOperation.hpp"
 #include "umpire/op/HostReallocateOperation.hpp"
+#include "umpire/op/HostStreamingCopyOperation.hpp"
+#include "umpire/op/HostStreamingMemsetOperation.hpp"
 
 #if defined(UMPIRE_ENABLE_NUMA)
 #include "umpire/op/NumaMoveOperation.hpp"
@@ -63,6 +67,18 @@ MemoryOperationRegistry::MemoryOperationRegistry() noexcept
 
   registerOperation("MEMSET", std::make_pair(Platform::host, Platform::host), std::make_shared<HostMemsetOperation>());
 
+  registerOperation("PARALLEL_COPY", std::make_pair(Platform::host, Platform::host),
+                    std::make_shared<HostParallelCopyOperation>());
+
+  registerOperation("PARALLEL_MEMSET", std::make_pair(Platform::host, Platform::host),
+                    std::make_shared<HostParallelMemsetOperation>());
+
+  registerOperation("STREAMING_COPY", std::make_pair(Platform::host, Platform::host),
+                    std::make_shared<HostStreamingCopyOperation>());
+
+  registerOperation("STREAMING_MEMSET", std::make_pair(Platform::host, Platform::host),
+                    std::make_shared<HostStreamingMemsetOperation>());
+
   registerOperation("REALLOCATE", std::make_pair(Platform::host, Platform::host),
                     std::make_shared<HostReallocateOperation>());
 
@@ -209,12 +225,53 @@ void MemoryOperationRegistry::registerOperation(const std::string& name, std::pa
   operations->second.insert(std::make_pair(platforms, operation));
 }
 
+void MemoryOperationRegistry::setAllocatorOperation(strategy::AllocationStrategy* allocator, const std::string& name,
+                                                    const std::string& operation)
+{
+  if (operation.empty()) {
+    auto operations = m_allocator_operations.find(allocator->getId());
+    if (operations != m_allocator_operations.end()) {
+      operations->second.erase(name);
+      if (operations->second.empty()) {
+        m_allocator_operations.erase(operations);
+      }
+    }
+    return;
+  }
+
+  if (m_operators.find(operation) == m_operators.end()) {
+    UMPIRE_ERROR(runtime_error, fmt::format("Cannot find operator \"{}\"", operation));
+  }
+
+  m_allocator_operations[allocator->getId()][name] = operation;
+}
+
 std::shared_ptr<umpire::op::MemoryOperation> MemoryOperationRegistry::find(const std::string& name,
                                                                            strategy::AllocationStrategy* src_allocator,
                                                                            strategy::AllocationStrategy* dst_allocator)
 {
   auto platforms = std::make_pair(src_allocator->getPlatform(), dst_allocator->getPlatform());
 
+  if (!m_allocator_operations.empty()) {
+    for (auto allocator : {dst_allocator, src_allocator}) {
+      auto operations = m_allocator_operations.find(allocator->getId());
+      if (operations == m_allocator_operations.end()) {
+        continue;
+      }
+
+      auto replacement = operations->second.find(name);
+      if (replacement == operations->second.end()) {
+        continue;
+      }
+
+      auto& replacement_operations = m_operators[replacement->second];
+      auto op = replacement_operations.find(platforms);
+      if (op != replacement_operations.end()) {
+        return op->second;
+      }
+    }
+  }
+
   return find(name, platforms);
 }
 
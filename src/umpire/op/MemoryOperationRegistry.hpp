@@ -48,6 +48,10 @@ struct pair_hash {
  * - "MEMSET"
  * - "REALLOCATE"
  *
+ * Host allocations can also use "PARALLEL_COPY", "PARALLEL_MEMSET",
+ * "STREAMING_COPY" and "STREAMING_MEMSET", which are selected per allocator
+ * with setAllocatorOperation.
+ *
  * \see MemoryOperation
  * \see AllocationStrategy
  */
@@ -90,6 +94,24 @@ class MemoryOperationRegistry {
   void registerOperation(const std::string& name, std::pair<Platform, Platform> platforms,
                          std::shared_ptr<MemoryOperation>&& operation) noexcept;
 
+  /*!
+   * \brief Use another registered operation in place of an operation for
+   * allocations of an allocator.
+   *
+   * For example, setting "PARALLEL_COPY" for "COPY" makes copies to or from
+   * allocations of allocator use several threads. The destination allocator
+   * is checked first, and the replacement is only used when it is registered
+   * for the platforms of both allocations. Like registerOperation, this
+   * should be called before the allocator is used by several threads.
+   *
+   * \param allocator AllocationStrategy of the allocator.
+   * \param name Name of the operation to replace.
+   * \param operation Name of the operation to use instead, or an empty
+   * string to go back to name.
+   */
+  void setAllocatorOperation(strategy::AllocationStrategy* allocator, const std::string& name,
+                             const std::string& operation);
+
   MemoryOperationRegistry(const MemoryOperationRegistry&) = delete;
   MemoryOperationRegistry& operator=(const MemoryOperationRegistry&) = delete;
   ~MemoryOperationRegistry() = default;
@@ -105,6 +127,11 @@ class MemoryOperationRegistry {
   std::unordered_map<std::string,
                      std::unordered_map<std::pair<Platform, Platform>, std::shared_ptr<MemoryOperation>, pair_hash>>
       m_operators;
+
+  /*
+   * Replacement operation names by allocator id, then by operation name.
+   */
+  std::unordered_map<int, std::unordered_map<std::string, std::string>> m_allocator_operations;
 };
 
 } // end of namespace op
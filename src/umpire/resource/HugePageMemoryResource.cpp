@@ -0,0 +1,245 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/resource/HugePageMemoryResource.hpp"
+
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "umpire/util/Macros.hpp"
+#include "umpire/util/error.hpp"
+
+namespace umpire {
+namespace resource {
+
+namespace {
+
+std::size_t default_huge_page_size()
+{
+  std::ifstream meminfo{"/proc/meminfo"};
+
+  std::string line;
+  while (std::getline(meminfo, line)) {
+    std::stringstream ss{line};
+    std::string key;
+    ss >> key;
+
+    if (key == "Hugepagesize:") {
+      std::size_t kilobytes{0};
+      ss >> kilobytes;
+      if (kilobytes != 0) {
+        return kilobytes * 1024;
+      }
+    }
+  }
+
+  return std::size_t{2} * 1024 * 1024;
+}
+
+std::size_t round_up(std::size_t bytes, std::size_t page_size)
+{
+  return ((std::max<std::size_t>(bytes, 1) + page_size - 1) / page_size) * page_size;
+}
+
+} // end of anonymous namespace
+
+HugePageMemoryResource::HugePageMemoryResource(Platform platform, const std::string& name, int id,
+                                               MemoryResourceTraits traits)
+    : MemoryResource{name, id, traits},
+      m_platform{platform},
+      m_pages{traits.pages},
+      m_page_size{static_cast<std::size_t>(::sysconf(_SC_PAGESIZE))}
+{
+  const std::size_t system_page_size{m_page_size};
+
+  if (m_pages != MemoryResourceTraits::page_type::standard) {
+    m_page_size = traits.page_size != 0 ? traits.page_size : default_huge_page_size();
+  }
+
+  if (m_page_size == 0 || (m_page_size & (m_page_size - 1)) != 0) {
+    UMPIRE_ERROR(runtime_error, fmt::format("Invalid page size {}, it must be a power of 2", m_page_size));
+  }
+
+  if (m_page_size < system_page_size) {
+    UMPIRE_ERROR(runtime_error, fmt::format("Invalid page size {}, it must be at least the system page size {}",
+                                            m_page_size, system_page_size));
+  }
+
+  UMPIRE_LOG(Debug, "Using pages of " << m_page_size << " bytes");
+}
+
+HugePageMemoryResource::~HugePageMemoryResource()
+{
+  std::vector<void*> leaked_items;
+
+  for (auto const& m : m_mapped_sizes) {
+    leaked_items.push_back(m.first);
+  }
+
+  for (auto const& p : leaked_items) {
+    try {
+      deallocate(p, 0);
+    } catch (...) {
+      UMPIRE_LOG(Error, "Failed to unmap " << p);
+    }
+  }
+}
+
+void* HugePageMemoryResource::allocate(std::size_t bytes)
+{
+  const std::size_t length{round_up(bytes, m_page_size)};
+  void* ptr{nullptr};
+
+  if (m_pages == MemoryResourceTraits::page_type::huge) {
+    ptr = map_huge(length);
+  }
+
+  if (ptr == nullptr) {
+    ptr = map_aligned(length);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_mapped_sizes[ptr] = length;
+  }
+
+  UMPIRE_LOG(Debug, "(bytes=" << bytes << ") returning " << ptr);
+
+  return ptr;
+}
+
+void HugePageMemoryResource::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
+{
+  UMPIRE_LOG(Debug, "(ptr=" << ptr << ")");
+
+  std::size_t length{0};
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    auto iter = m_mapped_sizes.find(ptr);
+    if (iter == m_mapped_sizes.end()) {
+      UMPIRE_ERROR(runtime_error, fmt::format("Pointer {} was not allocated by {}", ptr, getName()));
+    }
+    length = iter->second;
+    m_mapped_sizes.erase(iter);
+  }
+
+  if (::munmap(ptr, length) != 0) {
+    UMPIRE_ERROR(runtime_error, fmt::format("munmap( ptr = {}, bytes = {} ) failed: {}", ptr, length, strerror(errno)));
+  }
+}
+
+void* HugePageMemoryResource::map_huge(std::size_t bytes)
+{
+#if defined(MAP_HUGETLB)
+  int flags{MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB};
+#if defined(MAP_HUGE_SHIFT)
+  int shift{0};
+  while ((std::size_t{1} << shift) < m_page_size) {
+    ++shift;
+  }
+  flags |= shift << MAP_HUGE_SHIFT;
+#endif
+
+  void* ptr{::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, flags, -1, 0)};
+  if (ptr != MAP_FAILED) {
+    return ptr;
+  }
+
+  //
+  // The reserved huge pages may run out and be replenished by the system
+  // administrator at any time, so each allocation tries them again, but the
+  // fall back is only reported once.
+  //
+  if (!m_reported_fallback.exchange(true)) {
+    UMPIRE_LOG(Warning, "mmap with MAP_HUGETLB of " << bytes << " bytes failed: " << strerror(errno)
+                                                     << ", falling back to transparent huge pages");
+  }
+#else
+  UMPIRE_USE_VAR(bytes);
+  if (!m_reported_fallback.exchange(true)) {
+    UMPIRE_LOG(Warning, "MAP_HUGETLB is not available, falling back to transparent huge pages");
+  }
+#endif
+
+  return nullptr;
+}
+
+void* HugePageMemoryResource::map_aligned(std::size_t bytes)
+{
+  const bool align{m_pages != MemoryResourceTraits::page_type::standard};
+  const std::size_t mapped_bytes{align ? bytes + m_page_size : bytes};
+
+  void* base{::mmap(nullptr, mapped_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)};
+  if (base == MAP_FAILED) {
+    if (errno == ENOMEM) {
+      UMPIRE_ERROR(out_of_memory_error, fmt::format("mmap( bytes = {} ) failed: {}", mapped_bytes, strerror(errno)));
+    } else {
+      UMPIRE_ERROR(runtime_error, fmt::format("mmap( bytes = {} ) failed: {}", mapped_bytes, strerror(errno)));
+    }
+  }
+
+  if (!align) {
+    return base;
+  }
+
+  //
+  // The kernel can only back ranges that are aligned to the huge page size
+  // with huge pages, so the extra page mapped above is trimmed from either
+  // end to leave an aligned range.
+  //
+  const std::uintptr_t address{reinterpret_cast<std::uintptr_t>(base)};
+  const std::uintptr_t aligned{(address + m_page_size - 1) & ~(static_cast<std::uintptr_t>(m_page_size) - 1)};
+  const std::size_t head{aligned - address};
+  const std::size_t tail{m_page_size - head};
+
+  if (head != 0) {
+    ::munmap(base, head);
+  }
+  if (tail != 0) {
+    ::munmap(reinterpret_cast<void*>(aligned + bytes), tail);
+  }
+
+  void* ptr{reinterpret_cast<void*>(aligned)};
+
+#if defined(MADV_HUGEPAGE)
+  if (::madvise(ptr, bytes, MADV_HUGEPAGE) != 0) {
+    UMPIRE_LOG(Debug, "madvise( ptr = " << ptr << ", bytes = " << bytes
+                                        << ", MADV_HUGEPAGE ) failed: " << strerror(errno));
+  }
+#endif
+
+  return ptr;
+}
+
+std::size_t HugePageMemoryResource::getPageSize() const noexcept
+{
+  return m_page_size;
+}
+
+bool HugePageMemoryResource::isAccessibleFrom(Platform p) noexcept
+{
+  if (p == Platform::host || p == Platform::omp_target)
+    return true;
+  else
+    return false;
+}
+
+Platform HugePageMemoryResource::getPlatform() noexcept
+{
+  return m_platform;
+}
+
+} // end of namespace resource
+} // end of namespace umpire
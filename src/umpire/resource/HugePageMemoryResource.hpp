@@ -0,0 +1,79 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_HugePageMemoryResource_HPP
+#define UMPIRE_HugePageMemoryResource_HPP
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+#include "umpire/resource/MemoryResource.hpp"
+#include "umpire/util/Platform.hpp"
+
+namespace umpire {
+namespace resource {
+
+/*!
+ * \brief Host memory resource backed by huge pages.
+ *
+ * Memory is mapped with mmap, and the pages backing it are chosen with the
+ * pages trait:
+ *
+ * - page_type::huge maps the memory with MAP_HUGETLB from the huge pages
+ *   reserved by the system administrator (see /proc/sys/vm/nr_hugepages). The
+ *   size of the pages is the page_size trait, or the default huge page size
+ *   of the system when it is 0. When no huge pages are available, the
+ *   resource logs a warning and falls back to transparent huge pages.
+ * - page_type::transparent_huge maps memory aligned to the huge page size and
+ *   asks the kernel to back it with huge pages with madvise(MADV_HUGEPAGE).
+ *   This does not need pages to be reserved, but the kernel only uses huge
+ *   pages when it can find them.
+ * - page_type::standard maps memory backed by normal pages.
+ *
+ * Allocations are rounded up to a multiple of the page size, so this resource
+ * is best used to back a pool with large blocks.
+ */
+class HugePageMemoryResource : public MemoryResource {
+ public:
+  HugePageMemoryResource(Platform platform, const std::string& name, int id, MemoryResourceTraits traits);
+
+  /*!
+   * \brief Unmap any memory that has not been deallocated.
+   */
+  ~HugePageMemoryResource();
+
+  void* allocate(std::size_t bytes);
+  void deallocate(void* ptr, std::size_t size);
+
+  bool isAccessibleFrom(Platform p) noexcept;
+
+  Platform getPlatform() noexcept;
+
+  /*!
+   * \brief Get the size of the pages backing allocations of this resource.
+   */
+  std::size_t getPageSize() const noexcept;
+
+ protected:
+  Platform m_platform;
+
+ private:
+  void* map_huge(std::size_t bytes);
+  void* map_aligned(std::size_t bytes);
+
+  MemoryResourceTraits::page_type m_pages;
+  std::size_t m_page_size;
+  std::atomic<bool> m_reported_fallback{false};
+
+  std::mutex m_mutex;
+  std::unordered_map<void*, std::size_t> m_mapped_sizes;
+};
+
+} // end of namespace resource
+} // end of namespace umpire
+
+#endif // UMPIRE_HugePageMemoryResource_HPP
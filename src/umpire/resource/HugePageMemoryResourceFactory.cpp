@@ -0,0 +1,55 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/resource/HugePageMemoryResourceFactory.hpp"
+
+#include "umpire/resource/HugePageMemoryResource.hpp"
+#include "umpire/util/Macros.hpp"
+#include "umpire/util/detect_vendor.hpp"
+#include "umpire/util/make_unique.hpp"
+
+namespace umpire {
+namespace resource {
+
+bool HugePageMemoryResourceFactory::isValidMemoryResourceFor(const std::string& name) noexcept
+{
+  if (name.find("HUGEPAGE") != std::string::npos) {
+    return true;
+  } else {
+    return false;
+  }
+}
+
+std::unique_ptr<resource::MemoryResource> HugePageMemoryResourceFactory::create(const std::string& name, int id)
+{
+  return create(name, id, getDefaultTraits());
+}
+
+std::unique_ptr<resource::MemoryResource> HugePageMemoryResourceFactory::create(const std::string& name, int id,
+                                                                                MemoryResourceTraits traits)
+{
+  return util::make_unique<HugePageMemoryResource>(Platform::host, name, id, traits);
+}
+
+MemoryResourceTraits HugePageMemoryResourceFactory::getDefaultTraits()
+{
+  MemoryResourceTraits traits;
+
+  traits.unified = false;
+  traits.size = 0;
+
+  traits.vendor = cpu_vendor_type();
+  traits.kind = MemoryResourceTraits::memory_type::unknown;
+  traits.used_for = MemoryResourceTraits::optimized_for::bandwidth;
+  traits.resource = MemoryResourceTraits::resource_type::host;
+
+  traits.pages = MemoryResourceTraits::page_type::transparent_huge;
+
+  return traits;
+}
+
+} // end of namespace resource
+} // end of namespace umpire
@@ -23,6 +23,10 @@
 #include "umpire/resource/FileMemoryResourceFactory.hpp"
 #endif
 
+#if defined(UMPIRE_ENABLE_HUGEPAGE_RESOURCE)
+#include "umpire/resource/HugePageMemoryResourceFactory.hpp"
+#endif
+
 #if defined(UMPIRE_ENABLE_NUMA)
 #include "umpire/strategy/NumaPolicy.hpp"
 #endif
@@ -102,6 +106,11 @@ MemoryResourceRegistry::MemoryResourceRegistry() : m_allocator_factories()
   m_resource_names.push_back("FILE");
 #endif
 
+#if defined(UMPIRE_ENABLE_HUGEPAGE_RESOURCE)
+  registerMemoryResource(util::make_unique<resource::HugePageMemoryResourceFactory>());
+  m_resource_names.push_back("HUGEPAGE");
+#endif
+
 #if defined(UMPIRE_ENABLE_CUDA)
   {
     int device_count{0};
@@ -32,7 +32,7 @@ struct MemoryResourceTypeHash {
   }
 };
 
-enum MemoryResourceType { Host, Device, Unified, Pinned, Constant, File, NoOp, Shared, Unknown };
+enum MemoryResourceType { Host, Device, Unified, Pinned, Constant, File, NoOp, Shared, HugePage, Unknown };
 
 inline std::string resource_to_string(MemoryResourceType type)
 {
@@ -53,6 +53,8 @@ inline std::string resource_to_string(MemoryResourceType type)
       return "NO_OP";
     case Shared:
       return "SHARED";
+    case HugePage:
+      return "HUGEPAGE";
     default:
       UMPIRE_ERROR(runtime_error, fmt::format("Unknown resource type: {}", static_cast<int>(type)));
   }
@@ -87,6 +89,8 @@ inline MemoryResourceType string_to_resource(const std::string& resource)
     return MemoryResourceType::NoOp;
   else if (resource == "SHARED")
     return MemoryResourceType::Shared;
+  else if (resource == "HUGEPAGE")
+    return MemoryResourceType::HugePage;
   else {
     UMPIRE_ERROR(runtime_error, fmt::format("Unknown resource name \"{}\"", resource));
   }
@@ -19,14 +19,13 @@ AllocationStrategy::AllocationStrategy(const std::string& name, int id, Allocati
 
 void* AllocationStrategy::allocate_internal(std::size_t bytes)
 {
-  m_current_size += bytes;
-  m_allocation_count++;
+  void* ret{allocate(bytes)};
 
-  if (m_current_size > m_high_watermark) {
-    m_high_watermark = m_current_size;
-  }
+  // Only count allocations that succeed, so that callers such as
+  // DeferredFreePool may retry after an out_of_memory_error
+  m_counters.registerAllocation(bytes);
 
-  return allocate(bytes);
+  return ret;
 }
 
 void* AllocationStrategy::allocate_named(const std::string& UMPIRE_UNUSED_ARG(name), std::size_t bytes)
@@ -34,11 +33,69 @@ void* AllocationStrategy::allocate_named(const std::string& UMPIRE_UNUSED_ARG(na
   return allocate(bytes);
 }
 
+void AllocationStrategy::allocate_batch(const std::size_t* sizes, std::size_t count, void** ptrs)
+{
+  std::size_t i{0};
+
+  try {
+    for (; i < count; ++i) {
+      ptrs[i] = allocate(sizes[i]);
+    }
+  } catch (...) {
+    while (i > 0) {
+      --i;
+      deallocate(ptrs[i], sizes[i]);
+    }
+    throw;
+  }
+}
+
+void AllocationStrategy::deallocate_batch(void* const* ptrs, const std::size_t* sizes, std::size_t count)
+{
+  for (std::size_t i = 0; i < count; ++i) {
+    deallocate(ptrs[i], sizes[i]);
+  }
+}
+
+void AllocationStrategy::allocate_batch_internal(const std::size_t* sizes, std::size_t count, void** ptrs)
+{
+  allocate_batch(sizes, count, ptrs);
+
+  std::size_t bytes{0};
+  for (std::size_t i = 0; i < count; ++i) {
+    bytes += sizes[i];
+  }
+  m_counters.registerAllocations(count, bytes);
+}
+
+void AllocationStrategy::deallocate_batch_internal(void* const* ptrs, const std::size_t* sizes, std::size_t count)
+{
+  std::size_t bytes{0};
+  for (std::size_t i = 0; i < count; ++i) {
+    bytes += sizes[i];
+  }
+  m_counters.deregisterAllocations(count, bytes);
+
+  deallocate_batch(ptrs, sizes, count);
+}
+
 void AllocationStrategy::deallocate_internal(void* ptr, std::size_t size)
 {
-  m_current_size -= size;
-  m_allocation_count--;
+  m_counters.deregisterAllocation(size);
+
+  deallocate(ptr, size);
+}
+
+void AllocationStrategy::deallocate_internal(void* ptr, std::size_t size, const camp::resources::Event& event)
+{
+  m_counters.deregisterAllocation(size);
+
+  deallocate_after(ptr, size, event);
+}
 
+void AllocationStrategy::deallocate_after(void* ptr, std::size_t size, const camp::resources::Event& event)
+{
+  event.wait();
   deallocate(ptr, size);
 }
 
@@ -64,17 +121,22 @@ int AllocationStrategy::getId() noexcept
 
 std::size_t AllocationStrategy::getCurrentSize() const noexcept
 {
-  return m_current_size;
+  return m_counters.getCurrentSize();
 }
 
 std::size_t AllocationStrategy::getHighWatermark() const noexcept
 {
-  return m_high_watermark;
+  return m_counters.getHighWatermark();
 }
 
 std::size_t AllocationStrategy::getAllocationCount() const noexcept
 {
-  return m_allocation_count;
+  return m_counters.getAllocationCount();
+}
+
+util::AllocationCounters::Snapshot AllocationStrategy::getStatistics() const noexcept
+{
+  return m_counters.snapshot();
 }
 
 std::size_t AllocationStrategy::getActualSize() const noexcept
@@ -82,6 +144,12 @@ std::size_t AllocationStrategy::getActualSize() const noexcept
   return getCurrentSize();
 }
 
+bool AllocationStrategy::try_resize(void* UMPIRE_UNUSED_ARG(ptr), std::size_t UMPIRE_UNUSED_ARG(old_size),
+                                    std::size_t UMPIRE_UNUSED_ARG(new_size))
+{
+  return false;
+}
+
 MemoryResourceTraits AllocationStrategy::getTraits() const noexcept
 {
   UMPIRE_LOG(Error, "AllocationStrategy::getTraits() not implemented");
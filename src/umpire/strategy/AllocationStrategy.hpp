@@ -12,6 +12,8 @@
 #include <ostream>
 #include <string>
 
+#include "camp/resource.hpp"
+#include "umpire/util/AllocationCounters.hpp"
 #include "umpire/util/MemoryResourceTraits.hpp"
 #include "umpire/util/Platform.hpp"
 
@@ -49,6 +51,12 @@ class AllocationStrategy {
 
   void deallocate_internal(void* ptr, std::size_t size = 0);
 
+  void deallocate_internal(void* ptr, std::size_t size, const camp::resources::Event& event);
+
+  void allocate_batch_internal(const std::size_t* sizes, std::size_t count, void** ptrs);
+
+  void deallocate_batch_internal(void* const* ptrs, const std::size_t* sizes, std::size_t count);
+
   /*!
    * \brief Release any and all unused memory held by this AllocationStrategy
    */
@@ -89,6 +97,32 @@ class AllocationStrategy {
    */
   virtual std::size_t getAllocationCount() const noexcept;
 
+  /*!
+   * \brief Get the current size, high watermark and allocation count that
+   * this AllocationStrategy has recorded.
+   *
+   * This only reads atomic counters, so it is cheap and may be called from a
+   * thread that is monitoring allocators while other threads allocate.
+   *
+   * \return A copy of the recorded statistics.
+   */
+  util::AllocationCounters::Snapshot getStatistics() const noexcept;
+
+  /*!
+   * \brief Try to change the size of an allocation without moving it.
+   *
+   * ResourceManager::reallocate calls this before falling back to allocating,
+   * copying and deallocating. The default implementation never resizes.
+   *
+   * \param ptr Pointer to an allocation made by this AllocationStrategy.
+   * \param old_size Size of the allocation.
+   * \param new_size Requested size of the allocation.
+   *
+   * \return True if the allocation at ptr now has new_size bytes, false if it
+   *         is unchanged.
+   */
+  virtual bool try_resize(void* ptr, std::size_t old_size, std::size_t new_size);
+
   /*!
    * \brief Get the platform associated with this AllocationStrategy.
    *
@@ -130,13 +164,38 @@ class AllocationStrategy {
 
   bool isTracked() const noexcept;
 
-  std::size_t m_current_size{0};
-  std::size_t m_high_watermark{0};
-  std::size_t m_allocation_count{0};
+  util::AllocationCounters m_counters;
 
  protected:
   void setTracking(bool) noexcept;
 
+  /*!
+   * \brief Allocate count buffers of sizes[i] bytes into ptrs[i].
+   *
+   * The default implementation calls allocate for each buffer. If one of the
+   * allocations fails, the buffers already allocated are deallocated before
+   * the exception is rethrown.
+   */
+  virtual void allocate_batch(const std::size_t* sizes, std::size_t count, void** ptrs);
+
+  /*!
+   * \brief Free count buffers of sizes[i] bytes at ptrs[i].
+   *
+   * The default implementation calls deallocate for each buffer.
+   */
+  virtual void deallocate_batch(void* const* ptrs, const std::size_t* sizes, std::size_t count);
+
+  /*!
+   * \brief Free the memory at ptr once event has completed.
+   *
+   * The memory must not be reused before work that was queued on the
+   * resource that produced event is finished. The default implementation
+   * waits for event and then calls deallocate; strategies such as
+   * DeferredFreePool hold on to ptr instead, so that the caller does not
+   * wait.
+   */
+  virtual void deallocate_after(void* ptr, std::size_t size, const camp::resources::Event& event);
+
   std::string m_name;
   std::string m_strategy_name;
   int m_id;
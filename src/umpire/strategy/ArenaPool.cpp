@@ -0,0 +1,303 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/strategy/ArenaPool.hpp"
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+
+#include "umpire/util/Macros.hpp"
+#include "umpire/util/error.hpp"
+
+namespace umpire {
+namespace strategy {
+
+namespace {
+
+std::size_t page_size() noexcept
+{
+#if defined(_WIN32)
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return static_cast<std::size_t>(info.dwPageSize);
+#else
+  return static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+#endif
+}
+
+std::size_t round_up(std::size_t bytes, std::size_t multiple) noexcept
+{
+  return ((bytes + multiple - 1) / multiple) * multiple;
+}
+
+void* reserve_range(std::size_t bytes) noexcept
+{
+#if defined(_WIN32)
+  return VirtualAlloc(nullptr, bytes, MEM_RESERVE, PAGE_NOACCESS);
+#else
+  int flags{MAP_PRIVATE | MAP_ANONYMOUS};
+#if defined(MAP_NORESERVE)
+  flags |= MAP_NORESERVE;
+#endif
+  void* ptr{::mmap(nullptr, bytes, PROT_NONE, flags, -1, 0)};
+  return ptr == MAP_FAILED ? nullptr : ptr;
+#endif
+}
+
+bool commit_range(void* ptr, std::size_t bytes) noexcept
+{
+#if defined(_WIN32)
+  return VirtualAlloc(ptr, bytes, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+  return ::mprotect(ptr, bytes, PROT_READ | PROT_WRITE) == 0;
+#endif
+}
+
+// Give the pages back to the operating system, but leave them accessible
+void discard_range(void* ptr, std::size_t bytes) noexcept
+{
+#if defined(_WIN32)
+  VirtualAlloc(ptr, bytes, MEM_RESET, PAGE_READWRITE);
+#else
+  ::madvise(ptr, bytes, MADV_DONTNEED);
+#endif
+}
+
+void decommit_range(void* ptr, std::size_t bytes) noexcept
+{
+#if defined(_WIN32)
+  VirtualFree(ptr, bytes, MEM_DECOMMIT);
+#else
+  ::madvise(ptr, bytes, MADV_DONTNEED);
+  ::mprotect(ptr, bytes, PROT_NONE);
+#endif
+}
+
+void unreserve_range(void* ptr, std::size_t bytes) noexcept
+{
+#if defined(_WIN32)
+  UMPIRE_USE_VAR(bytes);
+  VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+  ::munmap(ptr, bytes);
+#endif
+}
+
+} // end of anonymous namespace
+
+ArenaPool::ArenaPool(const std::string& name, int id, Allocator allocator, const std::size_t reserved_size,
+                     const std::size_t commit_size, const std::size_t alignment)
+    : AllocationStrategy{name, id, allocator.getAllocationStrategy(), "ArenaPool"},
+      m_reserved_size{round_up(reserved_size, round_up(std::max<std::size_t>(commit_size, 1), page_size()))},
+      m_commit_size{round_up(std::max<std::size_t>(commit_size, 1), page_size())},
+      m_alignment{alignment},
+      m_allocator{allocator.getAllocationStrategy()}
+{
+  if (alignment == 0 || (alignment & (alignment - 1)) != 0 || alignment > page_size()) {
+    UMPIRE_ERROR(runtime_error, fmt::format("Invalid alignment {}, it must be a power of 2 no larger than the page "
+                                            "size {}",
+                                            alignment, page_size()));
+  }
+
+  if (m_allocator->getTraits().resource != MemoryResourceTraits::resource_type::host) {
+    UMPIRE_ERROR(runtime_error,
+                 fmt::format("ArenaPool \"{}\" needs a host allocator, \"{}\" is not one", name, allocator.getName()));
+  }
+
+  m_base = static_cast<char*>(reserve_range(m_reserved_size));
+  if (m_base == nullptr) {
+    UMPIRE_ERROR(out_of_memory_error, fmt::format("Could not reserve {} bytes of address space", m_reserved_size));
+  }
+
+  UMPIRE_LOG(Debug, " ( "
+                        << "name=\"" << name << "\""
+                        << ", id=" << id << ", allocator=\"" << allocator.getName() << "\""
+                        << ", reserved_size=" << m_reserved_size << ", commit_size=" << m_commit_size
+                        << ", alignment=" << m_alignment << " )");
+}
+
+ArenaPool::~ArenaPool()
+{
+  UMPIRE_LOG(Debug, "Releasing reserved range " << static_cast<void*>(m_base));
+  unreserve_range(m_base, m_reserved_size);
+}
+
+void* ArenaPool::allocate(std::size_t bytes)
+{
+  UMPIRE_LOG(Debug, "(bytes=" << bytes << ")");
+
+  const std::size_t size{round_up(std::max<std::size_t>(bytes, 1), m_alignment)};
+  std::size_t offset{0};
+
+  auto best = m_free_sizes.lower_bound(size);
+  if (best != m_free_sizes.end()) {
+    offset = best->second;
+
+    auto range = m_free_ranges.find(offset);
+    const std::size_t remaining{range->second.size - size};
+    erase_free(range);
+
+    if (remaining != 0) {
+      insert_free(offset + size, remaining);
+    }
+  } else {
+    if (size > m_reserved_size - m_top) {
+      UMPIRE_ERROR(out_of_memory_error, fmt::format("ArenaPool \"{}\" cannot grow by {} bytes, {} of its {} reserved "
+                                                    "bytes are in use",
+                                                    getName(), size, m_top, m_reserved_size));
+    }
+
+    commit(m_top + size);
+    offset = m_top;
+    m_top += size;
+  }
+
+  void* ptr{m_base + offset};
+  m_allocations.emplace(ptr, size);
+
+  return ptr;
+}
+
+void ArenaPool::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
+{
+  UMPIRE_LOG(Debug, "(ptr=" << ptr << ")");
+
+  auto allocation = m_allocations.find(ptr);
+  if (allocation == m_allocations.end()) {
+    UMPIRE_ERROR(runtime_error, fmt::format("Pointer {} was not allocated by ArenaPool \"{}\"", ptr, getName()));
+  }
+
+  std::size_t offset{static_cast<std::size_t>(static_cast<char*>(ptr) - m_base)};
+  std::size_t size{allocation->second};
+  m_allocations.erase(allocation);
+
+  auto next = m_free_ranges.find(offset + size);
+  if (next != m_free_ranges.end()) {
+    size += next->second.size;
+    erase_free(next);
+  }
+
+  auto after = m_free_ranges.lower_bound(offset);
+  if (after != m_free_ranges.begin()) {
+    auto prev = std::prev(after);
+    if (prev->first + prev->second.size == offset) {
+      offset = prev->first;
+      size += prev->second.size;
+      erase_free(prev);
+    }
+  }
+
+  if (offset + size == m_top) {
+    m_top = offset;
+  } else {
+    insert_free(offset, size);
+  }
+}
+
+void ArenaPool::release()
+{
+  UMPIRE_LOG(Debug, "() committed=" << m_committed << ", top=" << m_top);
+
+  const std::size_t pages{page_size()};
+  const std::size_t keep{round_up(m_top, m_commit_size)};
+
+  if (keep < m_committed) {
+    decommit_range(m_base + keep, m_committed - keep);
+    m_committed = keep;
+  }
+
+  const std::size_t top_page{round_up(m_top, pages)};
+  if (top_page < m_committed) {
+    discard_range(m_base + top_page, m_committed - top_page);
+  }
+
+  for (const auto& range : m_free_ranges) {
+    const std::size_t begin{round_up(range.first, pages)};
+    const std::size_t end{((range.first + range.second.size) / pages) * pages};
+
+    if (begin < end) {
+      discard_range(m_base + begin, end - begin);
+    }
+  }
+}
+
+void ArenaPool::commit(std::size_t end)
+{
+  if (end <= m_committed) {
+    return;
+  }
+
+  const std::size_t new_committed{std::min(round_up(end, m_commit_size), m_reserved_size)};
+
+  UMPIRE_LOG(Debug, "Committing " << (new_committed - m_committed) << " bytes");
+
+  if (!commit_range(m_base + m_committed, new_committed - m_committed)) {
+    UMPIRE_ERROR(out_of_memory_error, fmt::format("ArenaPool \"{}\" could not commit {} bytes", getName(),
+                                                  new_committed - m_committed));
+  }
+
+  m_committed = new_committed;
+}
+
+void ArenaPool::insert_free(std::size_t offset, std::size_t size)
+{
+  auto size_it = m_free_sizes.insert(std::make_pair(size, offset));
+  m_free_ranges.emplace(offset, FreeRange{size, size_it});
+}
+
+void ArenaPool::erase_free(RangeMap::iterator it)
+{
+  m_free_sizes.erase(it->second.size_it);
+  m_free_ranges.erase(it);
+}
+
+std::size_t ArenaPool::getActualSize() const noexcept
+{
+  return m_committed;
+}
+
+std::size_t ArenaPool::getReservedSize() const noexcept
+{
+  return m_reserved_size;
+}
+
+std::size_t ArenaPool::getReleasableSize() const noexcept
+{
+  const std::size_t keep{round_up(m_top, m_commit_size)};
+  return keep < m_committed ? m_committed - keep : 0;
+}
+
+bool ArenaPool::owns(const void* ptr) const noexcept
+{
+  const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+  const auto base = reinterpret_cast<std::uintptr_t>(m_base);
+
+  return address >= base && address - base < m_reserved_size;
+}
+
+Platform ArenaPool::getPlatform() noexcept
+{
+  return m_allocator->getPlatform();
+}
+
+MemoryResourceTraits ArenaPool::getTraits() const noexcept
+{
+  return m_allocator->getTraits();
+}
+
+} // end of namespace strategy
+} // end namespace umpire
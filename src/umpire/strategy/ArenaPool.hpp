@@ -0,0 +1,136 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_ArenaPool_HPP
+#define UMPIRE_ArenaPool_HPP
+
+#include <cstddef>
+#include <map>
+#include <unordered_map>
+
+#include "umpire/Allocator.hpp"
+#include "umpire/strategy/AllocationStrategy.hpp"
+
+namespace umpire {
+namespace strategy {
+
+/*!
+ * \brief A host pool that is one contiguous range of virtual memory, grown
+ * in place.
+ *
+ * The pool reserves reserved_size bytes of address space without backing
+ * them with memory, and commits the start of the range commit_size bytes at
+ * a time as allocations need it. Allocations are taken from the best fitting
+ * free range, or from the top of the used part of the arena. Freed ranges
+ * are merged with their neighbours straight away, and a free range at the
+ * top of the arena is given back to it, so the pool never has to coalesce
+ * blocks.
+ *
+ * release() decommits the committed memory above the top of the arena, and
+ * the pages inside free ranges, without giving up the reservation.
+ *
+ * The memory is mapped directly from the operating system, so the pool
+ * requires a host Allocator, which is only used for its traits. The pool is
+ * not thread safe.
+ */
+class ArenaPool : public AllocationStrategy {
+ public:
+  static constexpr std::size_t s_default_reserved_size{std::size_t{64} * 1024 * 1024 * 1024};
+  static constexpr std::size_t s_default_commit_size{2 * 1024 * 1024};
+  static constexpr std::size_t s_default_alignment{16};
+
+  /*!
+   * \brief Construct a new ArenaPool.
+   *
+   * \param name Name of this instance of the ArenaPool
+   * \param id Unique identifier for this instance
+   * \param allocator Host allocator whose traits the pool reports
+   * \param reserved_size Bytes of address space to reserve, the largest the
+   * pool can grow to
+   * \param commit_size Bytes to commit at a time, a multiple of the page size
+   * \param alignment Number of bytes with which to align allocation sizes
+   * (power-of-2, at most the page size)
+   */
+  ArenaPool(const std::string& name, int id, Allocator allocator,
+            const std::size_t reserved_size = s_default_reserved_size,
+            const std::size_t commit_size = s_default_commit_size,
+            const std::size_t alignment = s_default_alignment);
+
+  ~ArenaPool();
+
+  ArenaPool(const ArenaPool&) = delete;
+
+  void* allocate(std::size_t bytes) override;
+  void deallocate(void* ptr, std::size_t size) override;
+  void release() override;
+
+  /*!
+   * \brief Get the number of bytes committed, which is the actual size of
+   * the pool.
+   */
+  std::size_t getActualSize() const noexcept override;
+
+  /*!
+   * \brief Get the number of bytes of address space reserved.
+   */
+  std::size_t getReservedSize() const noexcept;
+
+  /*!
+   * \brief Get the number of committed bytes above the top of the arena,
+   * which release() decommits.
+   */
+  std::size_t getReleasableSize() const noexcept;
+
+  /*!
+   * \brief Return whether ptr lies in the address range of this pool.
+   *
+   * This only compares ptr with the bounds of the range, so it is cheap
+   * enough to call on every deallocation.
+   */
+  bool owns(const void* ptr) const noexcept;
+
+  Platform getPlatform() noexcept override;
+
+  MemoryResourceTraits getTraits() const noexcept override;
+
+ private:
+  // Make the arena cover at least end bytes
+  void commit(std::size_t end);
+
+  using SizeMap = std::multimap<std::size_t, std::size_t>;
+
+  struct FreeRange {
+    std::size_t size;
+    SizeMap::iterator size_it;
+  };
+
+  using RangeMap = std::map<std::size_t, FreeRange>;
+
+  // Add a free range that is below the top of the arena
+  void insert_free(std::size_t offset, std::size_t size);
+  void erase_free(RangeMap::iterator it);
+
+  const std::size_t m_reserved_size;
+  const std::size_t m_commit_size;
+  const std::size_t m_alignment;
+
+  char* m_base{nullptr};
+  std::size_t m_committed{0};
+  std::size_t m_top{0};
+
+  // Free ranges below the top of the arena, by offset and by size
+  RangeMap m_free_ranges{};
+  SizeMap m_free_sizes{};
+
+  std::unordered_map<void*, std::size_t> m_allocations{};
+
+  AllocationStrategy* m_allocator;
+};
+
+} // end of namespace strategy
+} // end namespace umpire
+
+#endif // UMPIRE_ArenaPool_HPP
@@ -0,0 +1,230 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_CoalesceHeuristics_HPP
+#define UMPIRE_CoalesceHeuristics_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include "umpire/Umpire.hpp"
+#include "umpire/strategy/PoolCoalesceHeuristic.hpp"
+#include "umpire/util/Macros.hpp"
+#include "umpire/util/error.hpp"
+
+namespace umpire {
+namespace strategy {
+
+/*!
+ * \brief Coalesce heuristics that keep state between deallocations.
+ *
+ * The percent_releasable and blocks_releasable heuristics of each pool only
+ * look at the pool as it is now, so a pool that is emptied at the end of
+ * every phase of an application coalesces at the end of each phase and grows
+ * again at the start of the next one. The heuristics here add hysteresis,
+ * time, the growth of the pool and memory pressure to that decision. They
+ * work with any pool that provides getActualSize, getCurrentSize and
+ * getReleasableSize, such as QuickPool and DynamicPoolList.
+ *
+ * The heuristics are not thread safe; a pool only calls its heuristic while
+ * it is allocating or deallocating, so this matters only when the same
+ * heuristic object is given to more than one pool.
+ */
+namespace heuristics {
+
+using clock = std::chrono::steady_clock;
+
+/*!
+ * \brief Coalesce when at least high_percentage of the pool is releasable,
+ * and not again until less than low_percentage of it has been releasable.
+ *
+ * Between the two thresholds the heuristic remembers whether it last saw the
+ * pool nearly empty or in use, so small changes around a single threshold do
+ * not make the pool coalesce over and over.
+ *
+ * \param high_percentage Percentage of releasable bytes that triggers a
+ * coalesce, between 1 and 100
+ * \param low_percentage Percentage of releasable bytes that the pool must
+ * drop below before the next coalesce, less than high_percentage
+ */
+template <typename Pool>
+PoolCoalesceHeuristic<Pool> percent_releasable_hysteresis(int high_percentage, int low_percentage)
+{
+  if (high_percentage <= 0 || high_percentage > 100 || low_percentage < 0 || low_percentage >= high_percentage) {
+    UMPIRE_ERROR(runtime_error, fmt::format("Invalid percentages: high={}, low={}, they must satisfy 0 <= low < "
+                                            "high <= 100",
+                                            high_percentage, low_percentage));
+  }
+
+  auto armed = std::make_shared<bool>(true);
+
+  return [=](const Pool& pool) -> std::size_t {
+    const std::size_t actual{pool.getActualSize()};
+    const std::size_t releasable{pool.getReleasableSize()};
+
+    if (*armed) {
+      if (actual != 0 && releasable * 100 >= actual * static_cast<std::size_t>(high_percentage)) {
+        *armed = false;
+        return actual;
+      }
+    } else if (releasable * 100 < actual * static_cast<std::size_t>(low_percentage)) {
+      *armed = true;
+    }
+
+    return 0;
+  };
+}
+
+/*!
+ * \brief Let heuristic coalesce the pool at most once per interval.
+ *
+ * \param heuristic Heuristic that decides whether and how to coalesce
+ * \param interval Minimum time between two coalesces
+ */
+template <typename Pool>
+PoolCoalesceHeuristic<Pool> min_interval(PoolCoalesceHeuristic<Pool> heuristic, clock::duration interval)
+{
+  auto last = std::make_shared<clock::time_point>(clock::time_point::min());
+
+  return [=](const Pool& pool) -> std::size_t {
+    const auto now = clock::now();
+
+    if (*last != clock::time_point::min() && now - *last < interval) {
+      return 0;
+    }
+
+    const std::size_t suggested_size{heuristic(pool)};
+    if (suggested_size != 0) {
+      *last = now;
+    }
+
+    return suggested_size;
+  };
+}
+
+/*!
+ * \brief Let heuristic coalesce the pool only once it has not grown for
+ * period.
+ *
+ * A pool that has grown recently is in the middle of allocating for a phase
+ * of the application, and is likely to need its blocks again soon. Holding
+ * back the coalesce until the pool has stopped growing keeps the pool from
+ * coalescing at the end of one phase only to grow again at the start of the
+ * next.
+ *
+ * The actual size of the pool is sampled each time the heuristic is called,
+ * which is on every deallocation, so growth is noticed at the next
+ * deallocation after it.
+ *
+ * \param heuristic Heuristic that decides whether and how to coalesce
+ * \param period How long the pool must not have grown
+ */
+template <typename Pool>
+PoolCoalesceHeuristic<Pool> when_not_growing(PoolCoalesceHeuristic<Pool> heuristic, clock::duration period)
+{
+  struct State {
+    std::size_t actual_size{0};
+    clock::time_point grown{clock::now()};
+  };
+
+  auto state = std::make_shared<State>();
+
+  return [=](const Pool& pool) -> std::size_t {
+    const auto now = clock::now();
+    const std::size_t actual{pool.getActualSize()};
+
+    if (actual > state->actual_size) {
+      state->grown = now;
+    }
+    state->actual_size = actual;
+
+    if (now - state->grown < period) {
+      return 0;
+    }
+
+    return heuristic(pool);
+  };
+}
+
+/*!
+ * \brief Release the free blocks of the pool while memory usage is over
+ * budget.
+ *
+ * usage is called at most once per sample_interval, and the last value is
+ * reused in between, so that a deallocation does not read /proc each time.
+ * When usage is over budget and the pool has releasable memory, the
+ * heuristic suggests coalescing to the current size of the pool, or
+ * release_only_coalesce_size when nothing is in use. Either way the pool
+ * releases its free blocks, even a single one, and allocates nothing in their
+ * place.
+ *
+ * \param budget Bytes of memory that usage may report before the pool gives
+ * back its free blocks
+ * \param sample_interval Minimum time between calls to usage
+ * \param usage Function that measures memory usage, by default the resident
+ * size of the process. Device pools may pass a function that calls
+ * get_device_memory_usage.
+ */
+template <typename Pool>
+PoolCoalesceHeuristic<Pool> memory_budget(std::size_t budget,
+                                          clock::duration sample_interval = std::chrono::milliseconds{10},
+                                          std::function<std::size_t()> usage = &umpire::get_process_memory_usage)
+{
+  struct State {
+    clock::time_point sampled{clock::time_point::min()};
+    std::size_t usage{0};
+  };
+
+  auto state = std::make_shared<State>();
+
+  return [=](const Pool& pool) -> std::size_t {
+    if (pool.getReleasableSize() == 0) {
+      return 0;
+    }
+
+    const auto now = clock::now();
+    if (state->sampled == clock::time_point::min() || now - state->sampled >= sample_interval) {
+      state->usage = usage();
+      state->sampled = now;
+    }
+
+    if (state->usage <= budget) {
+      return 0;
+    }
+
+    UMPIRE_LOG(Debug, "memory usage " << state->usage << " is over budget " << budget);
+
+    // The memory released now is not reflected in the usage until the next
+    // sample, so the pool should not be asked to release it twice
+    state->usage -= std::min(state->usage, pool.getReleasableSize());
+
+    return std::max(pool.getCurrentSize(), release_only_coalesce_size);
+  };
+}
+
+/*!
+ * \brief Coalesce when either heuristic would, with the size the first one
+ * that fires suggests.
+ *
+ * second is not called when first fires.
+ */
+template <typename Pool>
+PoolCoalesceHeuristic<Pool> any_of(PoolCoalesceHeuristic<Pool> first, PoolCoalesceHeuristic<Pool> second)
+{
+  return [=](const Pool& pool) -> std::size_t {
+    const std::size_t suggested_size{first(pool)};
+    return suggested_size != 0 ? suggested_size : second(pool);
+  };
+}
+
+} // end of namespace heuristics
+} // end of namespace strategy
+} // end namespace umpire
+
+#endif // UMPIRE_CoalesceHeuristics_HPP
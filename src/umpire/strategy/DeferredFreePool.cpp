@@ -0,0 +1,148 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/strategy/DeferredFreePool.hpp"
+
+#include "umpire/util/Macros.hpp"
+#include "umpire/util/error.hpp"
+
+namespace umpire {
+namespace strategy {
+
+DeferredFreePool::DeferredFreePool(const std::string& name, int id, Allocator allocator,
+                                   const std::size_t first_minimum_pool_allocation_size,
+                                   const std::size_t next_minimum_pool_allocation_size, const std::size_t alignment,
+                                   PoolCoalesceHeuristic<QuickPool> should_coalesce) noexcept
+    : AllocationStrategy{name, id, allocator.getAllocationStrategy(), "DeferredFreePool"},
+      m_quick_pool{"internal_quick_pool",
+                   -1,
+                   allocator,
+                   first_minimum_pool_allocation_size,
+                   next_minimum_pool_allocation_size,
+                   alignment,
+                   should_coalesce},
+      m_allocator{allocator.getAllocationStrategy()}
+{
+}
+
+DeferredFreePool::~DeferredFreePool()
+{
+  //
+  // The QuickPool frees its blocks when it is destroyed, so any work still
+  // using pending memory has to finish first.
+  //
+  try {
+    synchronize();
+  } catch (...) {
+    UMPIRE_LOG(Error, "Failed to wait for pending deallocations");
+  }
+}
+
+void* DeferredFreePool::allocate(std::size_t bytes)
+{
+  UMPIRE_LOG(Debug, "(bytes=" << bytes << ")");
+
+  reclaim();
+
+  try {
+    return m_quick_pool.allocate_internal(bytes);
+  } catch (umpire::out_of_memory_error&) {
+    if (m_pending.empty()) {
+      throw;
+    }
+  }
+
+  UMPIRE_LOG(Debug, "Waiting for " << m_pending.size() << " pending deallocations");
+
+  synchronize();
+  return m_quick_pool.allocate_internal(bytes);
+}
+
+void DeferredFreePool::deallocate(void* ptr, std::size_t size)
+{
+  UMPIRE_LOG(Debug, "(ptr=" << ptr << ", size=" << size << ")");
+
+  m_quick_pool.deallocate_internal(ptr, size);
+}
+
+void DeferredFreePool::deallocate_after(void* ptr, std::size_t size, const camp::resources::Event& event)
+{
+  UMPIRE_LOG(Debug, "(ptr=" << ptr << ", size=" << size << ")");
+
+  if (event.check()) {
+    m_quick_pool.deallocate_internal(ptr, size);
+  } else {
+    m_pending.push_back(PendingFree{ptr, size, event});
+    m_pending_bytes += size;
+  }
+}
+
+void DeferredFreePool::release()
+{
+  UMPIRE_LOG(Debug, "()");
+
+  synchronize();
+  m_quick_pool.release();
+}
+
+void DeferredFreePool::reclaim()
+{
+  //
+  // Events from different resources may complete in any order, so every
+  // pending deallocation is checked rather than stopping at the first one
+  // that is still in flight.
+  //
+  auto last = m_pending.begin();
+  for (auto& pending : m_pending) {
+    if (pending.event.check()) {
+      m_quick_pool.deallocate_internal(pending.ptr, pending.size);
+      m_pending_bytes -= pending.size;
+    } else {
+      *last++ = std::move(pending);
+    }
+  }
+
+  m_pending.erase(last, m_pending.end());
+}
+
+void DeferredFreePool::synchronize()
+{
+  while (!m_pending.empty()) {
+    auto& pending = m_pending.front();
+    pending.event.wait();
+    m_quick_pool.deallocate_internal(pending.ptr, pending.size);
+    m_pending_bytes -= pending.size;
+    m_pending.pop_front();
+  }
+}
+
+std::size_t DeferredFreePool::getActualSize() const noexcept
+{
+  return m_quick_pool.getActualSize();
+}
+
+std::size_t DeferredFreePool::getPendingSize() const noexcept
+{
+  return m_pending_bytes;
+}
+
+std::size_t DeferredFreePool::getPendingCount() const noexcept
+{
+  return m_pending.size();
+}
+
+Platform DeferredFreePool::getPlatform() noexcept
+{
+  return m_allocator->getPlatform();
+}
+
+MemoryResourceTraits DeferredFreePool::getTraits() const noexcept
+{
+  return m_allocator->getTraits();
+}
+
+} // end of namespace strategy
+} // end namespace umpire
@@ -0,0 +1,119 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_DeferredFreePool_HPP
+#define UMPIRE_DeferredFreePool_HPP
+
+#include <deque>
+
+#include "camp/resource.hpp"
+#include "umpire/Allocator.hpp"
+#include "umpire/strategy/AllocationStrategy.hpp"
+#include "umpire/strategy/PoolCoalesceHeuristic.hpp"
+#include "umpire/strategy/QuickPool.hpp"
+
+namespace umpire {
+namespace strategy {
+
+/*!
+ * \brief A pool that defers reuse of memory freed with a camp event.
+ *
+ * Memory freed with Allocator::deallocate(ptr, resource) may still be used
+ * by work queued on resource, for example by a copy from
+ * ResourceManager::copy. Instead of waiting for that work, the pool records
+ * the event of resource and keeps the memory out of an internal QuickPool
+ * until the event has completed. Pending memory is returned to the
+ * QuickPool by later calls to allocate once its event has completed, and if
+ * the QuickPool cannot grow the pool waits for the pending events before
+ * trying again.
+ *
+ * Memory freed with Allocator::deallocate(ptr) is returned to the QuickPool
+ * straight away.
+ */
+class DeferredFreePool : public AllocationStrategy {
+ public:
+  /*!
+   * \brief Construct a new DeferredFreePool.
+   *
+   * \param name Name of this instance of the DeferredFreePool
+   * \param id Unique identifier for this instance
+   * \param allocator Allocation resource that the internal QuickPool uses
+   * \param first_minimum_pool_allocation_size Size the QuickPool initially allocates
+   * \param next_minimum_pool_allocation_size The minimum size of all future
+   * QuickPool allocations
+   * \param alignment Number of bytes with which to align allocation sizes (power-of-2)
+   * \param should_coalesce Heuristic for when the QuickPool should coalesce
+   */
+  DeferredFreePool(const std::string& name, int id, Allocator allocator,
+                   const std::size_t first_minimum_pool_allocation_size = QuickPool::s_default_first_block_size,
+                   const std::size_t next_minimum_pool_allocation_size = QuickPool::s_default_next_block_size,
+                   const std::size_t alignment = QuickPool::s_default_alignment,
+                   PoolCoalesceHeuristic<QuickPool> should_coalesce = QuickPool::percent_releasable_hwm(100)) noexcept;
+
+  ~DeferredFreePool();
+
+  DeferredFreePool(const DeferredFreePool&) = delete;
+
+  void* allocate(std::size_t bytes) override;
+  void deallocate(void* ptr, std::size_t size) override;
+  void deallocate_after(void* ptr, std::size_t size, const camp::resources::Event& event) override;
+
+  /*!
+   * \brief Wait for all pending memory and release unused memory held by the
+   * internal QuickPool.
+   */
+  void release() override;
+
+  /*!
+   * \brief Return all pending memory whose event has completed to the
+   * internal QuickPool, without waiting.
+   */
+  void reclaim();
+
+  /*!
+   * \brief Wait for the events of all pending memory and return it to the
+   * internal QuickPool.
+   */
+  void synchronize();
+
+  std::size_t getActualSize() const noexcept override;
+
+  /*!
+   * \brief Get the number of bytes waiting for their event to complete.
+   *
+   * Memory freed through an Allocator that does not track allocations is
+   * counted as zero bytes.
+   */
+  std::size_t getPendingSize() const noexcept;
+
+  /*!
+   * \brief Get the number of allocations waiting for their event to
+   * complete.
+   */
+  std::size_t getPendingCount() const noexcept;
+
+  Platform getPlatform() noexcept override;
+
+  MemoryResourceTraits getTraits() const noexcept override;
+
+ private:
+  struct PendingFree {
+    void* ptr;
+    std::size_t size;
+    camp::resources::Event event;
+  };
+
+  QuickPool m_quick_pool;
+  std::deque<PendingFree> m_pending{};
+  std::size_t m_pending_bytes{0};
+
+  AllocationStrategy* m_allocator;
+};
+
+} // end of namespace strategy
+} // end namespace umpire
+
+#endif // UMPIRE_DeferredFreePool_HPP
@@ -38,16 +38,32 @@ void DynamicPoolList::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
   UMPIRE_LOG(Debug, "(ptr=" << ptr << ")");
   dpa.deallocate(ptr);
 
+  if (0 != m_pending_coalesce_size) {
+    coalesce_step();
+    return;
+  }
+
   std::size_t suggested_size{m_should_coalesce(*this)};
   if (0 != suggested_size) {
     UMPIRE_LOG(Debug,
                "Heuristic returned true, "
                "performing coalesce operation for "
                    << this << "\n");
-    dpa.coalesce(suggested_size);
+    if (0 == m_coalesce_budget.count()) {
+      dpa.coalesce(suggested_size);
+    } else if (dpa.getFreeBlocks() > 1 || is_release_only_coalesce(suggested_size, dpa.getCurrentSize())) {
+      m_pending_coalesce_size = suggested_size;
+      coalesce_step();
+    }
   }
 }
 
+bool DynamicPoolList::try_resize(void* ptr, std::size_t UMPIRE_UNUSED_ARG(old_size), std::size_t new_size)
+{
+  UMPIRE_LOG(Debug, "(ptr=" << ptr << ", new_size=" << new_size << ")");
+  return dpa.resize(ptr, new_size);
+}
+
 void DynamicPoolList::release()
 {
   UMPIRE_LOG(Debug, "()");
@@ -129,10 +145,53 @@ void DynamicPoolList::coalesce() noexcept
   std::size_t suggested_size{m_should_coalesce(*this)};
   if (0 != suggested_size) {
     UMPIRE_LOG(Debug, "coalesce heuristic true, performing coalesce, suggested size is " << suggested_size);
+    m_pending_coalesce_size = 0;
     dpa.coalesce(suggested_size);
   }
 }
 
+void DynamicPoolList::coalesce_step()
+{
+  using clock = std::chrono::steady_clock;
+
+  dpa.release(clock::now() + m_coalesce_budget);
+  if (dpa.getReleasableBlocks() > 0) {
+    UMPIRE_LOG(Debug, "coalesce budget spent, " << dpa.getReleasableBlocks() << " releasable blocks left");
+    return;
+  }
+
+  const std::size_t suggested_size{m_pending_coalesce_size};
+  const std::size_t size_post{dpa.getActualSize()};
+  m_pending_coalesce_size = 0;
+
+  if (size_post < suggested_size && !is_release_only_coalesce(suggested_size, dpa.getCurrentSize())) {
+    std::size_t alloc_size{suggested_size - size_post};
+
+    UMPIRE_LOG(Debug, "coalescing " << alloc_size << " bytes.");
+    try {
+      dpa.deallocate(dpa.allocate(alloc_size));
+    } catch (...) {
+      // The pool is still usable, it just keeps the blocks it has
+      UMPIRE_LOG(Warning, "Could not allocate the coalesced block of " << alloc_size << " bytes");
+    }
+  }
+}
+
+void DynamicPoolList::setCoalesceBudget(std::chrono::nanoseconds budget) noexcept
+{
+  m_coalesce_budget = budget;
+}
+
+std::chrono::nanoseconds DynamicPoolList::getCoalesceBudget() const noexcept
+{
+  return m_coalesce_budget;
+}
+
+bool DynamicPoolList::isCoalescePending() const noexcept
+{
+  return 0 != m_pending_coalesce_size;
+}
+
 PoolCoalesceHeuristic<DynamicPoolList> DynamicPoolList::blocks_releasable(std::size_t nblocks)
 {
   return [=](const strategy::DynamicPoolList& pool) {
@@ -7,6 +7,7 @@
 #ifndef UMPIRE_DynamicPoolList_HPP
 #define UMPIRE_DynamicPoolList_HPP
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -72,6 +73,12 @@ class DynamicPoolList : public AllocationStrategy {
   void deallocate(void* ptr, std::size_t size) override;
   void release() override;
 
+  /*!
+   * \brief Grow an allocation into the free block that follows it, or return
+   * the end of the allocation to the pool.
+   */
+  bool try_resize(void* ptr, std::size_t old_size, std::size_t new_size) override;
+
   std::size_t getReleasableBlocks() const noexcept;
   std::size_t getTotalBlocks() const noexcept;
 
@@ -115,10 +122,33 @@ class DynamicPoolList : public AllocationStrategy {
 
   void coalesce() noexcept;
 
+  /*!
+   * \brief Spread coalescing over several deallocations, spending at most
+   * budget in each of them.
+   *
+   * \param budget Time each deallocation may spend coalescing, or zero to
+   * coalesce all at once.
+   *
+   * \see QuickPool::setCoalesceBudget
+   */
+  void setCoalesceBudget(std::chrono::nanoseconds budget) noexcept;
+  std::chrono::nanoseconds getCoalesceBudget() const noexcept;
+
+  /*!
+   * \brief Return whether a coalesce spread over deallocations is still in
+   * progress.
+   */
+  bool isCoalescePending() const noexcept;
+
  private:
+  // Continue a coalesce within the budget
+  void coalesce_step();
+
   strategy::AllocationStrategy* m_allocator;
   DynamicSizePool<> dpa;
   PoolCoalesceHeuristic<DynamicPoolList> m_should_coalesce;
+  std::chrono::nanoseconds m_coalesce_budget{0};
+  std::size_t m_pending_coalesce_size{0};
 };
 
 std::ostream& operator<<(std::ostream& out, PoolCoalesceHeuristic<DynamicPoolList>&);
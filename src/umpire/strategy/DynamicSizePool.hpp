@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cstddef>
 #include <iostream>
 #include <sstream>
@@ -16,6 +17,7 @@
 
 #include "umpire/strategy/AllocationStrategy.hpp"
 #include "umpire/strategy/FixedSizePool.hpp"
+#include "umpire/strategy/PoolCoalesceHeuristic.hpp"
 #include "umpire/strategy/StdAllocator.hpp"
 #include "umpire/strategy/mixins/AlignedAllocation.hpp"
 #include "umpire/util/Macros.hpp"
@@ -208,6 +210,38 @@ class DynamicSizePool : private umpire::strategy::mixins::AlignedAllocation {
       m_releasable_blocks++;
   }
 
+  // Return the completely released block curr, which follows prev in the
+  // free block list, to the allocator
+  void freeBlock(struct Block *curr, struct Block *prev)
+  {
+    UMPIRE_LOG(Debug, "Releasing " << curr->size << " size chunk @ " << static_cast<void *>(curr->data));
+
+    m_actual_bytes -= curr->size;
+    m_releasable_blocks--;
+    m_total_blocks--;
+
+    try {
+      aligned_deallocate(curr->data);
+    } catch (...) {
+      if (m_is_destructing) {
+        //
+        // Ignore error in case the underlying vendor API has already
+        // shutdown
+        //
+        UMPIRE_LOG(Error, "Pool is destructing, runtime_error Ignored");
+      } else {
+        throw;
+      }
+    }
+
+    if (prev)
+      prev->next = curr->next;
+    else
+      freeBlocks = curr->next;
+
+    blockPool.deallocate(curr);
+  }
+
   std::size_t freeReleasedBlocks()
   {
     // Release the unused blocks
@@ -222,33 +256,8 @@ class DynamicSizePool : private umpire::strategy::mixins::AlignedAllocation {
       // Make sure to only free blocks that are completely released.
       //
       if (curr->size == curr->blockSize) {
-        UMPIRE_LOG(Debug, "Releasing " << curr->size << " size chunk @ " << static_cast<void *>(curr->data));
-
-        m_actual_bytes -= curr->size;
-        m_releasable_blocks--;
-        m_total_blocks--;
-
         freed += curr->size;
-        try {
-          aligned_deallocate(curr->data);
-        } catch (...) {
-          if (m_is_destructing) {
-            //
-            // Ignore error in case the underlying vendor API has already
-            // shutdown
-            //
-            UMPIRE_LOG(Error, "Pool is destructing, runtime_error Ignored");
-          } else {
-            throw;
-          }
-        }
-
-        if (prev)
-          prev->next = curr->next;
-        else
-          freeBlocks = curr->next;
-
-        blockPool.deallocate(curr);
+        freeBlock(curr, prev);
       } else {
         prev = curr;
       }
@@ -347,12 +356,110 @@ class DynamicSizePool : private umpire::strategy::mixins::AlignedAllocation {
     releaseBlock(curr, prev);
   }
 
+  // Grow the used block at ptr into the free block that follows it, or give
+  // its end back to the free list. Returns false if ptr was left unchanged.
+  bool resize(void *ptr, std::size_t bytes)
+  {
+    UMPIRE_LOG(Debug, "(ptr=" << ptr << ", bytes=" << bytes << ")");
+
+    struct Block *curr = usedBlocks;
+    for (; curr && curr->data != ptr; curr = curr->next) {
+    }
+    if (!curr || bytes == 0)
+      return false;
+
+    const std::size_t rounded_bytes{aligned_round_up(bytes)};
+
+    // Find the free block that would follow curr
+    struct Block *prev = NULL, *next = freeBlocks;
+    for (; next && next->data < curr->data; next = next->next)
+      prev = next;
+
+    const bool adjacent{next && curr->data + curr->size == next->data && !next->blockSize};
+
+    if (rounded_bytes > curr->size) {
+      const std::size_t extra = rounded_bytes - curr->size;
+
+      if (!adjacent || next->size < extra)
+        return false;
+
+      if (next->size == extra) {
+        if (prev)
+          prev->next = next->next;
+        else
+          freeBlocks = next->next;
+        blockPool.deallocate(next);
+      } else {
+        next->data += extra;
+        next->size -= extra;
+      }
+
+      m_current_size += extra;
+    } else if (rounded_bytes < curr->size) {
+      const std::size_t remaining = curr->size - rounded_bytes;
+      char *tail = curr->data + rounded_bytes;
+
+      UMPIRE_POISON_MEMORY_REGION(m_allocator, tail, remaining);
+
+      if (adjacent) {
+        next->data = tail;
+        next->size += remaining;
+      } else {
+        struct Block *newBlock = (struct Block *)blockPool.allocate();
+        if (!newBlock)
+          return false;
+        newBlock->data = tail;
+        newBlock->size = remaining;
+        newBlock->blockSize = 0;
+        newBlock->next = next;
+
+        if (prev)
+          prev->next = newBlock;
+        else
+          freeBlocks = newBlock;
+      }
+
+      m_current_size -= remaining;
+    }
+
+    curr->size = rounded_bytes;
+    UMPIRE_UNPOISON_MEMORY_REGION(m_allocator, ptr, bytes);
+
+    return true;
+  }
+
   void release()
   {
     UMPIRE_LOG(Debug, "()");
     freeReleasedBlocks();
   }
 
+  // Release completely released blocks until deadline has passed, releasing
+  // at least one. Returns the number of blocks released
+  std::size_t release(std::chrono::steady_clock::time_point deadline)
+  {
+    UMPIRE_LOG(Debug, "()");
+
+    struct Block *curr = freeBlocks;
+    struct Block *prev = NULL;
+    std::size_t released = 0;
+
+    while (curr) {
+      struct Block *next = curr->next;
+      if (curr->size == curr->blockSize) {
+        if (released > 0 && std::chrono::steady_clock::now() >= deadline)
+          break;
+        freeBlock(curr, prev);
+        released++;
+      } else {
+        prev = curr;
+      }
+      curr = next;
+    }
+
+    return released;
+  }
+
   std::size_t getReleasableBlocks() const noexcept
   {
     return m_releasable_blocks;
@@ -432,6 +539,11 @@ class DynamicSizePool : private umpire::strategy::mixins::AlignedAllocation {
 
   void coalesce(std::size_t suggested_size)
   {
+    if (umpire::strategy::is_release_only_coalesce(suggested_size, getCurrentSize())) {
+      freeReleasedBlocks();
+      return;
+    }
+
     if (getFreeBlocks() > 1) {
       freeReleasedBlocks();
       std::size_t size_post{getActualSize()};
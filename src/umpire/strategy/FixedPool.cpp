@@ -9,7 +9,6 @@
 
 #include <algorithm>
 #include <cstdlib>
-#include <cstring>
 #include <sstream>
 
 #include "umpire/util/Macros.hpp"
@@ -23,18 +22,52 @@
 namespace umpire {
 namespace strategy {
 
-static constexpr std::size_t bits_per_int = sizeof(int) * 8;
+static constexpr std::size_t bits_per_word = 64;
+
+namespace {
+
+// Index of the least significant bit set in bits, which must be non-zero
+inline unsigned int least_significant_bit(std::uint32_t bits) noexcept
+{
+  return static_cast<unsigned int>(util::find_first_set(static_cast<int>(bits)) - 1);
+}
+
+inline unsigned int least_significant_bit(std::uint64_t bits) noexcept
+{
+  const std::uint32_t low{static_cast<std::uint32_t>(bits)};
+  return low ? least_significant_bit(low) : 32 + least_significant_bit(static_cast<std::uint32_t>(bits >> 32));
+}
+
+inline std::size_t words_for_bits(std::size_t bits) noexcept
+{
+  return (bits + bits_per_word - 1) / bits_per_word;
+}
+
+// Word with the lowest num_bits bits set
+inline std::uint64_t low_bits(std::size_t num_bits) noexcept
+{
+  return (num_bits >= bits_per_word) ? ~std::uint64_t{0} : ((std::uint64_t{1} << num_bits) - 1);
+}
+
+} // end of anonymous namespace
 
 FixedPool::Pool::Pool(AllocationStrategy* allocation_strategy, const std::size_t object_bytes,
-                      const std::size_t objects_per_pool, const std::size_t avail_bytes)
+                      const std::size_t objects_per_pool, const std::size_t avail_words,
+                      const std::size_t summary_words)
     : strategy(allocation_strategy),
       data(reinterpret_cast<char*>(strategy->allocate_internal(object_bytes * objects_per_pool))),
-      avail(reinterpret_cast<int*>(std::malloc(avail_bytes))),
+      avail(reinterpret_cast<std::uint64_t*>(std::malloc((avail_words + summary_words) * sizeof(std::uint64_t)))),
+      summary(avail + avail_words),
       num_avail(objects_per_pool)
 {
-  // Set all bits to 1
-  const unsigned char not_zero = static_cast<unsigned char>(~0);
-  std::memset(avail, not_zero, avail_bytes);
+  // Mark every object as free, leaving the bits past the last object unset
+  for (std::size_t i = 0; i < avail_words; ++i) {
+    avail[i] = low_bits(objects_per_pool - i * bits_per_word);
+  }
+
+  for (std::size_t i = 0; i < summary_words; ++i) {
+    summary[i] = low_bits(avail_words - i * bits_per_word);
+  }
 }
 
 FixedPool::FixedPool(const std::string& name, int id, Allocator allocator, const std::size_t object_bytes,
@@ -44,11 +77,15 @@ FixedPool::FixedPool(const std::string& name, int id, Allocator allocator, const
       m_obj_bytes{object_bytes},
       m_obj_per_pool{objects_per_pool},
       m_data_bytes{m_obj_bytes * m_obj_per_pool},
-      m_avail_bytes{objects_per_pool / bits_per_int + 1},
+      m_avail_words{words_for_bits(objects_per_pool)},
+      m_summary_words{words_for_bits(m_avail_words)},
       m_current_bytes{0},
       m_actual_bytes{0},
       m_highwatermark{0},
-      m_pool{}
+      m_pool{},
+      m_non_full{},
+      m_hint{0},
+      m_address_index{}
 {
   newPool();
 }
@@ -59,13 +96,11 @@ FixedPool::~FixedPool()
 
   for (auto& p : m_pool) {
     if (m_obj_per_pool != p.num_avail) {
-      for (unsigned int int_index = 0; int_index < m_avail_bytes; ++int_index)
-        for (unsigned int bit_index = 0; bit_index < bits_per_int; ++bit_index) {
-          if (!(p.avail[int_index] & 1 << bit_index)) {
-            const std::size_t index{int_index * bits_per_int + bit_index};
-            leaked_addrs.push_back(static_cast<void*>(p.data + m_obj_bytes * index));
-          }
+      for (std::size_t index = 0; index < m_obj_per_pool; ++index) {
+        if (!(p.avail[index / bits_per_word] & std::uint64_t{1} << (index % bits_per_word))) {
+          leaked_addrs.push_back(static_cast<void*>(p.data + m_obj_bytes * index));
         }
+      }
     }
   }
 
@@ -94,8 +129,16 @@ FixedPool::~FixedPool()
 
 void FixedPool::newPool()
 {
-  m_pool.emplace_back(m_strategy, m_obj_bytes, m_obj_per_pool, m_avail_bytes * sizeof(int));
-  m_actual_bytes += m_avail_bytes + m_data_bytes;
+  m_pool.emplace_back(m_strategy, m_obj_bytes, m_obj_per_pool, m_avail_words, m_summary_words);
+  m_actual_bytes += (m_avail_words + m_summary_words) * sizeof(std::uint64_t) + m_data_bytes;
+
+  if (m_non_full.size() * bits_per_word < m_pool.size()) {
+    m_non_full.push_back(0);
+  }
+  setNonFull(m_pool.size() - 1, true);
+
+  const std::pair<const char*, std::size_t> entry{m_pool.back().data, m_pool.size() - 1};
+  m_address_index.insert(std::upper_bound(m_address_index.begin(), m_address_index.end(), entry), entry);
 }
 
 void* FixedPool::allocInPool(Pool& p)
@@ -103,17 +146,20 @@ void* FixedPool::allocInPool(Pool& p)
   if (!p.num_avail)
     return nullptr;
 
-  for (unsigned int int_index = 0; int_index < m_avail_bytes; ++int_index) {
-    // Return the index of the first 1 bit
-    const int bit_index = util::find_first_set(p.avail[int_index]) - 1;
-    if (bit_index >= 0) {
-      const std::size_t index = int_index * bits_per_int + bit_index;
-      if (index < m_obj_per_pool) {
-        // Flip bit 1 -> 0
-        p.avail[int_index] ^= 1 << bit_index;
-        p.num_avail--;
-        return static_cast<void*>(p.data + m_obj_bytes * index);
-      }
+  for (std::size_t summary_index = 0; summary_index < m_summary_words; ++summary_index) {
+    const std::uint64_t summary_bits{p.summary[summary_index]};
+    if (summary_bits) {
+      const unsigned int summary_bit{least_significant_bit(summary_bits)};
+      const std::size_t word_index{summary_index * bits_per_word + summary_bit};
+      const unsigned int bit_index{least_significant_bit(p.avail[word_index])};
+
+      // Flip bit 1 -> 0, and mark the word as full if it has no free objects left
+      p.avail[word_index] ^= std::uint64_t{1} << bit_index;
+      if (!p.avail[word_index])
+        p.summary[summary_index] ^= std::uint64_t{1} << summary_bit;
+
+      p.num_avail--;
+      return static_cast<void*>(p.data + m_obj_bytes * (word_index * bits_per_word + bit_index));
     }
   }
 
@@ -121,57 +167,186 @@ void* FixedPool::allocInPool(Pool& p)
   return nullptr;
 }
 
+std::size_t FixedPool::allocInPool(Pool& p, void** ptrs, std::size_t count)
+{
+  std::size_t taken{0};
+
+  for (std::size_t summary_index = 0; summary_index < m_summary_words && taken < count; ++summary_index) {
+    std::uint64_t summary_bits{p.summary[summary_index]};
+
+    while (summary_bits && taken < count) {
+      const unsigned int summary_bit{least_significant_bit(summary_bits)};
+      const std::size_t word_index{summary_index * bits_per_word + summary_bit};
+      std::uint64_t avail_bits{p.avail[word_index]};
+
+      // Take the free objects of the word from the lowest one up
+      while (avail_bits && taken < count) {
+        const unsigned int bit_index{least_significant_bit(avail_bits)};
+        avail_bits &= avail_bits - 1;
+        ptrs[taken++] = static_cast<void*>(p.data + m_obj_bytes * (word_index * bits_per_word + bit_index));
+      }
+
+      p.avail[word_index] = avail_bits;
+      if (!avail_bits)
+        p.summary[summary_index] ^= std::uint64_t{1} << summary_bit;
+
+      summary_bits &= summary_bits - 1;
+    }
+  }
+
+  p.num_avail -= taken;
+  return taken;
+}
+
+void FixedPool::setNonFull(std::size_t pool_index, bool non_full) noexcept
+{
+  const std::uint64_t bit{std::uint64_t{1} << (pool_index % bits_per_word)};
+  if (non_full)
+    m_non_full[pool_index / bits_per_word] |= bit;
+  else
+    m_non_full[pool_index / bits_per_word] &= ~bit;
+}
+
+void FixedPool::rebuildIndices()
+{
+  m_non_full.assign(words_for_bits(m_pool.size()), 0);
+  m_address_index.clear();
+  m_address_index.reserve(m_pool.size());
+
+  for (std::size_t pool_index = 0; pool_index < m_pool.size(); ++pool_index) {
+    if (m_pool[pool_index].num_avail)
+      setNonFull(pool_index, true);
+    m_address_index.emplace_back(m_pool[pool_index].data, pool_index);
+  }
+
+  std::sort(m_address_index.begin(), m_address_index.end());
+  m_hint = 0;
+}
+
+std::size_t FixedPool::findPool(const void* ptr) const noexcept
+{
+  const char* t_ptr = static_cast<const char*>(ptr);
+
+  // Find the last sub-pool that starts at or before ptr
+  auto it = std::upper_bound(m_address_index.begin(), m_address_index.end(), t_ptr,
+                             [](const char* p, const std::pair<const char*, std::size_t>& entry) {
+                               return p < entry.first;
+                             });
+
+  if (it != m_address_index.begin()) {
+    --it;
+    const ptrdiff_t offset = t_ptr - it->first;
+    if (offset < static_cast<ptrdiff_t>(m_data_bytes)) {
+      return it->second;
+    }
+  }
+
+  return m_pool.size();
+}
+
+std::size_t FixedPool::findNonFull() const noexcept
+{
+  for (std::size_t i = 0; i < m_non_full.size(); ++i) {
+    if (m_non_full[i])
+      return i * bits_per_word + least_significant_bit(m_non_full[i]);
+  }
+
+  return m_pool.size();
+}
+
 void* FixedPool::allocate(std::size_t bytes)
 {
   // Check that bytes passed matches m_obj_bytes or bytes was not passed
   // (default = 0)
   UMPIRE_ASSERT(!bytes || bytes == m_obj_bytes);
 
-  void* ptr = nullptr;
-
-  for (auto it = m_pool.rbegin(); it != m_pool.rend(); ++it) {
-    ptr = allocInPool(*it);
-    if (ptr) {
-      m_current_bytes += m_obj_bytes;
-      m_highwatermark = std::max(m_highwatermark, m_current_bytes);
-      break;
-    }
+  if (m_hint >= m_pool.size() || !m_pool[m_hint].num_avail) {
+    m_hint = findNonFull();
+    if (m_hint == m_pool.size())
+      newPool();
   }
 
-  if (!ptr) {
-    newPool();
-    ptr = allocate(bytes);
-  }
+  Pool& p = m_pool[m_hint];
+  void* ptr = allocInPool(p);
 
   if (!ptr) {
     UMPIRE_ERROR(runtime_error, fmt::format("FixedPool::allocate(size={}): Could not allocate.", m_obj_bytes));
   }
+
+  if (!p.num_avail)
+    setNonFull(m_hint, false);
+
+  m_current_bytes += m_obj_bytes;
+  m_highwatermark = std::max(m_highwatermark, m_current_bytes);
+
   return ptr;
 }
 
-void FixedPool::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
+void FixedPool::allocate_batch(const std::size_t* sizes, std::size_t count, void** ptrs)
 {
-  for (auto& p : m_pool) {
-    const char* t_ptr = reinterpret_cast<char*>(ptr);
-    const ptrdiff_t offset = t_ptr - p.data;
-    if ((offset >= 0) && (offset < static_cast<ptrdiff_t>(m_data_bytes))) {
-      const std::size_t alloc_index = offset / m_obj_bytes;
-      const std::size_t int_index = alloc_index / bits_per_int;
-      const short bit_index = alloc_index % bits_per_int;
+  UMPIRE_LOG(Debug, "(count=" << count << ")");
 
-      UMPIRE_ASSERT(!(p.avail[int_index] & (1 << bit_index)));
+  UMPIRE_USE_VAR(sizes);
+  for (std::size_t i = 0; i < count; ++i) {
+    UMPIRE_ASSERT(!sizes[i] || sizes[i] == m_obj_bytes);
+  }
+
+  std::size_t allocated{0};
+
+  try {
+    while (allocated < count) {
+      if (m_hint >= m_pool.size() || !m_pool[m_hint].num_avail) {
+        m_hint = findNonFull();
+        if (m_hint == m_pool.size())
+          newPool();
+      }
 
-      // Flip bit 0 -> 1
-      p.avail[int_index] ^= 1 << bit_index;
-      p.num_avail++;
+      Pool& p = m_pool[m_hint];
+      const std::size_t taken{allocInPool(p, ptrs + allocated, count - allocated)};
 
-      m_current_bytes -= m_obj_bytes;
+      if (!p.num_avail)
+        setNonFull(m_hint, false);
 
-      return;
+      allocated += taken;
+      m_current_bytes += taken * m_obj_bytes;
+    }
+  } catch (...) {
+    while (allocated > 0) {
+      --allocated;
+      deallocate(ptrs[allocated], m_obj_bytes);
     }
+    throw;
+  }
+
+  m_highwatermark = std::max(m_highwatermark, m_current_bytes);
+}
+
+void FixedPool::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
+{
+  const std::size_t pool_index{findPool(ptr)};
+
+  if (pool_index == m_pool.size()) {
+    UMPIRE_ERROR(runtime_error, "Could not find the pointer to deallocate");
   }
 
-  UMPIRE_ERROR(runtime_error, "Could not find the pointer to deallocate");
+  Pool& p = m_pool[pool_index];
+  const std::size_t alloc_index = (reinterpret_cast<char*>(ptr) - p.data) / m_obj_bytes;
+  const std::size_t word_index = alloc_index / bits_per_word;
+  const std::uint64_t bit = std::uint64_t{1} << (alloc_index % bits_per_word);
+
+  UMPIRE_ASSERT(!(p.avail[word_index] & bit));
+
+  // Flip bit 0 -> 1
+  p.avail[word_index] ^= bit;
+  p.summary[word_index / bits_per_word] |= std::uint64_t{1} << (word_index % bits_per_word);
+
+  if (p.num_avail++ == 0)
+    setNonFull(pool_index, true);
+
+  // Reuse the most recently freed sub-pool first, as it is likely to be in cache
+  m_hint = pool_index;
+
+  m_current_bytes -= m_obj_bytes;
 }
 
 void FixedPool::release()
@@ -184,6 +359,9 @@ void FixedPool::release()
   }
   m_pool.erase(std::remove_if(m_pool.begin(), m_pool.end(), [&](Pool& p) { return m_obj_per_pool == p.num_avail; }),
                m_pool.end());
+
+  // Sub-pools have moved, so rebuild the indices that refer to them
+  rebuildIndices();
 }
 
 std::size_t FixedPool::getCurrentSize() const noexcept
@@ -218,15 +396,7 @@ std::size_t FixedPool::numPools() const noexcept
 
 bool FixedPool::pointerIsFromPool(void* ptr) const noexcept
 {
-  for (auto& p : m_pool) {
-    const char* t_ptr = reinterpret_cast<char*>(ptr);
-    const ptrdiff_t offset = t_ptr - p.data;
-    if ((offset >= 0) && (offset < static_cast<ptrdiff_t>(m_data_bytes))) {
-      return true;
-    }
-  }
-
-  return false;
+  return findPool(ptr) != m_pool.size();
 }
 
 } // end of namespace strategy
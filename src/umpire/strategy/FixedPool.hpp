@@ -8,6 +8,8 @@
 #define UMPIRE_FixedPool_HPP
 
 #include <cstddef>
+#include <cstdint>
+#include <utility>
 #include <vector>
 
 #include "umpire/Allocator.hpp"
@@ -21,6 +23,15 @@ namespace strategy {
  *
  * This AllocationStrategy provides an efficient pool for fixed size
  * allocations, and used to quickly allocate and deallocate objects.
+ *
+ * Each sub-pool tracks its free objects with a bitmap, and a summary bitmap
+ * with one bit per bitmap word that records which words have free objects.
+ * The pool also keeps a bitmap of the sub-pools that are not full, and starts
+ * each allocation from the sub-pool that last had a free object, so that
+ * finding a free object does not require scanning every sub-pool.
+ *
+ * The sub-pool that owns a pointer is found by binary search over the
+ * sub-pools ordered by address.
  */
 class FixedPool : public AllocationStrategy {
  public:
@@ -35,8 +46,7 @@ class FixedPool : public AllocationStrategy {
    * \param objects_per_pool Number of objects in each sub-pool
    * internally. Performance likely improves if this is large, at
    * the cost of memory usage. This does not have to be a multiple
-   * of sizeof(int)*8, but it will also likely improve performance
-   * if so.
+   * of 64, but it will also likely improve performance if so.
    */
   FixedPool(const std::string& name, int id, Allocator allocator, const std::size_t object_bytes,
             const std::size_t objects_per_pool = 64 * sizeof(int) * 8) noexcept;
@@ -48,6 +58,12 @@ class FixedPool : public AllocationStrategy {
   void* allocate(std::size_t bytes = 0) override final;
   void deallocate(void* ptr, std::size_t size) override final;
 
+  /*!
+   * \brief Allocate all of the objects with one scan of the bitmaps of each
+   * sub-pool, taking every free object of a bitmap word at once.
+   */
+  void allocate_batch(const std::size_t* sizes, std::size_t count, void** ptrs) override final;
+
   void release() override final;
 
   std::size_t getCurrentSize() const noexcept override final;
@@ -65,20 +81,34 @@ class FixedPool : public AllocationStrategy {
   struct Pool {
     AllocationStrategy* strategy;
     char* data;
-    int* avail;
+    // A set bit in avail marks a free object, and a set bit in summary marks
+    // a word of avail that has a free object. Both live in one allocation.
+    std::uint64_t* avail;
+    std::uint64_t* summary;
     std::size_t num_avail;
     Pool(AllocationStrategy* allocation_strategy, const std::size_t object_bytes, const std::size_t objects_per_pool,
-         const std::size_t avail_bytes);
+         const std::size_t avail_words, const std::size_t summary_words);
   };
 
   void newPool();
   void* allocInPool(Pool& p);
+  std::size_t allocInPool(Pool& p, void** ptrs, std::size_t count);
+  void setNonFull(std::size_t pool_index, bool non_full) noexcept;
+  std::size_t findNonFull() const noexcept;
+  void rebuildIndices();
+
+  /*!
+   * \brief Return the index in m_pool of the sub-pool that holds ptr, or
+   * m_pool.size() if no sub-pool holds it.
+   */
+  std::size_t findPool(const void* ptr) const noexcept;
 
   AllocationStrategy* m_strategy;
   std::size_t m_obj_bytes;
   std::size_t m_obj_per_pool;
   std::size_t m_data_bytes;
-  std::size_t m_avail_bytes;
+  std::size_t m_avail_words;
+  std::size_t m_summary_words;
   std::size_t m_current_bytes;
   std::size_t m_actual_bytes;
   std::size_t m_highwatermark;
@@ -86,6 +116,13 @@ class FixedPool : public AllocationStrategy {
   // NOTE: struct Pool lacks a non-trivial destructor. If m_pool is
   // ever reduced in size, then .data and .avail have to be manually
   // deallocated to avoid a memory leak.
+
+  // One bit per entry of m_pool, set when that sub-pool has a free object
+  std::vector<std::uint64_t> m_non_full;
+  // Index of the sub-pool that most recently had a free object
+  std::size_t m_hint;
+  // Start address and m_pool index of every sub-pool, sorted by address
+  std::vector<std::pair<const char*, std::size_t>> m_address_index;
 };
 
 } // end namespace strategy
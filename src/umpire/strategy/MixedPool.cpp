@@ -54,10 +54,9 @@ MixedPool::MixedPool(const std::string& name, int id, Allocator allocator, std::
   }
 }
 
-void* MixedPool::allocate(std::size_t bytes)
+std::size_t MixedPool::findPool(std::size_t bytes) const noexcept
 {
-  // Find pool index
-  int index = 0;
+  std::size_t index = 0;
   for (std::size_t i = 0; i < m_fixed_pool_map.size(); ++i) {
     if (bytes > m_fixed_pool_map[index]) {
       index++;
@@ -65,6 +64,12 @@ void* MixedPool::allocate(std::size_t bytes)
       break;
     }
   }
+  return index;
+}
+
+void* MixedPool::allocate(std::size_t bytes)
+{
+  const int index = static_cast<int>(findPool(bytes));
 
   void* mem;
 
@@ -80,6 +85,58 @@ void* MixedPool::allocate(std::size_t bytes)
   return mem;
 }
 
+void MixedPool::allocate_batch(const std::size_t* sizes, std::size_t count, void** ptrs)
+{
+  UMPIRE_LOG(Debug, "(count=" << count << ")");
+
+  //
+  // Group the buffers by the pool they come from, with the quick pool last,
+  // so that each pool allocates all of its buffers in one batch
+  //
+  const std::size_t num_pools{m_fixed_pool.size() + 1};
+  std::vector<std::vector<std::size_t>> buffers(num_pools);
+  for (std::size_t i = 0; i < count; ++i) {
+    buffers[findPool(sizes[i])].push_back(i);
+  }
+
+  std::vector<std::size_t> pool_sizes;
+  std::vector<void*> pool_ptrs;
+  std::size_t index{0};
+
+  try {
+    for (; index < num_pools; ++index) {
+      const auto& buffer_indices = buffers[index];
+      if (buffer_indices.empty()) {
+        continue;
+      }
+
+      const bool is_fixed{index < m_fixed_pool.size()};
+      AllocationStrategy& pool = is_fixed ? static_cast<AllocationStrategy&>(*m_fixed_pool[index]) : m_quick_pool;
+
+      pool_sizes.clear();
+      for (auto i : buffer_indices) {
+        pool_sizes.push_back(is_fixed ? m_fixed_pool_map[index] : sizes[i]);
+      }
+      pool_ptrs.resize(buffer_indices.size());
+
+      pool.allocate_batch_internal(pool_sizes.data(), pool_sizes.size(), pool_ptrs.data());
+
+      for (std::size_t j = 0; j < buffer_indices.size(); ++j) {
+        ptrs[buffer_indices[j]] = pool_ptrs[j];
+        m_map[reinterpret_cast<uintptr_t>(pool_ptrs[j])] = is_fixed ? static_cast<int>(index) : -1;
+      }
+    }
+  } catch (...) {
+    // Give back the buffers of the pools that allocated theirs
+    for (std::size_t done = 0; done < index; ++done) {
+      for (auto i : buffers[done]) {
+        deallocate(ptrs[i], sizes[i]);
+      }
+    }
+    throw;
+  }
+}
+
 void MixedPool::deallocate(void* ptr, std::size_t size)
 {
   auto iter = m_map.find(reinterpret_cast<uintptr_t>(ptr));
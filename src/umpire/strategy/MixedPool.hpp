@@ -58,6 +58,12 @@ class MixedPool : public AllocationStrategy {
   void* allocate(std::size_t bytes) override;
   void deallocate(void* ptr, std::size_t size) override;
 
+  /*!
+   * \brief Allocate the buffers with one batch for each of the fixed pools
+   * and the quick pool that they come from.
+   */
+  void allocate_batch(const std::size_t* sizes, std::size_t count, void** ptrs) override;
+
   void release() override;
 
   std::size_t getActualSize() const noexcept override;
@@ -67,6 +73,9 @@ class MixedPool : public AllocationStrategy {
   MemoryResourceTraits getTraits() const noexcept override;
 
  private:
+  // Index of the fixed pool for bytes, or m_fixed_pool.size() for the quick pool
+  std::size_t findPool(std::size_t bytes) const noexcept;
+
   using IntMap = std::map<uintptr_t, int>;
   IntMap m_map;
   std::vector<std::size_t> m_fixed_pool_map;
@@ -0,0 +1,136 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/strategy/NumaFirstTouchPolicy.hpp"
+
+#include <cstdint>
+#include <exception>
+#include <thread>
+#include <utility>
+
+#include "umpire/util/Macros.hpp"
+#include "umpire/util/numa.hpp"
+
+namespace umpire {
+
+namespace strategy {
+
+namespace {
+
+// Fault in the pages holding [begin, end) without changing their contents
+void touch_pages(std::uintptr_t begin, std::uintptr_t end, std::uintptr_t page_size)
+{
+  for (std::uintptr_t address = begin; address < end; address = (address / page_size + 1) * page_size) {
+    volatile char* p = reinterpret_cast<volatile char*>(address);
+    *p = *p;
+  }
+}
+
+std::uintptr_t round_up(std::uintptr_t address, std::uintptr_t page_size)
+{
+  return ((address + page_size - 1) / page_size) * page_size;
+}
+
+} // end of anonymous namespace
+
+NumaFirstTouchPolicy::NumaFirstTouchPolicy(const std::string& name, int id, Allocator allocator,
+                                           std::vector<int> partitions)
+    : AllocationStrategy{name, id, allocator.getAllocationStrategy(), "NumaFirstTouchPolicy"},
+      m_allocator(allocator.getAllocationStrategy()),
+      m_partitions(std::move(partitions))
+{
+  if (allocator.getPlatform() != Platform::host) {
+    UMPIRE_ERROR(runtime_error, "NumaFirstTouchPolicy error: allocator is not of cpu type");
+  }
+
+  if (m_partitions.empty()) {
+    m_partitions = numa::get_host_nodes();
+  }
+
+  for (auto node : m_partitions) {
+    if (node < 0) {
+      UMPIRE_ERROR(runtime_error, "NumaFirstTouchPolicy error: NUMA nodes are always non-negative ints");
+    }
+  }
+}
+
+void* NumaFirstTouchPolicy::allocate(std::size_t bytes)
+{
+  void* ret = m_allocator->allocate_internal(bytes);
+
+  if (bytes > 0) {
+    const std::uintptr_t page_size{static_cast<std::uintptr_t>(get_page_size())};
+    const std::uintptr_t base{reinterpret_cast<std::uintptr_t>(ret)};
+    const std::size_t num_parts{m_partitions.size()};
+
+    std::vector<std::thread> threads;
+    std::vector<std::exception_ptr> errors(num_parts);
+    threads.reserve(num_parts);
+
+    //
+    // A page is touched by the part its first byte belongs to, and the page
+    // holding the first byte of the allocation by the first part. Only bytes
+    // of the allocation are touched, as the rest of its first page may be in
+    // use by others.
+    //
+    for (std::size_t i = 0; i < num_parts; ++i) {
+      const std::uintptr_t begin{i == 0 ? base : round_up(base + bytes * i / num_parts, page_size)};
+      const std::uintptr_t end{round_up(base + bytes * (i + 1) / num_parts, page_size)};
+      const int node{m_partitions[i]};
+
+      if (begin >= end) {
+        continue;
+      }
+
+      threads.emplace_back([begin, end, page_size, node, &errors, i] {
+        try {
+          numa::run_on_node(node);
+          touch_pages(begin, end, page_size);
+        } catch (...) {
+          errors[i] = std::current_exception();
+        }
+      });
+    }
+
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    for (auto& error : errors) {
+      if (error) {
+        m_allocator->deallocate_internal(ret, bytes);
+        std::rethrow_exception(error);
+      }
+    }
+  }
+
+  UMPIRE_LOG(Debug, "(bytes=" << bytes << ") returning " << ret);
+
+  return ret;
+}
+
+void NumaFirstTouchPolicy::deallocate(void* ptr, std::size_t size)
+{
+  m_allocator->deallocate_internal(ptr, size);
+}
+
+Platform NumaFirstTouchPolicy::getPlatform() noexcept
+{
+  return Platform::host;
+}
+
+MemoryResourceTraits NumaFirstTouchPolicy::getTraits() const noexcept
+{
+  return m_allocator->getTraits();
+}
+
+const std::vector<int>& NumaFirstTouchPolicy::getPartitions() const noexcept
+{
+  return m_partitions;
+}
+
+} // end of namespace strategy
+} // end of namespace umpire
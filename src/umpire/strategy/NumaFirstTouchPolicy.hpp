@@ -0,0 +1,68 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_NumaFirstTouchPolicy_HPP
+#define UMPIRE_NumaFirstTouchPolicy_HPP
+
+#include <vector>
+
+#include "umpire/Allocator.hpp"
+#include "umpire/strategy/AllocationStrategy.hpp"
+
+namespace umpire {
+
+namespace strategy {
+
+/*!
+ * \brief Place the pages of memory by touching them from threads running on
+ * each NUMA node.
+ *
+ * Each allocation is split into partitions.size() equal contiguous parts, the
+ * static partition an application uses to divide a loop between its threads.
+ * Part i is touched by a thread restricted to the CPUs of node partitions[i],
+ * so the kernel's first touch policy places its pages on that node. For an
+ * application running 8 threads bound compactly to two sockets the
+ * partitions are {0, 0, 0, 0, 1, 1, 1, 1}.
+ *
+ * Pages are only placed by the first touch, so the allocator must return
+ * memory freshly mapped from the operating system, such as that of the
+ * "HUGEPAGE" resource or the untouched top of an ArenaPool. "HOST" is not
+ * suitable: below the mmap threshold of the C library it can return heap
+ * pages that were already touched, and so already placed. Use this strategy
+ * under a pool to pay the cost of the touching threads only when the pool
+ * grows.
+ */
+class NumaFirstTouchPolicy : public AllocationStrategy {
+ public:
+  /*!
+   * \brief Construct a new NumaFirstTouchPolicy.
+   *
+   * \param name Name of this instance of the NumaFirstTouchPolicy
+   * \param id Unique identifier for this instance
+   * \param allocator Host allocator to use for allocations
+   * \param partitions NUMA node that touches each part of an allocation, one
+   * part per host node when empty
+   */
+  NumaFirstTouchPolicy(const std::string& name, int id, Allocator allocator, std::vector<int> partitions = {});
+
+  void* allocate(std::size_t bytes) override;
+  void deallocate(void* ptr, std::size_t size) override;
+
+  Platform getPlatform() noexcept override;
+
+  MemoryResourceTraits getTraits() const noexcept override;
+
+  const std::vector<int>& getPartitions() const noexcept;
+
+ private:
+  strategy::AllocationStrategy* m_allocator;
+  std::vector<int> m_partitions;
+};
+
+} // end of namespace strategy
+} // end of namespace umpire
+
+#endif // UMPIRE_NumaFirstTouchPolicy_HPP
@@ -0,0 +1,73 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/strategy/NumaInterleavePolicy.hpp"
+
+#include <utility>
+
+#include "umpire/util/Macros.hpp"
+#include "umpire/util/numa.hpp"
+
+namespace umpire {
+
+namespace strategy {
+
+NumaInterleavePolicy::NumaInterleavePolicy(const std::string& name, int id, Allocator allocator,
+                                           std::vector<int> nodes)
+    : AllocationStrategy{name, id, allocator.getAllocationStrategy(), "NumaInterleavePolicy"},
+      m_allocator(allocator.getAllocationStrategy()),
+      m_nodes(std::move(nodes))
+{
+  if (allocator.getPlatform() != Platform::host) {
+    UMPIRE_ERROR(runtime_error, "NumaInterleavePolicy error: allocator is not of cpu type");
+  }
+
+  if (m_nodes.empty()) {
+    m_nodes = numa::get_host_nodes();
+  }
+
+  for (auto node : m_nodes) {
+    if (node < 0) {
+      UMPIRE_ERROR(runtime_error, "NumaInterleavePolicy error: NUMA nodes are always non-negative ints");
+    }
+  }
+}
+
+void* NumaInterleavePolicy::allocate(std::size_t bytes)
+{
+  void* ret = m_allocator->allocate_internal(bytes);
+
+  if (bytes > 0) {
+    numa::interleave(ret, bytes, m_nodes);
+  }
+
+  UMPIRE_LOG(Debug, "(bytes=" << bytes << ") returning " << ret);
+
+  return ret;
+}
+
+void NumaInterleavePolicy::deallocate(void* ptr, std::size_t size)
+{
+  m_allocator->deallocate_internal(ptr, size);
+}
+
+Platform NumaInterleavePolicy::getPlatform() noexcept
+{
+  return Platform::host;
+}
+
+MemoryResourceTraits NumaInterleavePolicy::getTraits() const noexcept
+{
+  return m_allocator->getTraits();
+}
+
+const std::vector<int>& NumaInterleavePolicy::getNodes() const noexcept
+{
+  return m_nodes;
+}
+
+} // end of namespace strategy
+} // end of namespace umpire
@@ -0,0 +1,58 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_NumaInterleavePolicy_HPP
+#define UMPIRE_NumaInterleavePolicy_HPP
+
+#include <vector>
+
+#include "umpire/Allocator.hpp"
+#include "umpire/strategy/AllocationStrategy.hpp"
+
+namespace umpire {
+
+namespace strategy {
+
+/*!
+ * \brief Use NUMA interface to interleave the pages of memory across a set of
+ * NUMA nodes.
+ *
+ * Page i of each allocation is placed on node i modulo the number of nodes,
+ * so memory that is shared by threads on every socket is read with the
+ * bandwidth of all of them. The allocator must return page-aligned host
+ * memory.
+ */
+class NumaInterleavePolicy : public AllocationStrategy {
+ public:
+  /*!
+   * \brief Construct a new NumaInterleavePolicy.
+   *
+   * \param name Name of this instance of the NumaInterleavePolicy
+   * \param id Unique identifier for this instance
+   * \param allocator Host allocator to use for allocations
+   * \param nodes NUMA nodes to interleave pages across, all host nodes when
+   * empty
+   */
+  NumaInterleavePolicy(const std::string& name, int id, Allocator allocator, std::vector<int> nodes = {});
+
+  void* allocate(std::size_t bytes) override;
+  void deallocate(void* ptr, std::size_t size) override;
+
+  Platform getPlatform() noexcept override;
+
+  MemoryResourceTraits getTraits() const noexcept override;
+
+  const std::vector<int>& getNodes() const noexcept;
+
+ private:
+  strategy::AllocationStrategy* m_allocator;
+  std::vector<int> m_nodes;
+};
+
+} // end of namespace strategy
+} // end of namespace umpire
+
+#endif // UMPIRE_NumaInterleavePolicy_HPP
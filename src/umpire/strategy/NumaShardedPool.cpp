@@ -0,0 +1,191 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/strategy/NumaShardedPool.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "umpire/strategy/NumaPolicy.hpp"
+#include "umpire/util/Macros.hpp"
+#include "umpire/util/error.hpp"
+#include "umpire/util/make_unique.hpp"
+#include "umpire/util/numa.hpp"
+
+namespace umpire {
+namespace strategy {
+
+NumaShardedPool::Shard::Shard(const std::string& name, Allocator node_allocator, int numa_node,
+                              const std::size_t first_minimum_pool_allocation_size,
+                              const std::size_t next_minimum_pool_allocation_size, const std::size_t alignment,
+                              PoolCoalesceHeuristic<QuickPool> should_coalesce)
+    : node{numa_node},
+      pool{name + "_quick_pool",
+           -1,
+           node_allocator,
+           first_minimum_pool_allocation_size,
+           next_minimum_pool_allocation_size,
+           alignment,
+           should_coalesce}
+{
+}
+
+NumaShardedPool::NumaShardedPool(const std::string& name, int id, std::vector<Allocator> node_allocators,
+                                 const std::size_t first_minimum_pool_allocation_size,
+                                 const std::size_t next_minimum_pool_allocation_size, const std::size_t alignment,
+                                 PoolCoalesceHeuristic<QuickPool> should_coalesce)
+    : AllocationStrategy{name, id, node_allocators.empty() ? nullptr : node_allocators.front().getAllocationStrategy(),
+                         "NumaShardedPool"},
+      m_allocator{node_allocators.empty() ? nullptr : node_allocators.front().getAllocationStrategy()}
+{
+  if (node_allocators.empty()) {
+    UMPIRE_ERROR(runtime_error, "NumaShardedPool error: no NUMA node allocators to make pools for");
+  }
+
+  for (auto& node_allocator : node_allocators) {
+    auto policy = dynamic_cast<NumaPolicy*>(node_allocator.getAllocationStrategy());
+    if (!policy) {
+      UMPIRE_ERROR(runtime_error, fmt::format("NumaShardedPool error: allocator \"{}\" is not a NumaPolicy",
+                                              node_allocator.getName()));
+    }
+
+    const int node{policy->getNode()};
+
+    if (static_cast<std::size_t>(node) >= m_shard_index.size()) {
+      m_shard_index.resize(node + 1, -1);
+    }
+
+    if (m_shard_index[node] != -1) {
+      UMPIRE_ERROR(runtime_error, fmt::format("NumaShardedPool error: more than one allocator for NUMA node {}", node));
+    }
+
+    m_shard_index[node] = static_cast<int>(m_shards.size());
+    m_shards.emplace_back(util::make_unique<Shard>("internal_node_" + std::to_string(node), node_allocator, node,
+                                                   first_minimum_pool_allocation_size,
+                                                   next_minimum_pool_allocation_size, alignment, should_coalesce));
+  }
+}
+
+void* NumaShardedPool::allocate(std::size_t bytes)
+{
+  Shard& shard = local_shard();
+  void* ptr{nullptr};
+
+  {
+    std::lock_guard<std::mutex> lock{shard.mutex};
+    ptr = shard.pool.allocate_internal(bytes);
+  }
+
+  UMPIRE_LOG(Debug, "(bytes=" << bytes << ") returning " << ptr << " from node " << shard.node);
+
+  return ptr;
+}
+
+void NumaShardedPool::deallocate(void* ptr, std::size_t size)
+{
+  UMPIRE_LOG(Debug, "(ptr=" << ptr << ")");
+
+  // Memory is usually freed on the node that allocated it
+  Shard& local = local_shard();
+  if (try_deallocate(local, ptr, size)) {
+    return;
+  }
+
+  for (auto& shard : m_shards) {
+    if (shard.get() != &local && try_deallocate(*shard, ptr, size)) {
+      return;
+    }
+  }
+
+  UMPIRE_ERROR(runtime_error, fmt::format("Pointer {} was not allocated by NumaShardedPool \"{}\"", ptr, getName()));
+}
+
+void NumaShardedPool::release()
+{
+  for (auto& shard : m_shards) {
+    std::lock_guard<std::mutex> lock{shard->mutex};
+    shard->pool.release();
+  }
+}
+
+std::size_t NumaShardedPool::getActualSize() const noexcept
+{
+  std::size_t size{0};
+  for (const auto& shard : m_shards) {
+    std::lock_guard<std::mutex> lock{shard->mutex};
+    size += shard->pool.getActualSize();
+  }
+  return size;
+}
+
+std::size_t NumaShardedPool::getCurrentSize() const noexcept
+{
+  std::size_t size{0};
+  for (const auto& shard : m_shards) {
+    std::lock_guard<std::mutex> lock{shard->mutex};
+    size += shard->pool.getCurrentSize();
+  }
+  return size;
+}
+
+std::vector<int> NumaShardedPool::getNodes() const
+{
+  std::vector<int> nodes;
+  for (const auto& shard : m_shards) {
+    nodes.push_back(shard->node);
+  }
+  return nodes;
+}
+
+std::size_t NumaShardedPool::getActualSize(int node) const noexcept
+{
+  if (node < 0 || static_cast<std::size_t>(node) >= m_shard_index.size() || m_shard_index[node] == -1) {
+    return 0;
+  }
+
+  Shard& shard = *m_shards[m_shard_index[node]];
+  std::lock_guard<std::mutex> lock{shard.mutex};
+  return shard.pool.getActualSize();
+}
+
+Platform NumaShardedPool::getPlatform() noexcept
+{
+  return m_allocator->getPlatform();
+}
+
+MemoryResourceTraits NumaShardedPool::getTraits() const noexcept
+{
+  return m_allocator->getTraits();
+}
+
+NumaShardedPool::Shard& NumaShardedPool::local_shard()
+{
+  const int node{numa::current_node()};
+
+  //
+  // Threads running on a node without a pool, such as one without an
+  // allocator given to the constructor, use the first pool.
+  //
+  if (node >= 0 && static_cast<std::size_t>(node) < m_shard_index.size() && m_shard_index[node] != -1) {
+    return *m_shards[m_shard_index[node]];
+  }
+
+  return *m_shards.front();
+}
+
+bool NumaShardedPool::try_deallocate(Shard& shard, void* ptr, std::size_t size)
+{
+  std::lock_guard<std::mutex> lock{shard.mutex};
+  if (!shard.pool.owns(ptr)) {
+    return false;
+  }
+
+  shard.pool.deallocate_internal(ptr, size);
+  return true;
+}
+
+} // end of namespace strategy
+} // end namespace umpire
@@ -0,0 +1,112 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_NumaShardedPool_HPP
+#define UMPIRE_NumaShardedPool_HPP
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "umpire/Allocator.hpp"
+#include "umpire/strategy/AllocationStrategy.hpp"
+#include "umpire/strategy/PoolCoalesceHeuristic.hpp"
+#include "umpire/strategy/QuickPool.hpp"
+
+namespace umpire {
+namespace strategy {
+
+/*!
+ * \brief A pool made of one QuickPool per NUMA node.
+ *
+ * The pool of each node takes its blocks from a NumaPolicy allocator bound to
+ * that node. Each allocation is taken from the pool of the node of the CPU
+ * the calling thread is running on, so memory used by the thread that
+ * allocated it is local to that thread, and is returned to the same pool
+ * when it is deallocated from any thread.
+ *
+ * The pool of each node has its own lock, so threads on different nodes do
+ * not contend with each other. A deallocation first asks the pool of the
+ * node of the calling thread whether it owns the memory, and only then the
+ * pools of the other nodes, so memory freed on the node that allocated it
+ * takes a single lock. Threads should be bound to their CPUs, as the node of
+ * a thread that migrates may change between the allocation and the use of
+ * its memory.
+ */
+class NumaShardedPool : public AllocationStrategy {
+ public:
+  /*!
+   * \brief Construct a new NumaShardedPool.
+   *
+   * \param name Name of this instance of the NumaShardedPool
+   * \param id Unique identifier for this instance
+   * \param node_allocators NumaPolicy allocators, one for each NUMA node to
+   * make a pool for
+   * \param first_minimum_pool_allocation_size Size the pool of each node
+   * initially allocates
+   * \param next_minimum_pool_allocation_size The minimum size of all future
+   * allocations of the pool of each node
+   * \param alignment Number of bytes with which to align allocation sizes (power-of-2)
+   * \param should_coalesce Heuristic for when the pool of each node should coalesce
+   */
+  NumaShardedPool(const std::string& name, int id, std::vector<Allocator> node_allocators,
+                  const std::size_t first_minimum_pool_allocation_size = QuickPool::s_default_first_block_size,
+                  const std::size_t next_minimum_pool_allocation_size = QuickPool::s_default_next_block_size,
+                  const std::size_t alignment = QuickPool::s_default_alignment,
+                  PoolCoalesceHeuristic<QuickPool> should_coalesce = QuickPool::percent_releasable_hwm(100));
+
+  NumaShardedPool(const NumaShardedPool&) = delete;
+
+  void* allocate(std::size_t bytes) override;
+  void deallocate(void* ptr, std::size_t size) override;
+  void release() override;
+
+  std::size_t getActualSize() const noexcept override;
+  std::size_t getCurrentSize() const noexcept override;
+
+  /*!
+   * \brief Get the NUMA nodes that have a pool.
+   */
+  std::vector<int> getNodes() const;
+
+  /*!
+   * \brief Get the number of bytes held by the pool of node.
+   */
+  std::size_t getActualSize(int node) const noexcept;
+
+  Platform getPlatform() noexcept override;
+
+  MemoryResourceTraits getTraits() const noexcept override;
+
+ private:
+  struct Shard {
+    Shard(const std::string& name, Allocator node_allocator, int node,
+          const std::size_t first_minimum_pool_allocation_size, const std::size_t next_minimum_pool_allocation_size,
+          const std::size_t alignment, PoolCoalesceHeuristic<QuickPool> should_coalesce);
+
+    int node;
+    std::mutex mutex;
+    QuickPool pool;
+  };
+
+  // Return the shard for the node of the calling thread
+  Shard& local_shard();
+
+  // Deallocate ptr if shard owns it, and return whether it did
+  static bool try_deallocate(Shard& shard, void* ptr, std::size_t size);
+
+  std::vector<std::unique_ptr<Shard>> m_shards;
+
+  // Index of the shard of each node, -1 for nodes without one
+  std::vector<int> m_shard_index;
+
+  AllocationStrategy* m_allocator;
+};
+
+} // end of namespace strategy
+} // end namespace umpire
+
+#endif // UMPIRE_NumaShardedPool_HPP
@@ -7,6 +7,7 @@
 #ifndef UMPIRE_PoolCoalesceHeuristic_HPP
 #define UMPIRE_PoolCoalesceHeuristic_HPP
 
+#include <cstddef>
 #include <functional>
 
 namespace umpire {
@@ -16,6 +17,25 @@ namespace strategy {
 template <typename T>
 using PoolCoalesceHeuristic = std::function<std::size_t(const T&)>;
 
+/*!
+ * \brief Size a coalesce heuristic may suggest to have the pool release its
+ * free blocks without allocating a coalesced block in their place, even when
+ * nothing is in use.
+ */
+constexpr std::size_t release_only_coalesce_size{1};
+
+/*!
+ * \brief Return whether a coalesce to suggested_size should only release the
+ * free blocks of a pool that has current_size bytes in use.
+ *
+ * The blocks in use already hold current_size bytes, so a suggested size that
+ * is no larger leaves nothing for a coalesced block to hold.
+ */
+inline bool is_release_only_coalesce(std::size_t suggested_size, std::size_t current_size) noexcept
+{
+  return suggested_size <= current_size || suggested_size == release_only_coalesce_size;
+}
+
 } // end of namespace strategy
 } // end namespace umpire
 
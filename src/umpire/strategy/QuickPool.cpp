@@ -6,6 +6,15 @@
 
 #include "umpire/strategy/QuickPool.hpp"
 
+#if !defined(_WIN32)
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <cstdint>
+
 #include "umpire/Allocator.hpp"
 #include "umpire/strategy/PoolCoalesceHeuristic.hpp"
 #include "umpire/strategy/mixins/AlignedAllocation.hpp"
@@ -44,6 +53,55 @@ void* QuickPool::allocate(std::size_t bytes)
 {
   UMPIRE_LOG(Debug, "(bytes=" << bytes << ")");
   const std::size_t rounded_bytes{aligned_round_up(bytes)};
+
+  Chunk* chunk{take_chunk(rounded_bytes)};
+  void* ret{use_chunk(chunk, rounded_bytes, bytes)};
+
+  Chunk* split_chunk{split(chunk, rounded_bytes)};
+  if (split_chunk) {
+    split_chunk->size_map_it = m_size_map.insert(std::make_pair(split_chunk->size, split_chunk));
+  }
+
+  return ret;
+}
+
+void QuickPool::allocate_batch(const std::size_t* sizes, std::size_t count, void** ptrs)
+{
+  UMPIRE_LOG(Debug, "(count=" << count << ")");
+
+  std::size_t total_bytes{0};
+  for (std::size_t i = 0; i < count; ++i) {
+    if (sizes[i] == 0) {
+      AllocationStrategy::allocate_batch(sizes, count, ptrs);
+      return;
+    }
+    total_bytes += aligned_round_up(sizes[i]);
+  }
+
+  if (count == 0) {
+    return;
+  }
+
+  //
+  // Carve every allocation from one chunk, and only put what is left of it
+  // back in the size map at the end
+  //
+  Chunk* chunk{take_chunk(total_bytes)};
+
+  for (std::size_t i = 0; i < count; ++i) {
+    const std::size_t rounded_bytes{aligned_round_up(sizes[i])};
+
+    ptrs[i] = use_chunk(chunk, rounded_bytes, sizes[i]);
+    chunk = split(chunk, rounded_bytes);
+  }
+
+  if (chunk) {
+    chunk->size_map_it = m_size_map.insert(std::make_pair(chunk->size, chunk));
+  }
+}
+
+QuickPool::Chunk* QuickPool::take_chunk(std::size_t rounded_bytes)
+{
   const auto& best = m_size_map.lower_bound(rounded_bytes);
 
   Chunk* chunk{nullptr};
@@ -71,7 +129,7 @@ void* QuickPool::allocate(std::size_t bytes)
       UMPIRE_LOG(Error,
                  "Caught error allocating new chunk, giving up free chunks and "
                  "retrying...");
-      release();
+      release_blocks();
       try {
         ret = aligned_allocate(size); // Will Poison
         UMPIRE_LOG(Debug, "memory reclaimed, chunk successfully allocated.");
@@ -102,42 +160,105 @@ void* QuickPool::allocate(std::size_t bytes)
     m_releasable_blocks--;
   }
 
+  return chunk;
+}
+
+void* QuickPool::use_chunk(Chunk* chunk, std::size_t rounded_bytes, std::size_t bytes)
+{
   void* ret = chunk->data;
   m_pointer_map.insert(std::make_pair(ret, chunk));
 
   chunk->free = false;
+  m_current_bytes += rounded_bytes;
 
-  if (rounded_bytes != chunk->size) {
-    std::size_t remaining{chunk->size - rounded_bytes};
-    UMPIRE_LOG(Debug, "Splitting chunk " << chunk->size << "into " << rounded_bytes << " and " << remaining);
+  UMPIRE_USE_VAR(bytes);
+  UMPIRE_UNPOISON_MEMORY_REGION(m_allocator, ret, bytes);
+  return ret;
+}
 
-    void* chunk_storage{m_chunk_pool.allocate()};
-    Chunk* split_chunk{new (chunk_storage)
-                           Chunk{static_cast<char*>(ret) + rounded_bytes, remaining, chunk->chunk_size}};
+QuickPool::Chunk* QuickPool::split(Chunk* chunk, std::size_t rounded_bytes)
+{
+  if (rounded_bytes == chunk->size) {
+    return nullptr;
+  }
 
-    auto old_next = chunk->next;
-    chunk->next = split_chunk;
-    split_chunk->prev = chunk;
-    split_chunk->next = old_next;
+  std::size_t remaining{chunk->size - rounded_bytes};
+  UMPIRE_LOG(Debug, "Splitting chunk " << chunk->size << "into " << rounded_bytes << " and " << remaining);
 
-    if (split_chunk->next)
-      split_chunk->next->prev = split_chunk;
+  void* chunk_storage{m_chunk_pool.allocate()};
+  Chunk* split_chunk{new (chunk_storage)
+                         Chunk{static_cast<char*>(chunk->data) + rounded_bytes, remaining, chunk->chunk_size}};
+  split_chunk->decommitted = chunk->decommitted;
 
-    chunk->size = rounded_bytes;
-    split_chunk->size_map_it = m_size_map.insert(std::make_pair(remaining, split_chunk));
-  }
+  auto old_next = chunk->next;
+  chunk->next = split_chunk;
+  split_chunk->prev = chunk;
+  split_chunk->next = old_next;
 
-  m_current_bytes += rounded_bytes;
+  if (split_chunk->next)
+    split_chunk->next->prev = split_chunk;
 
-  UMPIRE_UNPOISON_MEMORY_REGION(m_allocator, ret, bytes);
-  return ret;
+  chunk->size = rounded_bytes;
+
+  return split_chunk;
 }
 
 void QuickPool::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
 {
   UMPIRE_LOG(Debug, "(ptr=" << ptr << ")");
+
+  free_chunk(ptr);
+  check_coalesce();
+}
+
+void QuickPool::deallocate_batch(void* const* ptrs, const std::size_t* UMPIRE_UNUSED_ARG(sizes), std::size_t count)
+{
+  UMPIRE_LOG(Debug, "(count=" << count << ")");
+
+  for (std::size_t i = 0; i < count; ++i) {
+    free_chunk(ptrs[i]);
+  }
+
+  // The heuristic is only checked once the whole batch is free
+  check_coalesce();
+}
+
+void QuickPool::check_coalesce()
+{
+  // The deallocation made by a coalesce may meet the heuristic again
+  if (m_is_coalescing) {
+    return;
+  }
+
+  // Decommitting the chunk that was just freed would only fault its pages
+  // back in when it is next used, so the decommit modes give memory back on
+  // release and coalesce alone
+  if (m_release_mode != release_mode::deallocate) {
+    return;
+  }
+
+  if (0 != m_pending_coalesce_size) {
+    coalesce_step();
+    return;
+  }
+
+  std::size_t suggested_size{m_should_coalesce(*this)};
+  if (0 != suggested_size) {
+    UMPIRE_LOG(Debug, "coalesce heuristic true, performing coalesce.");
+    if (0 == m_coalesce_budget.count()) {
+      do_coalesce(suggested_size);
+    } else if (m_size_map.size() > 1 || is_release_only_coalesce(suggested_size, m_current_bytes)) {
+      m_pending_coalesce_size = suggested_size;
+      coalesce_step();
+    }
+  }
+}
+
+void QuickPool::free_chunk(void* ptr)
+{
   auto chunk = (*m_pointer_map.find(ptr)).second;
   chunk->free = true;
+  chunk->decommitted = false;
 
   m_current_bytes -= chunk->size;
 
@@ -153,6 +274,7 @@ void QuickPool::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
 
     prev->size += chunk->size;
     prev->next = chunk->next;
+    prev->decommitted = false;
 
     if (prev->next)
       prev->next->prev = prev;
@@ -190,15 +312,92 @@ void QuickPool::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
   chunk->size_map_it = m_size_map.insert(std::make_pair(chunk->size, chunk));
   // can do this with iterator?
   m_pointer_map.erase(ptr);
+}
 
-  std::size_t suggested_size{m_should_coalesce(*this)};
-  if (0 != suggested_size) {
-    UMPIRE_LOG(Debug, "coalesce heuristic true, performing coalesce.");
-    do_coalesce(suggested_size);
+bool QuickPool::try_resize(void* ptr, std::size_t UMPIRE_UNUSED_ARG(old_size), std::size_t new_size)
+{
+  UMPIRE_LOG(Debug, "(ptr=" << ptr << ", new_size=" << new_size << ")");
+
+  auto it = m_pointer_map.find(ptr);
+  if (it == m_pointer_map.end() || new_size == 0) {
+    return false;
   }
+
+  Chunk* chunk{it->second};
+  const std::size_t rounded_bytes{aligned_round_up(new_size)};
+  Chunk* next{chunk->next};
+  const bool next_free{next && next->free};
+
+  if (rounded_bytes > chunk->size) {
+    const std::size_t extra{rounded_bytes - chunk->size};
+
+    if (!next_free || next->size < extra) {
+      return false;
+    }
+
+    m_size_map.erase(next->size_map_it);
+
+    if (next->size == extra) {
+      UMPIRE_LOG(Debug, "Merging chunk " << next << " into " << chunk);
+      chunk->next = next->next;
+      if (chunk->next)
+        chunk->next->prev = chunk;
+      m_chunk_pool.deallocate(next);
+    } else {
+      UMPIRE_LOG(Debug, "Taking " << extra << " bytes from chunk " << next);
+      next->data = static_cast<char*>(next->data) + extra;
+      next->size -= extra;
+      next->size_map_it = m_size_map.insert(std::make_pair(next->size, next));
+    }
+
+    m_current_bytes += extra;
+  } else if (rounded_bytes < chunk->size) {
+    const std::size_t remaining{chunk->size - rounded_bytes};
+    void* tail{static_cast<char*>(chunk->data) + rounded_bytes};
+
+    UMPIRE_POISON_MEMORY_REGION(m_allocator, tail, remaining);
+
+    if (next_free) {
+      UMPIRE_LOG(Debug, "Giving " << remaining << " bytes to chunk " << next);
+      m_size_map.erase(next->size_map_it);
+      next->data = tail;
+      next->size += remaining;
+      next->decommitted = false;
+      next->size_map_it = m_size_map.insert(std::make_pair(next->size, next));
+    } else {
+      UMPIRE_LOG(Debug, "Splitting chunk " << chunk->size << " into " << rounded_bytes << " and " << remaining);
+      void* chunk_storage{m_chunk_pool.allocate()};
+      Chunk* split_chunk{new (chunk_storage) Chunk{tail, remaining, chunk->chunk_size}};
+
+      split_chunk->prev = chunk;
+      split_chunk->next = next;
+      if (next)
+        next->prev = split_chunk;
+      chunk->next = split_chunk;
+
+      split_chunk->size_map_it = m_size_map.insert(std::make_pair(remaining, split_chunk));
+    }
+
+    m_current_bytes -= remaining;
+  }
+
+  chunk->size = rounded_bytes;
+  UMPIRE_UNPOISON_MEMORY_REGION(m_allocator, ptr, new_size);
+
+  return true;
 }
 
 void QuickPool::release()
+{
+  if (m_release_mode != release_mode::deallocate && !m_is_destructing) {
+    decommit_free_chunks();
+    return;
+  }
+
+  release_blocks();
+}
+
+void QuickPool::release_blocks()
 {
   UMPIRE_LOG(Debug, "() " << m_size_map.size() << " chunks in free map, m_is_destructing set to " << m_is_destructing);
 
@@ -210,28 +409,7 @@ void QuickPool::release()
     auto chunk = (*pair).second;
     UMPIRE_LOG(Debug, "Found chunk @ " << chunk->data);
     if ((chunk->size == chunk->chunk_size) && chunk->free) {
-      UMPIRE_LOG(Debug, "Releasing chunk " << chunk->data);
-
-      m_actual_bytes -= chunk->chunk_size;
-      m_releasable_bytes -= chunk->chunk_size;
-      m_releasable_blocks--;
-      m_total_blocks--;
-
-      try {
-        aligned_deallocate(chunk->data);
-      } catch (...) {
-        if (m_is_destructing) {
-          //
-          // Ignore error in case the underlying vendor API has already shutdown
-          //
-          UMPIRE_LOG(Error, "Pool is destructing, runtime_error Ignored");
-        } else {
-          throw;
-        }
-      }
-
-      m_chunk_pool.deallocate(chunk);
-      pair = m_size_map.erase(pair);
+      pair = release_chunk(pair);
     } else {
       ++pair;
     }
@@ -247,11 +425,92 @@ void QuickPool::release()
 #endif
 }
 
+QuickPool::SizeMap::iterator QuickPool::release_chunk(SizeMap::iterator it)
+{
+  auto chunk = (*it).second;
+  UMPIRE_LOG(Debug, "Releasing chunk " << chunk->data);
+
+  m_actual_bytes -= chunk->chunk_size;
+  m_releasable_bytes -= chunk->chunk_size;
+  m_releasable_blocks--;
+  m_total_blocks--;
+
+  try {
+    aligned_deallocate(chunk->data);
+  } catch (...) {
+    if (m_is_destructing) {
+      //
+      // Ignore error in case the underlying vendor API has already shutdown
+      //
+      UMPIRE_LOG(Error, "Pool is destructing, runtime_error Ignored");
+    } else {
+      throw;
+    }
+  }
+
+  m_chunk_pool.deallocate(chunk);
+  return m_size_map.erase(it);
+}
+
+void QuickPool::decommit_free_chunks() noexcept
+{
+#if !defined(_WIN32)
+  static const std::uintptr_t page_size{static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE))};
+
+  int advice{MADV_DONTNEED};
+#if defined(MADV_FREE)
+  if (m_release_mode == release_mode::lazy_decommit) {
+    advice = MADV_FREE;
+  }
+#endif
+
+  std::size_t decommitted_bytes{0};
+
+  for (auto& pair : m_size_map) {
+    Chunk* chunk{pair.second};
+    if (chunk->decommitted) {
+      continue;
+    }
+
+    // Only the pages that lie entirely within the chunk can be given back
+    const std::uintptr_t data{reinterpret_cast<std::uintptr_t>(chunk->data)};
+    const std::uintptr_t begin{(data + page_size - 1) & ~(page_size - 1)};
+    const std::uintptr_t end{(data + chunk->size) & ~(page_size - 1)};
+
+    if (begin < end) {
+      int rc{::madvise(reinterpret_cast<void*>(begin), end - begin, advice)};
+      if (rc != 0 && advice != MADV_DONTNEED && errno == EINVAL) {
+        // MADV_FREE is not supported by kernels older than 4.5
+        advice = MADV_DONTNEED;
+        rc = ::madvise(reinterpret_cast<void*>(begin), end - begin, advice);
+      }
+
+      if (rc != 0) {
+        UMPIRE_LOG(Debug, "madvise( ptr = " << reinterpret_cast<void*>(begin) << ", bytes = " << (end - begin)
+                                            << " ) failed: " << strerror(errno));
+        continue;
+      }
+
+      decommitted_bytes += end - begin;
+    }
+
+    chunk->decommitted = true;
+  }
+
+  UMPIRE_LOG(Debug, "Decommitted " << decommitted_bytes << " bytes");
+#endif
+}
+
 std::size_t QuickPool::getReleasableBlocks() const noexcept
 {
   return m_releasable_blocks;
 }
 
+bool QuickPool::owns(const void* ptr) const noexcept
+{
+  return m_pointer_map.find(const_cast<void*>(ptr)) != m_pointer_map.end();
+}
+
 std::size_t QuickPool::getTotalBlocks() const noexcept
 {
   return m_total_blocks;
@@ -322,8 +581,29 @@ void QuickPool::coalesce() noexcept
 
 void QuickPool::do_coalesce(std::size_t suggested_size) noexcept
 {
+  // The deallocation below may meet the heuristic again
+  if (m_is_coalescing) {
+    return;
+  }
+
+  // A full coalesce finishes any coalesce spread over deallocations
+  m_pending_coalesce_size = 0;
+
+  // Blocks are kept when decommitting, so there is nothing to merge
+  if (m_release_mode != release_mode::deallocate) {
+    decommit_free_chunks();
+    return;
+  }
+
+  if (is_release_only_coalesce(suggested_size, m_current_bytes)) {
+    UMPIRE_LOG(Debug, "releasing free blocks, suggested size is " << suggested_size);
+    release();
+    return;
+  }
+
   if (m_size_map.size() > 1) {
     UMPIRE_LOG(Debug, "()");
+    m_is_coalescing = true;
     release();
     std::size_t size_post{getActualSize()};
 
@@ -334,7 +614,100 @@ void QuickPool::do_coalesce(std::size_t suggested_size) noexcept
       auto ptr = allocate(alloc_size);
       deallocate(ptr, alloc_size);
     }
+    m_is_coalescing = false;
+  }
+}
+
+void QuickPool::coalesce_step()
+{
+  using clock = std::chrono::steady_clock;
+  const auto deadline = clock::now() + m_coalesce_budget;
+  bool released{false};
+
+  for (auto pair = m_size_map.begin(); pair != m_size_map.end();) {
+    auto chunk = (*pair).second;
+    if ((chunk->size == chunk->chunk_size) && chunk->free) {
+      if (released && clock::now() >= deadline) {
+        UMPIRE_LOG(Debug, "coalesce budget spent, " << m_releasable_blocks << " releasable blocks left");
+        return;
+      }
+      pair = release_chunk(pair);
+      released = true;
+    } else {
+      ++pair;
+    }
+  }
+
+  // Allocating the coalesced block is not held back by the budget: a
+  // workload that grows the pool between steps would otherwise keep the
+  // coalesce from ever finishing
+  const std::size_t suggested_size{m_pending_coalesce_size};
+  const std::size_t size_post{getActualSize()};
+  m_pending_coalesce_size = 0;
+
+  if (size_post < suggested_size && !is_release_only_coalesce(suggested_size, m_current_bytes)) {
+    std::size_t alloc_size{suggested_size - size_post};
+
+    UMPIRE_LOG(Debug, "coalescing " << alloc_size << " bytes.");
+    m_is_coalescing = true;
+    try {
+      auto ptr = allocate(alloc_size);
+      deallocate(ptr, alloc_size);
+    } catch (...) {
+      // The pool is still usable, it just keeps the blocks it has
+      UMPIRE_LOG(Warning, "Could not allocate the coalesced block of " << alloc_size << " bytes");
+    }
+    m_is_coalescing = false;
+  }
+}
+
+void QuickPool::setCoalesceBudget(std::chrono::nanoseconds budget) noexcept
+{
+  m_coalesce_budget = budget;
+}
+
+std::chrono::nanoseconds QuickPool::getCoalesceBudget() const noexcept
+{
+  return m_coalesce_budget;
+}
+
+bool QuickPool::isCoalescePending() const noexcept
+{
+  return 0 != m_pending_coalesce_size;
+}
+
+void QuickPool::setReleaseMode(release_mode mode)
+{
+  if (mode != release_mode::deallocate) {
+#if defined(_WIN32)
+    UMPIRE_ERROR(runtime_error, fmt::format("Pool \"{}\" cannot decommit memory on Windows", getName()));
+#endif
+    if (getTraits().resource != MemoryResourceTraits::resource_type::host) {
+      UMPIRE_ERROR(runtime_error,
+                   fmt::format("Pool \"{}\" does not allocate host memory, and cannot decommit it", getName()));
+    }
+
+    // Decommitting keeps the blocks, so a coalesce in progress is dropped
+    m_pending_coalesce_size = 0;
+  }
+
+  m_release_mode = mode;
+}
+
+QuickPool::release_mode QuickPool::getReleaseMode() const noexcept
+{
+  return m_release_mode;
+}
+
+std::size_t QuickPool::getDecommittedSize() const noexcept
+{
+  std::size_t size{0};
+  for (const auto& pair : m_size_map) {
+    if (pair.second->decommitted) {
+      size += pair.second->size;
+    }
   }
+  return size;
 }
 
 PoolCoalesceHeuristic<QuickPool> QuickPool::blocks_releasable(std::size_t nblocks)
@@ -7,6 +7,7 @@
 #ifndef UMPIRE_QuickPool_HPP
 #define UMPIRE_QuickPool_HPP
 
+#include <chrono>
 #include <functional>
 #include <map>
 #include <memory>
@@ -43,6 +44,19 @@ class QuickPool : public AllocationStrategy, private mixins::AlignedAllocation {
   static constexpr std::size_t s_default_next_block_size{1 * 1024 * 1024};
   static constexpr std::size_t s_default_alignment{16};
 
+  /*!
+   * \brief How the pool gives memory back when it is released or coalesced.
+   *
+   * deallocate returns whole free blocks to the allocator. decommit and
+   * lazy_decommit keep every block, and so the address range of the pool, but
+   * give the physical pages of free chunks back to the operating system with
+   * madvise(MADV_DONTNEED) or madvise(MADV_FREE). The pages are faulted back in
+   * when the memory is next used, which is much cheaper than growing the pool
+   * again. MADV_FREE only reclaims the pages when the system is short of
+   * memory, so the resident size of the process may not drop straight away.
+   */
+  enum class release_mode { deallocate, decommit, lazy_decommit };
+
   /*!
    * \brief Construct a new QuickPool.
    *
@@ -69,6 +83,23 @@ class QuickPool : public AllocationStrategy, private mixins::AlignedAllocation {
   void deallocate(void* ptr, std::size_t size) override;
   void release() override;
 
+  /*!
+   * \brief Allocate all of the buffers from one free chunk, growing the pool
+   * at most once.
+   */
+  void allocate_batch(const std::size_t* sizes, std::size_t count, void** ptrs) override;
+
+  /*!
+   * \brief Free all of the buffers before checking the coalesce heuristic.
+   */
+  void deallocate_batch(void* const* ptrs, const std::size_t* sizes, std::size_t count) override;
+
+  /*!
+   * \brief Grow an allocation into the free chunk that follows it, or return
+   * the end of the allocation to the pool.
+   */
+  bool try_resize(void* ptr, std::size_t old_size, std::size_t new_size) override;
+
   std::size_t getActualSize() const noexcept override;
   std::size_t getCurrentSize() const noexcept override;
   std::size_t getReleasableSize() const noexcept;
@@ -98,9 +129,61 @@ class QuickPool : public AllocationStrategy, private mixins::AlignedAllocation {
   std::size_t getReleasableBlocks() const noexcept;
   std::size_t getTotalBlocks() const noexcept;
 
+  /*!
+   * \brief Return whether ptr was allocated by this pool and has not been
+   * deallocated yet.
+   */
+  bool owns(const void* ptr) const noexcept;
+
   void coalesce() noexcept;
   void do_coalesce(std::size_t suggested_size) noexcept;
 
+  /*!
+   * \brief Spread coalescing over several deallocations, spending at most
+   * budget in each of them.
+   *
+   * By default the deallocation that meets the coalesce heuristic releases
+   * every free block and allocates the coalesced block before returning.
+   * With a non-zero budget, that deallocation and the ones after it each
+   * release free blocks until the budget is spent, and the coalesced block
+   * is allocated once none are left. Every step releases at least one
+   * block, so coalescing always finishes.
+   *
+   * \param budget Time each deallocation may spend coalescing, or zero to
+   * coalesce all at once.
+   */
+  void setCoalesceBudget(std::chrono::nanoseconds budget) noexcept;
+  std::chrono::nanoseconds getCoalesceBudget() const noexcept;
+
+  /*!
+   * \brief Return whether a coalesce spread over deallocations is still in
+   * progress.
+   */
+  bool isCoalescePending() const noexcept;
+
+  /*!
+   * \brief Set how release and coalesce give memory back.
+   *
+   * The decommit modes are only available for pools of host memory. In these
+   * modes release and coalesce decommit every free chunk, whole blocks
+   * included, and the blocks themselves are only freed when the pool is
+   * destroyed or when the allocator fails to grow the pool. The coalesce
+   * heuristic is not checked on deallocation, so the pages of a free chunk
+   * are decommitted once, by the next release or coalesce, rather than on
+   * every deallocation that meets the heuristic.
+   *
+   * \throws umpire::runtime_error if mode is a decommit mode and the pool
+   * does not allocate host memory.
+   */
+  void setReleaseMode(release_mode mode);
+  release_mode getReleaseMode() const noexcept;
+
+  /*!
+   * \brief Return the number of bytes in free chunks whose pages have been
+   * decommitted and not used since.
+   */
+  std::size_t getDecommittedSize() const noexcept;
+
  private:
   struct Chunk;
 
@@ -146,11 +229,41 @@ class QuickPool : public AllocationStrategy, private mixins::AlignedAllocation {
     std::size_t size{0};
     std::size_t chunk_size{0};
     bool free{true};
+    bool decommitted{false};
     Chunk* prev{nullptr};
     Chunk* next{nullptr};
     SizeMap::iterator size_map_it;
   };
 
+  // Remove a free chunk of at least rounded_bytes from the size map, or
+  // allocate a new block for one
+  Chunk* take_chunk(std::size_t rounded_bytes);
+
+  // Hand out the start of chunk for an allocation of bytes
+  void* use_chunk(Chunk* chunk, std::size_t rounded_bytes, std::size_t bytes);
+
+  // Shrink chunk to rounded_bytes, returning the rest of it as a new free
+  // chunk that is not yet in the size map, or nullptr if nothing is left
+  Chunk* split(Chunk* chunk, std::size_t rounded_bytes);
+
+  // Return the chunk at ptr to the pool, merging it with free neighbours
+  void free_chunk(void* ptr);
+
+  // Free a whole block that is in the size map, returning the next entry
+  SizeMap::iterator release_chunk(SizeMap::iterator it);
+
+  // Free every whole block that is in the size map
+  void release_blocks();
+
+  // Give the pages of every free chunk back to the operating system
+  void decommit_free_chunks() noexcept;
+
+  // Check the coalesce heuristic after memory has been returned to the pool
+  void check_coalesce();
+
+  // Continue a coalesce within the budget
+  void coalesce_step();
+
   PointerMap m_pointer_map{};
   SizeMap m_size_map{};
 
@@ -167,7 +280,11 @@ class QuickPool : public AllocationStrategy, private mixins::AlignedAllocation {
   std::size_t m_current_bytes{0};
   std::size_t m_releasable_bytes{0};
   std::size_t m_actual_highwatermark{0};
+  std::chrono::nanoseconds m_coalesce_budget{0};
+  std::size_t m_pending_coalesce_size{0};
+  release_mode m_release_mode{release_mode::deallocate};
   bool m_is_destructing{false};
+  bool m_is_coalescing{false};
 };
 
 std::ostream& operator<<(std::ostream& out, umpire::strategy::PoolCoalesceHeuristic<QuickPool>&);
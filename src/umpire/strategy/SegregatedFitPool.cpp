@@ -0,0 +1,566 @@
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+
+#include "umpire/strategy/SegregatedFitPool.hpp"
+
+#include "umpire/Allocator.hpp"
+#include "umpire/strategy/PoolCoalesceHeuristic.hpp"
+#include "umpire/strategy/mixins/AlignedAllocation.hpp"
+#include "umpire/util/Macros.hpp"
+#include "umpire/util/find_first_set.hpp"
+#include "umpire/util/memory_sanitizers.hpp"
+
+namespace umpire {
+namespace strategy {
+
+namespace {
+
+// Index of the most significant bit set in n, which must be non-zero
+inline unsigned int most_significant_bit(std::size_t n) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<unsigned int>(sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(n));
+#else
+  unsigned int bit{0};
+  while (n >>= 1)
+    ++bit;
+  return bit;
+#endif
+}
+
+// Index of the least significant bit set in bits, which must be non-zero
+inline unsigned int least_significant_bit(std::uint32_t bits) noexcept
+{
+  return static_cast<unsigned int>(util::find_first_set(static_cast<int>(bits)) - 1);
+}
+
+inline unsigned int least_significant_bit(std::uint64_t bits) noexcept
+{
+  const std::uint32_t low{static_cast<std::uint32_t>(bits)};
+  return low ? least_significant_bit(low) : 32 + least_significant_bit(static_cast<std::uint32_t>(bits >> 32));
+}
+
+} // end of anonymous namespace
+
+constexpr unsigned int SegregatedFitPool::s_sl_log2;
+constexpr unsigned int SegregatedFitPool::s_sl_count;
+constexpr unsigned int SegregatedFitPool::s_fl_count;
+
+//
+// Sizes below s_sl_count each get a list of their own in the first row.
+// Larger sizes map to row (msb - s_sl_log2 + 1), and the s_sl_log2 bits below
+// the most significant bit select the list within the row.
+//
+void SegregatedFitPool::mapping(std::size_t size, unsigned int& fl, unsigned int& sl) noexcept
+{
+  if (size < s_sl_count) {
+    fl = 0;
+    sl = static_cast<unsigned int>(size);
+  } else {
+    const unsigned int msb{most_significant_bit(size)};
+    fl = msb - s_sl_log2 + 1;
+    sl = static_cast<unsigned int>(size >> (msb - s_sl_log2)) - s_sl_count;
+  }
+}
+
+SegregatedFitPool::SegregatedFitPool(const std::string& name, int id, Allocator allocator,
+                                     const std::size_t first_minimum_pool_allocation_size,
+                                     const std::size_t next_minimum_pool_allocation_size, std::size_t alignment,
+                                     PoolCoalesceHeuristic<SegregatedFitPool> should_coalesce) noexcept
+    : AllocationStrategy{name, id, allocator.getAllocationStrategy(), "SegregatedFitPool"},
+      mixins::AlignedAllocation{alignment, allocator.getAllocationStrategy()},
+      m_should_coalesce{should_coalesce},
+      m_first_minimum_pool_allocation_size{first_minimum_pool_allocation_size},
+      m_next_minimum_pool_allocation_size{next_minimum_pool_allocation_size}
+{
+  UMPIRE_LOG(Debug, " ( "
+                        << "name=\"" << name << "\""
+                        << ", id=" << id << ", allocator=\"" << allocator.getName() << "\""
+                        << ", first_minimum_pool_allocation_size=" << m_first_minimum_pool_allocation_size
+                        << ", next_minimum_pool_allocation_size=" << m_next_minimum_pool_allocation_size
+                        << ", alignment=" << alignment << " )");
+}
+
+SegregatedFitPool::~SegregatedFitPool()
+{
+  UMPIRE_LOG(Debug, "Releasing free blocks to device");
+  m_is_destructing = true;
+  release();
+}
+
+void* SegregatedFitPool::allocate(std::size_t bytes)
+{
+  UMPIRE_LOG(Debug, "(bytes=" << bytes << ")");
+  const std::size_t rounded_bytes{aligned_round_up(bytes)};
+  Chunk* chunk{findFree(rounded_bytes)};
+
+  if (chunk == nullptr) {
+    std::size_t bytes_to_use{(m_actual_bytes == 0) ? m_first_minimum_pool_allocation_size
+                                                   : m_next_minimum_pool_allocation_size};
+
+    std::size_t size{(rounded_bytes > bytes_to_use) ? rounded_bytes : bytes_to_use};
+
+    UMPIRE_LOG(Debug, "Allocating new chunk of size " << size);
+
+    void* ret{nullptr};
+    try {
+#if defined(UMPIRE_ENABLE_BACKTRACE)
+      {
+        umpire::util::backtrace bt;
+        umpire::util::backtracer<>::get_backtrace(bt);
+        UMPIRE_LOG(Info, "actual_size:" << (m_actual_bytes + rounded_bytes) << " (prev: " << m_actual_bytes << ") "
+                                        << umpire::util::backtracer<>::print(bt));
+      }
+#endif
+      ret = aligned_allocate(size); // Will Poison
+    } catch (...) {
+      UMPIRE_LOG(Error,
+                 "Caught error allocating new chunk, giving up free chunks and "
+                 "retrying...");
+      release();
+      try {
+        ret = aligned_allocate(size); // Will Poison
+        UMPIRE_LOG(Debug, "memory reclaimed, chunk successfully allocated.");
+      } catch (...) {
+        UMPIRE_LOG(Error, "recovery failed.");
+        throw;
+      }
+    }
+
+    m_actual_bytes += size;
+    m_releasable_bytes += size;
+    m_releasable_blocks++;
+    m_total_blocks++;
+    m_actual_highwatermark = (m_actual_bytes > m_actual_highwatermark) ? m_actual_bytes : m_actual_highwatermark;
+
+    void* chunk_storage{m_chunk_pool.allocate()};
+    chunk = new (chunk_storage) Chunk{ret, size, size};
+  } else {
+    removeFree(chunk);
+  }
+
+  UMPIRE_LOG(Debug, "Using chunk " << chunk << " with data " << chunk->data << " and size " << chunk->size
+                                   << " for allocation of size " << rounded_bytes);
+
+  if ((chunk->size == chunk->chunk_size) && chunk->free) {
+    m_releasable_bytes -= chunk->chunk_size;
+    m_releasable_blocks--;
+  }
+
+  void* ret = chunk->data;
+  m_pointer_map.insert(std::make_pair(ret, chunk));
+
+  chunk->free = false;
+
+  if (rounded_bytes != chunk->size) {
+    std::size_t remaining{chunk->size - rounded_bytes};
+    UMPIRE_LOG(Debug, "Splitting chunk " << chunk->size << "into " << rounded_bytes << " and " << remaining);
+
+    void* chunk_storage{m_chunk_pool.allocate()};
+    Chunk* split_chunk{new (chunk_storage)
+                           Chunk{static_cast<char*>(ret) + rounded_bytes, remaining, chunk->chunk_size}};
+
+    auto old_next = chunk->next;
+    chunk->next = split_chunk;
+    split_chunk->prev = chunk;
+    split_chunk->next = old_next;
+
+    if (split_chunk->next)
+      split_chunk->next->prev = split_chunk;
+
+    chunk->size = rounded_bytes;
+    insertFree(split_chunk);
+  }
+
+  m_current_bytes += rounded_bytes;
+
+  UMPIRE_UNPOISON_MEMORY_REGION(m_allocator, ret, bytes);
+  return ret;
+}
+
+void SegregatedFitPool::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
+{
+  UMPIRE_LOG(Debug, "(ptr=" << ptr << ")");
+  auto chunk = (*m_pointer_map.find(ptr)).second;
+  chunk->free = true;
+
+  m_current_bytes -= chunk->size;
+
+  UMPIRE_LOG(Debug, "Deallocating data held by " << chunk);
+
+  UMPIRE_POISON_MEMORY_REGION(m_allocator, ptr, chunk->size);
+
+  if (chunk->prev && chunk->prev->free == true) {
+    auto prev = chunk->prev;
+    UMPIRE_LOG(Debug, "Removing chunk" << prev << " from free lists");
+
+    removeFree(prev);
+
+    prev->size += chunk->size;
+    prev->next = chunk->next;
+
+    if (prev->next)
+      prev->next->prev = prev;
+
+    UMPIRE_LOG(Debug, "Merging with prev" << prev << " and " << chunk);
+    UMPIRE_LOG(Debug, "New size: " << prev->size);
+
+    m_chunk_pool.deallocate(chunk);
+    chunk = prev;
+  }
+
+  if (chunk->next && chunk->next->free == true) {
+    auto next = chunk->next;
+    chunk->size += next->size;
+    chunk->next = next->next;
+    if (chunk->next)
+      chunk->next->prev = chunk;
+
+    UMPIRE_LOG(Debug, "Merging with next" << chunk << " and " << next);
+    UMPIRE_LOG(Debug, "New size: " << chunk->size);
+
+    UMPIRE_LOG(Debug, "Removing chunk" << next << " from free lists");
+    removeFree(next);
+
+    m_chunk_pool.deallocate(next);
+  }
+
+  UMPIRE_LOG(Debug, "Inserting chunk " << chunk << " with size " << chunk->size);
+
+  if (chunk->size == chunk->chunk_size) {
+    m_releasable_blocks++;
+    m_releasable_bytes += chunk->chunk_size;
+  }
+
+  insertFree(chunk);
+  m_pointer_map.erase(ptr);
+
+  // The deallocation made by a coalesce may meet the heuristic again
+  if (m_is_coalescing) {
+    return;
+  }
+
+  std::size_t suggested_size{m_should_coalesce(*this)};
+  if (0 != suggested_size) {
+    UMPIRE_LOG(Debug, "coalesce heuristic true, performing coalesce.");
+    do_coalesce(suggested_size);
+  }
+}
+
+void SegregatedFitPool::release()
+{
+  UMPIRE_LOG(Debug, "() " << m_free_chunks << " chunks in free lists, m_is_destructing set to " << m_is_destructing);
+
+#if defined(UMPIRE_ENABLE_BACKTRACE)
+  std::size_t prev_size{m_actual_bytes};
+#endif
+
+  for (unsigned int fl = 0; fl < s_fl_count; ++fl) {
+    for (unsigned int sl = 0; sl < s_sl_count; ++sl) {
+      Chunk* next_free{m_free_lists[fl][sl]};
+
+      while (next_free) {
+        Chunk* chunk{next_free};
+        next_free = chunk->next_free;
+
+        UMPIRE_LOG(Debug, "Found chunk @ " << chunk->data);
+        if ((chunk->size == chunk->chunk_size) && chunk->free) {
+          UMPIRE_LOG(Debug, "Releasing chunk " << chunk->data);
+
+          m_actual_bytes -= chunk->chunk_size;
+          m_releasable_bytes -= chunk->chunk_size;
+          m_releasable_blocks--;
+          m_total_blocks--;
+
+          try {
+            aligned_deallocate(chunk->data);
+          } catch (...) {
+            if (m_is_destructing) {
+              //
+              // Ignore error in case the underlying vendor API has already shutdown
+              //
+              UMPIRE_LOG(Error, "Pool is destructing, runtime_error Ignored");
+            } else {
+              throw;
+            }
+          }
+
+          removeFree(chunk);
+          m_chunk_pool.deallocate(chunk);
+        }
+      }
+    }
+  }
+
+#if defined(UMPIRE_ENABLE_BACKTRACE)
+  if (prev_size > m_actual_bytes) {
+    umpire::util::backtrace bt;
+    umpire::util::backtracer<>::get_backtrace(bt);
+    UMPIRE_LOG(Info, "actual_size:" << m_actual_bytes << " (prev: " << prev_size << ") "
+                                    << umpire::util::backtracer<>::print(bt));
+  }
+#endif
+}
+
+std::size_t SegregatedFitPool::getReleasableBlocks() const noexcept
+{
+  return m_releasable_blocks;
+}
+
+std::size_t SegregatedFitPool::getTotalBlocks() const noexcept
+{
+  return m_total_blocks;
+}
+
+std::size_t SegregatedFitPool::getActualSize() const noexcept
+{
+  return m_actual_bytes;
+}
+
+std::size_t SegregatedFitPool::getCurrentSize() const noexcept
+{
+  return m_current_bytes;
+}
+
+std::size_t SegregatedFitPool::getReleasableSize() const noexcept
+{
+  return m_releasable_bytes;
+}
+
+std::size_t SegregatedFitPool::getActualHighwaterMark() const noexcept
+{
+  return m_actual_highwatermark;
+}
+
+Platform SegregatedFitPool::getPlatform() noexcept
+{
+  return m_allocator->getPlatform();
+}
+
+MemoryResourceTraits SegregatedFitPool::getTraits() const noexcept
+{
+  return m_allocator->getTraits();
+}
+
+bool SegregatedFitPool::tracksMemoryUse() const noexcept
+{
+  return false;
+}
+
+std::size_t SegregatedFitPool::getBlocksInPool() const noexcept
+{
+  return m_pointer_map.size() + m_free_chunks;
+}
+
+std::size_t SegregatedFitPool::getLargestAvailableBlock() noexcept
+{
+  if (m_fl_bitmap == 0) {
+    return 0;
+  }
+
+  const unsigned int fl{most_significant_bit(m_fl_bitmap)};
+  const unsigned int sl{most_significant_bit(m_sl_bitmap[fl])};
+
+  // Chunks in the highest non-empty list are not ordered by size
+  std::size_t largest{0};
+  for (Chunk* chunk = m_free_lists[fl][sl]; chunk; chunk = chunk->next_free) {
+    largest = (chunk->size > largest) ? chunk->size : largest;
+  }
+  return largest;
+}
+
+void SegregatedFitPool::coalesce() noexcept
+{
+  UMPIRE_LOG(Debug, "()");
+
+  umpire::event::record([&](auto& event) {
+    event.name("coalesce").category(event::category::operation).tag("allocator_name", getName()).tag("replay", "true");
+  });
+
+  std::size_t suggested_size{m_should_coalesce(*this)};
+  if (0 != suggested_size) {
+    UMPIRE_LOG(Debug, "coalesce heuristic true, performing coalesce, suggested size is " << suggested_size);
+    do_coalesce(suggested_size);
+  }
+}
+
+void SegregatedFitPool::do_coalesce(std::size_t suggested_size) noexcept
+{
+  // The deallocation below may meet the heuristic again
+  if (m_is_coalescing) {
+    return;
+  }
+
+  if (is_release_only_coalesce(suggested_size, m_current_bytes)) {
+    UMPIRE_LOG(Debug, "releasing free blocks, suggested size is " << suggested_size);
+    release();
+    return;
+  }
+
+  if (m_free_chunks > 1) {
+    UMPIRE_LOG(Debug, "()");
+    m_is_coalescing = true;
+    release();
+    std::size_t size_post{getActualSize()};
+
+    if (size_post < suggested_size) {
+      std::size_t alloc_size{suggested_size - size_post};
+
+      UMPIRE_LOG(Debug, "coalescing " << alloc_size << " bytes.");
+      auto ptr = allocate(alloc_size);
+      deallocate(ptr, alloc_size);
+    }
+    m_is_coalescing = false;
+  }
+}
+
+void SegregatedFitPool::insertFree(Chunk* chunk) noexcept
+{
+  unsigned int fl, sl;
+  mapping(chunk->size, fl, sl);
+
+  Chunk*& head = m_free_lists[fl][sl];
+  chunk->prev_free = nullptr;
+  chunk->next_free = head;
+  if (head)
+    head->prev_free = chunk;
+  head = chunk;
+
+  m_fl_bitmap |= std::uint64_t{1} << fl;
+  m_sl_bitmap[fl] |= std::uint32_t{1} << sl;
+  m_free_chunks++;
+}
+
+void SegregatedFitPool::removeFree(Chunk* chunk) noexcept
+{
+  unsigned int fl, sl;
+  mapping(chunk->size, fl, sl);
+
+  if (chunk->next_free)
+    chunk->next_free->prev_free = chunk->prev_free;
+
+  if (chunk->prev_free) {
+    chunk->prev_free->next_free = chunk->next_free;
+  } else {
+    m_free_lists[fl][sl] = chunk->next_free;
+    if (m_free_lists[fl][sl] == nullptr) {
+      m_sl_bitmap[fl] &= ~(std::uint32_t{1} << sl);
+      if (m_sl_bitmap[fl] == 0)
+        m_fl_bitmap &= ~(std::uint64_t{1} << fl);
+    }
+  }
+
+  chunk->prev_free = nullptr;
+  chunk->next_free = nullptr;
+  m_free_chunks--;
+}
+
+SegregatedFitPool::Chunk* SegregatedFitPool::findFree(std::size_t bytes) noexcept
+{
+  unsigned int fl, sl;
+  mapping(bytes, fl, sl);
+
+  //
+  // The list that bytes maps to may hold chunks smaller than bytes, so only
+  // its first chunk is considered. This keeps exact-size reuse cheap.
+  //
+  Chunk* head{m_free_lists[fl][sl]};
+  if (head && head->size >= bytes) {
+    return head;
+  }
+
+  //
+  // Every chunk in the lists after the one bytes maps to is large enough.
+  //
+  if (++sl == s_sl_count) {
+    sl = 0;
+    ++fl;
+  }
+
+  if (fl >= s_fl_count) {
+    return nullptr;
+  }
+
+  std::uint32_t sl_bitmap{m_sl_bitmap[fl] & (~std::uint32_t{0} << sl)};
+
+  if (sl_bitmap == 0) {
+    const std::uint64_t fl_bitmap{(fl + 1 < s_fl_count) ? (m_fl_bitmap & (~std::uint64_t{0} << (fl + 1))) : 0};
+    if (fl_bitmap == 0) {
+      return nullptr;
+    }
+
+    fl = least_significant_bit(fl_bitmap);
+    sl_bitmap = m_sl_bitmap[fl];
+  }
+
+  return m_free_lists[fl][least_significant_bit(sl_bitmap)];
+}
+
+PoolCoalesceHeuristic<SegregatedFitPool> SegregatedFitPool::blocks_releasable(std::size_t nblocks)
+{
+  return [=](const strategy::SegregatedFitPool& pool) {
+    return pool.getReleasableBlocks() >= nblocks ? pool.getActualSize() : 0;
+  };
+}
+
+PoolCoalesceHeuristic<SegregatedFitPool> SegregatedFitPool::blocks_releasable_hwm(std::size_t nblocks)
+{
+  return [=](const strategy::SegregatedFitPool& pool) {
+    return pool.getReleasableBlocks() >= nblocks ? pool.getHighWatermark() : 0;
+  };
+}
+
+PoolCoalesceHeuristic<SegregatedFitPool> SegregatedFitPool::percent_releasable(int percentage)
+{
+  if (percentage < 0 || percentage > 100) {
+    UMPIRE_ERROR(runtime_error,
+                 fmt::format("Invalid percentage: {}, percentage must be an integer between 0 and 100", percentage));
+  }
+  if (percentage == 0) {
+    return [=](const SegregatedFitPool& UMPIRE_UNUSED_ARG(pool)) { return 0; };
+  } else if (percentage == 100) {
+    return [=](const strategy::SegregatedFitPool& pool) {
+      return pool.getActualSize() == pool.getReleasableSize() ? pool.getActualSize() : 0;
+    };
+  } else {
+    float f = (float)((float)percentage / (float)100.0);
+    return [=](const strategy::SegregatedFitPool& pool) {
+      // Calculate threshold in bytes from the percentage
+      const std::size_t threshold = static_cast<std::size_t>(f * pool.getActualSize());
+      return pool.getReleasableSize() >= threshold ? pool.getActualSize() : 0;
+    };
+  }
+}
+
+PoolCoalesceHeuristic<SegregatedFitPool> SegregatedFitPool::percent_releasable_hwm(int percentage)
+{
+  if (percentage < 0 || percentage > 100) {
+    UMPIRE_ERROR(runtime_error,
+                 fmt::format("Invalid percentage: {}, percentage must be an integer between 0 and 100", percentage));
+  }
+  if (percentage == 0) {
+    return [=](const SegregatedFitPool& UMPIRE_UNUSED_ARG(pool)) { return 0; };
+  } else if (percentage == 100) {
+    return [=](const strategy::SegregatedFitPool& pool) {
+      return pool.getActualSize() == pool.getReleasableSize() ? pool.getHighWatermark() : 0;
+    };
+  } else {
+    float f = (float)((float)percentage / (float)100.0);
+    return [=](const strategy::SegregatedFitPool& pool) {
+      // Calculate threshold in bytes from the percentage
+      const std::size_t threshold = static_cast<std::size_t>(f * pool.getActualSize());
+      return pool.getReleasableSize() >= threshold ? pool.getHighWatermark() : 0;
+    };
+  }
+}
+
+std::ostream& operator<<(std::ostream& out, umpire::strategy::PoolCoalesceHeuristic<SegregatedFitPool>&)
+{
+  return out;
+}
+
+} // end of namespace strategy
+} // end namespace umpire
@@ -0,0 +1,179 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_SegregatedFitPool_HPP
+#define UMPIRE_SegregatedFitPool_HPP
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "umpire/strategy/AllocationStrategy.hpp"
+#include "umpire/strategy/PoolCoalesceHeuristic.hpp"
+#include "umpire/strategy/mixins/AlignedAllocation.hpp"
+#include "umpire/util/FixedMallocPool.hpp"
+#include "umpire/util/MemoryResourceTraits.hpp"
+
+namespace umpire {
+
+class Allocator;
+
+namespace strategy {
+
+/*!
+ * \brief A pool that indexes free chunks by size with segregated free lists.
+ *
+ * SegregatedFitPool manages chunks the same way as QuickPool, but instead of
+ * a sorted multimap of free chunk sizes it keeps a two-level array of free
+ * lists: the first level is the power-of-two range of the size, and the
+ * second level splits that range into 32 equal sub-ranges. A bitmap of
+ * non-empty lists at each level means that finding a free chunk which is
+ * large enough takes a constant number of steps, regardless of how many free
+ * chunks the pool holds.
+ *
+ * Chunks are taken from the first non-empty list whose smallest size is at
+ * least the requested size, so the chosen chunk may be up to 1/32 larger than
+ * the smallest one that would fit.
+ */
+class SegregatedFitPool : public AllocationStrategy, private mixins::AlignedAllocation {
+ public:
+  using Pointer = void*;
+
+  /*!
+   * \brief Coalescing Heuristic functions for Percent-Releasable and Blocks-Releasable. Both have
+   * the option to reallocate to High Watermark instead of actual size of the pool (actual size is
+   * currently the default).
+   */
+  static PoolCoalesceHeuristic<SegregatedFitPool> percent_releasable(int percentage);
+  static PoolCoalesceHeuristic<SegregatedFitPool> percent_releasable_hwm(int percentage);
+  static PoolCoalesceHeuristic<SegregatedFitPool> blocks_releasable(std::size_t nblocks);
+  static PoolCoalesceHeuristic<SegregatedFitPool> blocks_releasable_hwm(std::size_t nblocks);
+
+  static constexpr std::size_t s_default_first_block_size{512 * 1024 * 1024};
+  static constexpr std::size_t s_default_next_block_size{1 * 1024 * 1024};
+  static constexpr std::size_t s_default_alignment{16};
+
+  /*!
+   * \brief Construct a new SegregatedFitPool.
+   *
+   * \param name Name of this instance of the SegregatedFitPool
+   * \param id Unique identifier for this instance
+   * \param allocator Allocation resource that pool uses
+   * \param first_minimum_pool_allocation_size Size the pool initially allocates
+   * \param next_minimum_pool_allocation_size The minimum size of all future
+   * allocations \param alignment Number of bytes with which to align allocation
+   * sizes (power-of-2) \param should_coalesce Heuristic for when to perform
+   * coalesce operation
+   */
+  SegregatedFitPool(const std::string& name, int id, Allocator allocator,
+                    const std::size_t first_minimum_pool_allocation_size = s_default_first_block_size,
+                    const std::size_t next_minimum_pool_allocation_size = s_default_next_block_size,
+                    const std::size_t alignment = s_default_alignment,
+                    PoolCoalesceHeuristic<SegregatedFitPool> should_coalesce = percent_releasable_hwm(100)) noexcept;
+
+  ~SegregatedFitPool();
+
+  SegregatedFitPool(const SegregatedFitPool&) = delete;
+
+  void* allocate(std::size_t bytes) override;
+  void deallocate(void* ptr, std::size_t size) override;
+  void release() override;
+
+  std::size_t getActualSize() const noexcept override;
+  std::size_t getCurrentSize() const noexcept override;
+  std::size_t getReleasableSize() const noexcept;
+  std::size_t getActualHighwaterMark() const noexcept;
+
+  Platform getPlatform() noexcept override;
+
+  MemoryResourceTraits getTraits() const noexcept override;
+
+  bool tracksMemoryUse() const noexcept override;
+
+  /*!
+   * \brief Return the number of memory blocks -- both leased to application
+   * and internal free memory -- that the pool holds.
+   */
+  std::size_t getBlocksInPool() const noexcept;
+
+  /*!
+   * \brief Get the largest allocatable number of bytes from pool before
+   * the pool will grow.
+   *
+   * return The largest number of bytes that may be allocated without
+   * causing pool growth
+   */
+  std::size_t getLargestAvailableBlock() noexcept;
+
+  std::size_t getReleasableBlocks() const noexcept;
+  std::size_t getTotalBlocks() const noexcept;
+
+  void coalesce() noexcept;
+  void do_coalesce(std::size_t suggested_size) noexcept;
+
+ private:
+  // Each power-of-two size range is split into 1 << s_sl_log2 free lists
+  static constexpr unsigned int s_sl_log2{5};
+  static constexpr unsigned int s_sl_count{1u << s_sl_log2};
+  static constexpr unsigned int s_fl_count{64 - s_sl_log2 + 1};
+
+  struct Chunk {
+    Chunk(void* ptr, std::size_t s, std::size_t cs) : data{ptr}, size{s}, chunk_size{cs}
+    {
+    }
+
+    void* data{nullptr};
+    std::size_t size{0};
+    std::size_t chunk_size{0};
+    bool free{true};
+    Chunk* prev{nullptr};
+    Chunk* next{nullptr};
+    Chunk* prev_free{nullptr};
+    Chunk* next_free{nullptr};
+  };
+
+  using PointerMap = std::unordered_map<void*, Chunk*>;
+
+  static void mapping(std::size_t size, unsigned int& fl, unsigned int& sl) noexcept;
+
+  void insertFree(Chunk* chunk) noexcept;
+  void removeFree(Chunk* chunk) noexcept;
+  Chunk* findFree(std::size_t bytes) noexcept;
+
+  PointerMap m_pointer_map{};
+
+  Chunk* m_free_lists[s_fl_count][s_sl_count]{};
+  std::uint64_t m_fl_bitmap{0};
+  std::uint32_t m_sl_bitmap[s_fl_count]{};
+  std::size_t m_free_chunks{0};
+
+  util::FixedMallocPool m_chunk_pool{sizeof(Chunk)};
+
+  PoolCoalesceHeuristic<SegregatedFitPool> m_should_coalesce;
+
+  const std::size_t m_first_minimum_pool_allocation_size;
+  const std::size_t m_next_minimum_pool_allocation_size;
+
+  std::size_t m_total_blocks{0};
+  std::size_t m_releasable_blocks{0};
+  std::size_t m_actual_bytes{0};
+  std::size_t m_current_bytes{0};
+  std::size_t m_releasable_bytes{0};
+  std::size_t m_actual_highwatermark{0};
+  bool m_is_destructing{false};
+  bool m_is_coalescing{false};
+};
+
+std::ostream& operator<<(std::ostream& out, umpire::strategy::PoolCoalesceHeuristic<SegregatedFitPool>&);
+
+inline std::string to_string(PoolCoalesceHeuristic<SegregatedFitPool>&)
+{
+  return "PoolCoalesceHeuristic<SegregatedFitPool>";
+}
+
+} // end of namespace strategy
+} // end namespace umpire
+
+#endif // UMPIRE_SegregatedFitPool_HPP
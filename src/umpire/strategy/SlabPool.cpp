@@ -0,0 +1,313 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/strategy/SlabPool.hpp"
+
+#include "umpire/util/Macros.hpp"
+
+namespace umpire {
+namespace strategy {
+
+namespace {
+
+// Sizes up to s_linear_max_size are split into classes s_linear_step apart
+constexpr std::size_t s_linear_step{16};
+constexpr std::size_t s_linear_max_size{128};
+constexpr std::size_t s_linear_classes{s_linear_max_size / s_linear_step};
+
+// Larger sizes are split into 1 << s_sub_class_bits classes per power of two
+constexpr unsigned int s_sub_class_bits{2};
+
+constexpr unsigned int most_significant_bit(std::size_t n) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<unsigned int>(sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(n));
+#else
+  unsigned int bit{0};
+  while (n >>= 1)
+    ++bit;
+  return bit;
+#endif
+}
+
+constexpr std::size_t size_to_class(std::size_t bytes) noexcept
+{
+  if (bytes <= s_linear_max_size) {
+    return (bytes == 0) ? 0 : (bytes - 1) / s_linear_step;
+  }
+
+  const std::size_t last_byte{bytes - 1};
+  const unsigned int msb{most_significant_bit(last_byte)};
+  const unsigned int linear_msb{most_significant_bit(s_linear_max_size)};
+
+  return s_linear_classes + ((msb - linear_msb) << s_sub_class_bits) +
+         ((last_byte >> (msb - s_sub_class_bits)) & ((1u << s_sub_class_bits) - 1));
+}
+
+constexpr std::size_t class_to_size(std::size_t size_class) noexcept
+{
+  if (size_class < s_linear_classes) {
+    return (size_class + 1) * s_linear_step;
+  }
+
+  const std::size_t geometric_class{size_class - s_linear_classes};
+  const std::size_t sub_class{geometric_class & ((1u << s_sub_class_bits) - 1)};
+  const std::size_t range{geometric_class >> s_sub_class_bits};
+
+  return ((std::size_t{1} << s_sub_class_bits) + sub_class + 1)
+         << (range + most_significant_bit(s_linear_max_size) - s_sub_class_bits);
+}
+
+static_assert(size_to_class(1) == 0 && class_to_size(0) == s_linear_step, "Smallest size class is 16 bytes");
+static_assert(size_to_class(s_linear_max_size + 1) == s_linear_classes, "First geometric size class follows 128B");
+static_assert(class_to_size(size_to_class(SlabPool::s_max_class_size)) == SlabPool::s_max_class_size,
+              "Largest size class holds s_max_class_size bytes");
+static_assert(size_to_class(SlabPool::s_max_class_size) + 1 == SlabPool::s_num_size_classes,
+              "s_num_size_classes matches the size class table");
+
+} // end of anonymous namespace
+
+constexpr std::size_t SlabPool::s_default_slab_size;
+constexpr std::size_t SlabPool::s_num_size_classes;
+constexpr std::size_t SlabPool::s_max_class_size;
+
+//
+// Header at the start of every slab. For a slab of objects, free_list and
+// next_unused hand out objects, and prev/next link the slab into the list of
+// slabs of its size class that have free objects. Allocations larger than the
+// largest size class use size_class == s_num_size_classes and record the
+// number of bytes taken from the QuickPool in bytes.
+//
+struct SlabPool::Slab {
+  std::size_t size_class;
+  std::size_t bytes;
+  std::size_t num_free;
+  void* free_list;
+  char* next_unused;
+  Slab* prev;
+  Slab* next;
+};
+
+namespace {
+// Objects start after the header, which keeps them 16 byte aligned
+constexpr std::size_t s_header_bytes{64};
+} // end of anonymous namespace
+
+SlabPool::SlabPool(const std::string& name, int id, Allocator allocator, const std::size_t slab_size,
+                   const std::size_t first_minimum_pool_allocation_size,
+                   const std::size_t next_minimum_pool_allocation_size,
+                   PoolCoalesceHeuristic<QuickPool> should_coalesce)
+    : AllocationStrategy{name, id, allocator.getAllocationStrategy(), "SlabPool"},
+      m_quick_pool{"internal_quick_pool",
+                   -1,
+                   allocator,
+                   first_minimum_pool_allocation_size,
+                   next_minimum_pool_allocation_size,
+                   slab_size,
+                   should_coalesce},
+      m_partial{},
+      m_objects_per_slab{},
+      m_slab_size{slab_size},
+      m_slab_mask{~static_cast<std::uintptr_t>(slab_size - 1)},
+      m_allocator{allocator.getAllocationStrategy()}
+{
+  static_assert(sizeof(Slab) <= s_header_bytes, "Slab header must fit in s_header_bytes");
+
+  UMPIRE_LOG(Debug, " ( "
+                        << "name=\"" << name << "\""
+                        << ", id=" << id << ", allocator=\"" << allocator.getName() << "\""
+                        << ", slab_size=" << m_slab_size << " )");
+
+  if (m_allocator->getPlatform() != Platform::host) {
+    UMPIRE_ERROR(runtime_error, "Cannot construct SlabPool from non-host Allocator.");
+  }
+
+  if ((m_slab_size & (m_slab_size - 1)) != 0 || m_slab_size < 2 * s_max_class_size) {
+    UMPIRE_ERROR(runtime_error, fmt::format("Invalid slab size {}, must be a power of two of at least {} bytes",
+                                            m_slab_size, 2 * s_max_class_size));
+  }
+
+  for (std::size_t c = 0; c < s_num_size_classes; ++c) {
+    m_objects_per_slab[c] = (m_slab_size - s_header_bytes) / classSize(c);
+  }
+}
+
+SlabPool::~SlabPool()
+{
+  freeEmptySlabs();
+}
+
+std::size_t SlabPool::sizeClass(std::size_t bytes) noexcept
+{
+  return (bytes > s_max_class_size) ? s_num_size_classes : size_to_class(bytes);
+}
+
+std::size_t SlabPool::classSize(std::size_t size_class) noexcept
+{
+  return class_to_size(size_class);
+}
+
+void* SlabPool::allocate(std::size_t bytes)
+{
+  UMPIRE_LOG(Debug, "(bytes=" << bytes << ")");
+
+  if (bytes > s_max_class_size) {
+    const std::size_t raw_bytes{bytes + s_header_bytes};
+    Slab* slab{static_cast<Slab*>(m_quick_pool.allocate_internal(raw_bytes))};
+    slab->size_class = s_num_size_classes;
+    slab->bytes = raw_bytes;
+    return reinterpret_cast<char*>(slab) + s_header_bytes;
+  }
+
+  const std::size_t size_class{size_to_class(bytes)};
+  Slab* slab{m_partial[size_class]};
+
+  if (slab == nullptr) {
+    slab = newSlab(size_class);
+  }
+
+  void* ptr{slab->free_list};
+  if (ptr) {
+    slab->free_list = *static_cast<void**>(ptr);
+  } else {
+    ptr = slab->next_unused;
+    slab->next_unused += class_to_size(size_class);
+  }
+
+  if (--slab->num_free == 0) {
+    removePartial(slab);
+  }
+
+  return ptr;
+}
+
+void SlabPool::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
+{
+  UMPIRE_LOG(Debug, "(ptr=" << ptr << ")");
+
+  Slab* slab{slabOf(ptr)};
+  const std::size_t size_class{slab->size_class};
+
+  if (size_class == s_num_size_classes) {
+    m_quick_pool.deallocate_internal(slab, slab->bytes);
+    return;
+  }
+
+  *static_cast<void**>(ptr) = slab->free_list;
+  slab->free_list = ptr;
+
+  if (slab->num_free++ == 0) {
+    pushPartial(slab);
+  } else if (slab->num_free == m_objects_per_slab[size_class] && (slab->prev || slab->next)) {
+    //
+    // Keep the last slab of a size class even when it is empty, so that
+    // alternating allocation and deallocation does not repeatedly go to the
+    // QuickPool.
+    //
+    removePartial(slab);
+    freeSlab(slab);
+  }
+}
+
+void SlabPool::release()
+{
+  UMPIRE_LOG(Debug, "()");
+
+  freeEmptySlabs();
+  m_quick_pool.release();
+}
+
+std::size_t SlabPool::getActualSize() const noexcept
+{
+  return m_quick_pool.getActualSize();
+}
+
+Platform SlabPool::getPlatform() noexcept
+{
+  return m_allocator->getPlatform();
+}
+
+MemoryResourceTraits SlabPool::getTraits() const noexcept
+{
+  return m_allocator->getTraits();
+}
+
+std::size_t SlabPool::getSlabSize() const noexcept
+{
+  return m_slab_size;
+}
+
+SlabPool::Slab* SlabPool::slabOf(void* ptr) const noexcept
+{
+  return reinterpret_cast<Slab*>(reinterpret_cast<std::uintptr_t>(ptr) & m_slab_mask);
+}
+
+SlabPool::Slab* SlabPool::newSlab(std::size_t size_class)
+{
+  Slab* slab{static_cast<Slab*>(m_quick_pool.allocate_internal(m_slab_size))};
+
+  UMPIRE_LOG(Debug, "New slab " << slab << " for objects of size " << class_to_size(size_class));
+
+  slab->size_class = size_class;
+  slab->bytes = m_slab_size;
+  slab->num_free = m_objects_per_slab[size_class];
+  slab->free_list = nullptr;
+  slab->next_unused = reinterpret_cast<char*>(slab) + s_header_bytes;
+  slab->prev = nullptr;
+  slab->next = nullptr;
+
+  pushPartial(slab);
+
+  return slab;
+}
+
+void SlabPool::freeSlab(Slab* slab)
+{
+  UMPIRE_LOG(Debug, "Freeing slab " << slab);
+  m_quick_pool.deallocate_internal(slab, slab->bytes);
+}
+
+void SlabPool::freeEmptySlabs()
+{
+  for (std::size_t c = 0; c < s_num_size_classes; ++c) {
+    Slab* slab{m_partial[c]};
+    while (slab) {
+      Slab* next{slab->next};
+      if (slab->num_free == m_objects_per_slab[c]) {
+        removePartial(slab);
+        freeSlab(slab);
+      }
+      slab = next;
+    }
+  }
+}
+
+void SlabPool::pushPartial(Slab* slab) noexcept
+{
+  Slab*& head = m_partial[slab->size_class];
+  slab->prev = nullptr;
+  slab->next = head;
+  if (head)
+    head->prev = slab;
+  head = slab;
+}
+
+void SlabPool::removePartial(Slab* slab) noexcept
+{
+  if (slab->next)
+    slab->next->prev = slab->prev;
+
+  if (slab->prev)
+    slab->prev->next = slab->next;
+  else
+    m_partial[slab->size_class] = slab->next;
+
+  slab->prev = nullptr;
+  slab->next = nullptr;
+}
+
+} // end of namespace strategy
+} // end namespace umpire
@@ -0,0 +1,116 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_SlabPool_HPP
+#define UMPIRE_SlabPool_HPP
+
+#include <cstdint>
+
+#include "umpire/Allocator.hpp"
+#include "umpire/strategy/AllocationStrategy.hpp"
+#include "umpire/strategy/PoolCoalesceHeuristic.hpp"
+#include "umpire/strategy/QuickPool.hpp"
+
+namespace umpire {
+namespace strategy {
+
+/*!
+ * \brief A pool for small objects that carves fixed size slabs into objects
+ * of a set of size classes.
+ *
+ * Sizes up to 128 bytes are rounded up to a multiple of 16 bytes, and larger
+ * sizes up to 4096 bytes to one of four sizes in each power-of-two range,
+ * which gives 28 size classes. The size class is computed directly from the
+ * requested size.
+ *
+ * Slabs are allocated from an internal QuickPool aligned to the slab size, and
+ * each slab starts with a header describing it, so the slab that owns a
+ * pointer is found by masking off the low bits of the pointer. Allocations
+ * larger than the largest size class are placed in a run of slabs of their
+ * own, so they are rounded up to a multiple of the slab size. Because the
+ * headers are written to the slabs, the pool requires a host Allocator.
+ */
+class SlabPool : public AllocationStrategy {
+ public:
+  static constexpr std::size_t s_default_slab_size{64 * 1024};
+  static constexpr std::size_t s_num_size_classes{28};
+  static constexpr std::size_t s_max_class_size{4096};
+
+  /*!
+   * \brief Construct a new SlabPool.
+   *
+   * \param name Name of this instance of the SlabPool
+   * \param id Unique identifier for this instance
+   * \param allocator Allocation resource that the internal QuickPool uses
+   * \param slab_size Size (in bytes) of each slab, a power of two that is at
+   * least twice the largest size class
+   * \param first_minimum_pool_allocation_size Size the QuickPool initially allocates
+   * \param next_minimum_pool_allocation_size The minimum size of all future
+   * QuickPool allocations
+   * \param should_coalesce Heuristic for when the QuickPool should coalesce
+   */
+  SlabPool(const std::string& name, int id, Allocator allocator, const std::size_t slab_size = s_default_slab_size,
+           const std::size_t first_minimum_pool_allocation_size = QuickPool::s_default_first_block_size,
+           const std::size_t next_minimum_pool_allocation_size = QuickPool::s_default_next_block_size,
+           PoolCoalesceHeuristic<QuickPool> should_coalesce = QuickPool::percent_releasable_hwm(100));
+
+  ~SlabPool();
+
+  SlabPool(const SlabPool&) = delete;
+
+  void* allocate(std::size_t bytes) override;
+  void deallocate(void* ptr, std::size_t size) override;
+
+  /*!
+   * \brief Return empty slabs to the internal QuickPool and release its
+   * unused memory.
+   */
+  void release() override;
+
+  std::size_t getActualSize() const noexcept override;
+
+  Platform getPlatform() noexcept override;
+
+  MemoryResourceTraits getTraits() const noexcept override;
+
+  std::size_t getSlabSize() const noexcept;
+
+  /*!
+   * \brief Return the size class that an allocation of \p bytes is served
+   * from, or s_num_size_classes if it is larger than the largest class.
+   */
+  static std::size_t sizeClass(std::size_t bytes) noexcept;
+
+  /*!
+   * \brief Return the object size (in bytes) of size class \p size_class.
+   */
+  static std::size_t classSize(std::size_t size_class) noexcept;
+
+ private:
+  struct Slab;
+
+  Slab* slabOf(void* ptr) const noexcept;
+  Slab* newSlab(std::size_t size_class);
+  void freeSlab(Slab* slab);
+  void freeEmptySlabs();
+  void pushPartial(Slab* slab) noexcept;
+  void removePartial(Slab* slab) noexcept;
+
+  QuickPool m_quick_pool;
+
+  Slab* m_partial[s_num_size_classes];
+  std::size_t m_objects_per_slab[s_num_size_classes];
+
+  const std::size_t m_slab_size;
+  const std::uintptr_t m_slab_mask;
+
+  AllocationStrategy* m_allocator;
+};
+
+} // end of namespace strategy
+} // end namespace umpire
+
+#endif // UMPIRE_SlabPool_HPP
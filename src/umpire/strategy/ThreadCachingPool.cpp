@@ -0,0 +1,300 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/strategy/ThreadCachingPool.hpp"
+
+#include <unordered_map>
+
+#include "umpire/util/Macros.hpp"
+
+namespace umpire {
+namespace strategy {
+
+namespace {
+
+// Smallest size class is 1 << s_min_bin_shift bytes
+constexpr std::size_t s_min_bin_shift{4};
+
+inline std::size_t ceil_log2(std::size_t n) noexcept
+{
+  if (n <= 1)
+    return 0;
+#if defined(__GNUC__) || defined(__clang__)
+  return sizeof(unsigned long long) * 8 - static_cast<std::size_t>(__builtin_clzll(n - 1));
+#else
+  std::size_t shift{0};
+  while ((std::size_t{1} << shift) < n)
+    ++shift;
+  return shift;
+#endif
+}
+
+inline std::size_t size_to_bin(std::size_t bytes) noexcept
+{
+  const std::size_t shift{ceil_log2(bytes)};
+  return (shift > s_min_bin_shift) ? shift - s_min_bin_shift : 0;
+}
+
+std::uint64_t next_pool_uid() noexcept
+{
+  static std::atomic<std::uint64_t> s_uid{1};
+  return s_uid++;
+}
+
+} // end of anonymous namespace
+
+//
+// Caches owned by one thread, keyed by the uid of the pool they belong to.
+// Pool uids are never reused, so entries for destroyed pools are simply
+// never looked up again. When the thread exits its caches are marked as
+// orphaned so that the owning pool can reclaim the blocks they hold.
+//
+struct ThreadCachingPool::ThreadCacheList {
+  ~ThreadCacheList()
+  {
+    for (auto& entry : caches) {
+      entry.second->orphaned = true;
+    }
+  }
+
+  std::unordered_map<std::uint64_t, std::shared_ptr<ThreadCache>> caches;
+  std::uint64_t last_uid{0};
+  ThreadCache* last_cache{nullptr};
+};
+
+ThreadCachingPool::ThreadCachingPool(const std::string& name, int id, Allocator allocator,
+                                     const std::size_t max_cached_size, const std::size_t cache_capacity,
+                                     const std::size_t first_minimum_pool_allocation_size,
+                                     const std::size_t next_minimum_pool_allocation_size, const std::size_t alignment,
+                                     PoolCoalesceHeuristic<QuickPool> should_coalesce)
+    : AllocationStrategy{name, id, allocator.getAllocationStrategy(), "ThreadCachingPool"},
+      m_quick_pool{"internal_quick_pool",
+                   -1,
+                   allocator,
+                   first_minimum_pool_allocation_size,
+                   next_minimum_pool_allocation_size,
+                   alignment,
+                   should_coalesce},
+      m_caches{},
+      m_uid{next_pool_uid()},
+      m_num_bins{size_to_bin(max_cached_size) + 1},
+      m_max_cached_size{binSize(m_num_bins - 1)},
+      m_cache_capacity{(cache_capacity < 2) ? 2 : cache_capacity},
+      m_batch_size{m_cache_capacity / 2},
+      m_header_bytes{(alignment < sizeof(std::size_t)) ? sizeof(std::size_t) : alignment},
+      m_allocator{allocator.getAllocationStrategy()}
+{
+  UMPIRE_LOG(Debug, " ( "
+                        << "name=\"" << name << "\""
+                        << ", id=" << id << ", allocator=\"" << allocator.getName() << "\""
+                        << ", max_cached_size=" << m_max_cached_size << ", cache_capacity=" << m_cache_capacity
+                        << " )");
+
+  if (m_allocator->getPlatform() != Platform::host) {
+    UMPIRE_ERROR(runtime_error, "Cannot construct ThreadCachingPool from non-host Allocator.");
+  }
+}
+
+ThreadCachingPool::~ThreadCachingPool()
+{
+  //
+  // No thread may use the pool while it is being destroyed, so every cache
+  // can be drained regardless of which thread it belongs to.
+  //
+  std::lock_guard<std::mutex> lock{m_mutex};
+  for (auto& cache : m_caches) {
+    for (std::size_t bin = 0; bin < m_num_bins; ++bin) {
+      drain(cache->bins[bin], bin, cache->bins[bin].size());
+    }
+  }
+  m_caches.clear();
+}
+
+void* ThreadCachingPool::allocate(std::size_t bytes)
+{
+  UMPIRE_LOG(Debug, "(bytes=" << bytes << ")");
+
+  if (bytes > m_max_cached_size) {
+    const std::size_t raw_bytes{bytes + m_header_bytes};
+    void* raw{nullptr};
+    {
+      std::lock_guard<std::mutex> lock{m_mutex};
+      raw = m_quick_pool.allocate_internal(raw_bytes);
+    }
+    return writeHeader(raw, raw_bytes);
+  }
+
+  const std::size_t bin{size_to_bin(bytes)};
+  auto& free_list = getThreadCache().bins[bin];
+
+  if (free_list.empty()) {
+    refill(free_list, bin);
+  }
+
+  void* ptr{free_list.back()};
+  free_list.pop_back();
+
+  return ptr;
+}
+
+void ThreadCachingPool::deallocate(void* ptr, std::size_t UMPIRE_UNUSED_ARG(size))
+{
+  UMPIRE_LOG(Debug, "(ptr=" << ptr << ")");
+
+  const std::size_t header{readHeader(ptr)};
+
+  if (header >= m_num_bins) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_quick_pool.deallocate_internal(static_cast<char*>(ptr) - m_header_bytes, header);
+    return;
+  }
+
+  auto& free_list = getThreadCache().bins[header];
+
+  free_list.push_back(ptr);
+
+  if (free_list.size() > m_cache_capacity) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    drain(free_list, header, m_batch_size);
+  }
+}
+
+void ThreadCachingPool::release()
+{
+  UMPIRE_LOG(Debug, "()");
+
+  std::lock_guard<std::mutex> lock{m_mutex};
+  reapOrphanedCaches();
+  m_quick_pool.release();
+}
+
+void ThreadCachingPool::flush()
+{
+  UMPIRE_LOG(Debug, "()");
+
+  auto& cache = getThreadCache();
+
+  std::lock_guard<std::mutex> lock{m_mutex};
+  for (std::size_t bin = 0; bin < m_num_bins; ++bin) {
+    drain(cache.bins[bin], bin, cache.bins[bin].size());
+  }
+  reapOrphanedCaches();
+}
+
+std::size_t ThreadCachingPool::getActualSize() const noexcept
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+  return m_quick_pool.getActualSize();
+}
+
+Platform ThreadCachingPool::getPlatform() noexcept
+{
+  return m_allocator->getPlatform();
+}
+
+MemoryResourceTraits ThreadCachingPool::getTraits() const noexcept
+{
+  return m_allocator->getTraits();
+}
+
+std::size_t ThreadCachingPool::getMaxCachedSize() const noexcept
+{
+  return m_max_cached_size;
+}
+
+std::size_t ThreadCachingPool::getCacheCapacity() const noexcept
+{
+  return m_cache_capacity;
+}
+
+ThreadCachingPool::ThreadCache& ThreadCachingPool::getThreadCache()
+{
+  static thread_local ThreadCacheList t_list;
+
+  if (t_list.last_uid == m_uid) {
+    return *t_list.last_cache;
+  }
+
+  auto& cache = t_list.caches[m_uid];
+
+  if (!cache) {
+    cache = std::make_shared<ThreadCache>();
+    cache->bins.resize(m_num_bins);
+    for (auto& free_list : cache->bins) {
+      free_list.reserve(m_cache_capacity + 1);
+    }
+
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_caches.push_back(cache);
+  }
+
+  t_list.last_uid = m_uid;
+  t_list.last_cache = cache.get();
+
+  return *cache;
+}
+
+std::size_t ThreadCachingPool::binSize(std::size_t bin) const noexcept
+{
+  return std::size_t{1} << (bin + s_min_bin_shift);
+}
+
+void* ThreadCachingPool::writeHeader(void* raw, std::size_t value) const noexcept
+{
+  *static_cast<std::size_t*>(raw) = value;
+  return static_cast<char*>(raw) + m_header_bytes;
+}
+
+std::size_t ThreadCachingPool::readHeader(void* ptr) const noexcept
+{
+  return *reinterpret_cast<std::size_t*>(static_cast<char*>(ptr) - m_header_bytes);
+}
+
+void ThreadCachingPool::refill(std::vector<void*>& free_list, std::size_t bin)
+{
+  const std::size_t raw_bytes{binSize(bin) + m_header_bytes};
+
+  std::lock_guard<std::mutex> lock{m_mutex};
+  for (std::size_t i = 0; i < m_batch_size; ++i) {
+    try {
+      free_list.push_back(writeHeader(m_quick_pool.allocate_internal(raw_bytes), bin));
+    } catch (...) {
+      if (free_list.empty()) {
+        throw;
+      }
+      UMPIRE_LOG(Warning, "Partial refill of " << free_list.size() << " blocks of size " << raw_bytes);
+      break;
+    }
+  }
+}
+
+void ThreadCachingPool::drain(std::vector<void*>& free_list, std::size_t bin, std::size_t count)
+{
+  const std::size_t raw_bytes{binSize(bin) + m_header_bytes};
+
+  for (std::size_t i = 0; i < count && !free_list.empty(); ++i) {
+    m_quick_pool.deallocate_internal(static_cast<char*>(free_list.back()) - m_header_bytes, raw_bytes);
+    free_list.pop_back();
+  }
+}
+
+void ThreadCachingPool::reapOrphanedCaches()
+{
+  for (auto it = m_caches.begin(); it != m_caches.end();) {
+    auto& cache = *it;
+    if (cache->orphaned) {
+      for (std::size_t bin = 0; bin < m_num_bins; ++bin) {
+        drain(cache->bins[bin], bin, cache->bins[bin].size());
+      }
+      it = m_caches.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+} // end of namespace strategy
+} // end of namespace umpire
@@ -0,0 +1,138 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_ThreadCachingPool_HPP
+#define UMPIRE_ThreadCachingPool_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "umpire/Allocator.hpp"
+#include "umpire/strategy/AllocationStrategy.hpp"
+#include "umpire/strategy/PoolCoalesceHeuristic.hpp"
+#include "umpire/strategy/QuickPool.hpp"
+
+namespace umpire {
+namespace strategy {
+
+/*!
+ * \brief A thread-safe pool with per-thread caches in front of a QuickPool.
+ *
+ * Small allocations are rounded up to a power-of-two size class and served
+ * from a free list that belongs to the calling thread, so the common case
+ * never takes a lock. When a thread's free list is empty it is refilled with
+ * a batch of blocks from an internal QuickPool, and when it grows past the
+ * cache capacity half of it is flushed back, both under a single lock.
+ * Allocations larger than the largest size class go straight to the
+ * QuickPool under the lock.
+ *
+ * Every block carries a header of \p alignment bytes (at least
+ * sizeof(std::size_t)) recording its size class, so deallocation does not
+ * depend on the Allocator passing the allocation size. The pool therefore
+ * requires a host Allocator.
+ *
+ * Blocks held in a thread's cache remain allocated from the point of view of
+ * the QuickPool. They are returned by flush() on the owning thread, by
+ * release() once the owning thread has exited, or when the pool is destroyed.
+ */
+class ThreadCachingPool : public AllocationStrategy {
+ public:
+  static constexpr std::size_t s_default_max_cached_size{32 * 1024};
+  static constexpr std::size_t s_default_cache_capacity{64};
+
+  /*!
+   * \brief Construct a new ThreadCachingPool.
+   *
+   * \param name Name of this instance of the ThreadCachingPool
+   * \param id Unique identifier for this instance
+   * \param allocator Allocation resource that the internal QuickPool uses
+   * \param max_cached_size Largest allocation size (in bytes) served from the
+   * per-thread caches, rounded up to a power of two
+   * \param cache_capacity Maximum number of blocks each thread keeps per size
+   * class; refills and flushes move half of this many blocks at a time
+   * \param first_minimum_pool_allocation_size Size the QuickPool initially allocates
+   * \param next_minimum_pool_allocation_size The minimum size of all future
+   * QuickPool allocations
+   * \param alignment Number of bytes with which to align allocation sizes (power-of-2)
+   * \param should_coalesce Heuristic for when the QuickPool should coalesce
+   */
+  ThreadCachingPool(const std::string& name, int id, Allocator allocator,
+                    const std::size_t max_cached_size = s_default_max_cached_size,
+                    const std::size_t cache_capacity = s_default_cache_capacity,
+                    const std::size_t first_minimum_pool_allocation_size = QuickPool::s_default_first_block_size,
+                    const std::size_t next_minimum_pool_allocation_size = QuickPool::s_default_next_block_size,
+                    const std::size_t alignment = QuickPool::s_default_alignment,
+                    PoolCoalesceHeuristic<QuickPool> should_coalesce = QuickPool::percent_releasable_hwm(100));
+
+  ~ThreadCachingPool();
+
+  ThreadCachingPool(const ThreadCachingPool&) = delete;
+
+  void* allocate(std::size_t bytes) override;
+  void deallocate(void* ptr, std::size_t size) override;
+
+  /*!
+   * \brief Flush all caches that are no longer in use and release unused
+   * memory held by the internal QuickPool.
+   */
+  void release() override;
+
+  /*!
+   * \brief Return every block cached by the calling thread to the internal
+   * QuickPool.
+   */
+  void flush();
+
+  std::size_t getActualSize() const noexcept override;
+
+  Platform getPlatform() noexcept override;
+
+  MemoryResourceTraits getTraits() const noexcept override;
+
+  std::size_t getMaxCachedSize() const noexcept;
+  std::size_t getCacheCapacity() const noexcept;
+
+ private:
+  struct ThreadCache {
+    std::vector<std::vector<void*>> bins;
+    std::atomic<bool> orphaned{false};
+  };
+
+  struct ThreadCacheList;
+
+  ThreadCache& getThreadCache();
+
+  std::size_t binSize(std::size_t bin) const noexcept;
+
+  void* writeHeader(void* raw, std::size_t value) const noexcept;
+  std::size_t readHeader(void* ptr) const noexcept;
+
+  void refill(std::vector<void*>& free_list, std::size_t bin);
+  void drain(std::vector<void*>& free_list, std::size_t bin, std::size_t count);
+  void reapOrphanedCaches();
+
+  QuickPool m_quick_pool;
+  mutable std::mutex m_mutex;
+
+  std::vector<std::shared_ptr<ThreadCache>> m_caches;
+
+  const std::uint64_t m_uid;
+  const std::size_t m_num_bins;
+  const std::size_t m_max_cached_size;
+  const std::size_t m_cache_capacity;
+  const std::size_t m_batch_size;
+  const std::size_t m_header_bytes;
+
+  AllocationStrategy* m_allocator;
+};
+
+} // end of namespace strategy
+} // end namespace umpire
+
+#endif // UMPIRE_ThreadCachingPool_HPP
@@ -30,6 +30,39 @@ void ThreadSafeAllocator::deallocate(void* ptr, std::size_t size)
   m_allocator->deallocate_internal(ptr, size);
 }
 
+//
+// The Allocator holds m_mutex around batches, as it does for allocate and
+// deallocate, so the wrapped strategy can carve a whole batch at once
+//
+void ThreadSafeAllocator::allocate_batch(const std::size_t* sizes, std::size_t count, void** ptrs)
+{
+  m_allocator->allocate_batch_internal(sizes, count, ptrs);
+}
+
+void ThreadSafeAllocator::deallocate_batch(void* const* ptrs, const std::size_t* sizes, std::size_t count)
+{
+  m_allocator->deallocate_batch_internal(ptrs, sizes, count);
+}
+
+bool ThreadSafeAllocator::try_resize(void* ptr, std::size_t old_size, std::size_t new_size)
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+
+  if (!m_allocator->try_resize(ptr, old_size, new_size)) {
+    return false;
+  }
+
+  // Keep the statistics that allocate_internal keeps for m_allocator
+  m_allocator->m_counters.resizeAllocation(old_size, new_size);
+
+  return true;
+}
+
+void ThreadSafeAllocator::deallocate_after(void* ptr, std::size_t size, const camp::resources::Event& event)
+{
+  m_allocator->deallocate_internal(ptr, size, event);
+}
+
 Platform ThreadSafeAllocator::getPlatform() noexcept
 {
   return m_allocator->getPlatform();
@@ -28,6 +28,8 @@ class ThreadSafeAllocator : public AllocationStrategy {
 
   void* allocate(std::size_t bytes) override;
   void deallocate(void* ptr, std::size_t size) override;
+  bool try_resize(void* ptr, std::size_t old_size, std::size_t new_size) override;
+  void deallocate_after(void* ptr, std::size_t size, const camp::resources::Event& event) override;
 
   Platform getPlatform() noexcept override;
 
@@ -36,6 +38,9 @@ class ThreadSafeAllocator : public AllocationStrategy {
   std::mutex* get_mutex();
 
  protected:
+  void allocate_batch(const std::size_t* sizes, std::size_t count, void** ptrs) override;
+  void deallocate_batch(void* const* ptrs, const std::size_t* sizes, std::size_t count) override;
+
   strategy::AllocationStrategy* m_allocator;
 
   std::mutex m_mutex;
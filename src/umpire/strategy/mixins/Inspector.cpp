@@ -9,6 +9,7 @@
 #include "umpire/ResourceManager.hpp"
 
 #include <string>
+#include <vector>
 
 namespace umpire {
 namespace strategy {
@@ -16,24 +17,14 @@ namespace mixins {
 
 void Inspector::registerAllocation(void* ptr, std::size_t size, strategy::AllocationStrategy* s)
 {
-  s->m_current_size += size;
-  s->m_allocation_count++;
-
-  if (s->m_current_size > s->m_high_watermark) {
-    s->m_high_watermark = s->m_current_size;
-  }
+  s->m_counters.registerAllocation(size);
 
   ResourceManager::getInstance().registerAllocation(ptr, {ptr, size, s});
 }
 
 void Inspector::registerAllocation(void* ptr, std::size_t size, strategy::AllocationStrategy* s, const std::string& name)
 {
-  s->m_current_size += size;
-  s->m_allocation_count++;
-
-  if (s->m_current_size > s->m_high_watermark) {
-    s->m_high_watermark = s->m_current_size;
-  }
+  s->m_counters.registerAllocation(size);
 
   ResourceManager::getInstance().registerAllocation(ptr, {ptr, size, s, name});
 }
@@ -44,8 +35,7 @@ Inspector::deregisterAllocation(void* ptr, strategy::AllocationStrategy* s)
   auto record = ResourceManager::getInstance().deregisterAllocation(ptr);
 
   if (record.strategy == s) {
-    s->m_current_size -= record.size;
-    s->m_allocation_count--;
+    s->m_counters.deregisterAllocation(record.size);
   } else {
     // Re-register the pointer and throw an error
     ResourceManager::getInstance().registerAllocation(ptr, {ptr, record.size, record.strategy, record.name});
@@ -55,6 +45,42 @@ Inspector::deregisterAllocation(void* ptr, strategy::AllocationStrategy* s)
   return record;
 }
 
+void Inspector::registerAllocations(void* const* ptrs, const std::size_t* sizes, std::size_t count,
+                                    strategy::AllocationStrategy* s)
+{
+  std::vector<util::AllocationRecord> records;
+  std::size_t bytes{0};
+
+  records.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    records.push_back({ptrs[i], sizes[i], s});
+    bytes += sizes[i];
+  }
+
+  ResourceManager::getInstance().registerAllocations(records.data(), count);
+  s->m_counters.registerAllocations(count, bytes);
+}
+
+void Inspector::deregisterAllocations(void* const* ptrs, std::size_t count, strategy::AllocationStrategy* s,
+                                      util::AllocationRecord* records)
+{
+  auto& rm = ResourceManager::getInstance();
+  std::size_t bytes{0};
+
+  rm.deregisterAllocations(ptrs, count, records);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    if (records[i].strategy != s) {
+      // Re-register the pointers and throw an error
+      rm.registerAllocations(records, count);
+      UMPIRE_ERROR(runtime_error, fmt::format("{} was not allocated by {}", ptrs[i], s->getName()));
+    }
+    bytes += records[i].size;
+  }
+
+  s->m_counters.deregisterAllocations(count, bytes);
+}
+
 } // end of namespace mixins
 } // end of namespace strategy
 } // end of namespace umpire
@@ -30,6 +30,14 @@ class Inspector
 
     // Deregisters the allocation if the strategy matches, otherwise throws an error
     util::AllocationRecord deregisterAllocation(void* ptr, strategy::AllocationStrategy* strategy);
+
+    void registerAllocations(void* const* ptrs, const std::size_t* sizes, std::size_t count,
+                             strategy::AllocationStrategy* strategy);
+
+    // Deregisters the allocations into records if the strategy matches all of them, otherwise
+    // leaves them registered and throws an error
+    void deregisterAllocations(void* const* ptrs, std::size_t count, strategy::AllocationStrategy* strategy,
+                               util::AllocationRecord* records);
 };
 
 } // end of namespace mixins
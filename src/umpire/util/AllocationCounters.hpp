@@ -0,0 +1,120 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_AllocationCounters_HPP
+#define UMPIRE_AllocationCounters_HPP
+
+#include <atomic>
+#include <cstddef>
+
+namespace umpire {
+namespace util {
+
+/*!
+ * \brief Allocation statistics that may be updated and read from any thread.
+ *
+ * The counters are relaxed atomics: updating them never takes a lock, and
+ * reading them never stops a thread that is allocating. Each value that is
+ * read is one that the counter actually held, but a Snapshot taken while
+ * other threads are allocating may combine values from slightly different
+ * moments.
+ */
+class AllocationCounters {
+ public:
+  struct Snapshot {
+    std::size_t current_size{0};
+    std::size_t high_watermark{0};
+    std::size_t allocation_count{0};
+  };
+
+  AllocationCounters() noexcept = default;
+
+  AllocationCounters(const AllocationCounters&) = delete;
+  AllocationCounters& operator=(const AllocationCounters&) = delete;
+
+  void registerAllocation(std::size_t bytes) noexcept
+  {
+    m_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    updateHighWatermark(m_current_size.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+  }
+
+  void deregisterAllocation(std::size_t bytes) noexcept
+  {
+    m_current_size.fetch_sub(bytes, std::memory_order_relaxed);
+    m_allocation_count.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  void registerAllocations(std::size_t count, std::size_t bytes) noexcept
+  {
+    m_allocation_count.fetch_add(count, std::memory_order_relaxed);
+    updateHighWatermark(m_current_size.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+  }
+
+  void deregisterAllocations(std::size_t count, std::size_t bytes) noexcept
+  {
+    m_current_size.fetch_sub(bytes, std::memory_order_relaxed);
+    m_allocation_count.fetch_sub(count, std::memory_order_relaxed);
+  }
+
+  void resizeAllocation(std::size_t old_bytes, std::size_t new_bytes) noexcept
+  {
+    if (new_bytes > old_bytes) {
+      const std::size_t extra{new_bytes - old_bytes};
+      updateHighWatermark(m_current_size.fetch_add(extra, std::memory_order_relaxed) + extra);
+    } else {
+      m_current_size.fetch_sub(old_bytes - new_bytes, std::memory_order_relaxed);
+    }
+  }
+
+  std::size_t getCurrentSize() const noexcept
+  {
+    return m_current_size.load(std::memory_order_relaxed);
+  }
+
+  std::size_t getHighWatermark() const noexcept
+  {
+    return m_high_watermark.load(std::memory_order_relaxed);
+  }
+
+  std::size_t getAllocationCount() const noexcept
+  {
+    return m_allocation_count.load(std::memory_order_relaxed);
+  }
+
+  Snapshot snapshot() const noexcept
+  {
+    Snapshot s;
+    s.current_size = getCurrentSize();
+    s.high_watermark = getHighWatermark();
+    s.allocation_count = getAllocationCount();
+
+    // The high watermark is raised just after the current size
+    if (s.high_watermark < s.current_size) {
+      s.high_watermark = s.current_size;
+    }
+
+    return s;
+  }
+
+ private:
+  void updateHighWatermark(std::size_t current_size) noexcept
+  {
+    std::size_t high_watermark{m_high_watermark.load(std::memory_order_relaxed)};
+
+    while (current_size > high_watermark &&
+           !m_high_watermark.compare_exchange_weak(high_watermark, current_size, std::memory_order_relaxed)) {
+    }
+  }
+
+  std::atomic<std::size_t> m_current_size{0};
+  std::atomic<std::size_t> m_high_watermark{0};
+  std::atomic<std::size_t> m_allocation_count{0};
+};
+
+} // end of namespace util
+} // end of namespace umpire
+
+#endif // UMPIRE_AllocationCounters_HPP
@@ -152,10 +152,29 @@ AllocationMap::AllocationMap() : m_block_pool{sizeof(RecordList::RecordBlock)},
 {
 }
 
+AllocationMap::AllocationMap(std::size_t records_per_block)
+    : m_block_pool{sizeof(RecordList::RecordBlock), records_per_block}, m_map{}, m_size{0}, m_mutex{}
+{
+}
+
 void AllocationMap::insert(void* ptr, AllocationRecord record)
 {
   std::lock_guard<std::mutex> lock(m_mutex);
 
+  doInsert(ptr, record);
+}
+
+void AllocationMap::insert(const AllocationRecord* records, std::size_t count)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    doInsert(records[i].ptr, records[i]);
+  }
+}
+
+void AllocationMap::doInsert(void* ptr, const AllocationRecord& record)
+{
   UMPIRE_LOG(Debug, "Inserting " << ptr);
 
   auto pair = m_map.insert(ptr, *this, record);
@@ -236,6 +255,16 @@ AllocationRecord* AllocationMap::findRecord(void* ptr) noexcept
   return const_cast<AllocationRecord*>(const_cast<const AllocationMap*>(this)->findRecord(ptr));
 }
 
+const AllocationRecord* AllocationMap::findOrBefore(void* ptr) const noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  Map::ConstIterator iter = m_map.findOrBefore(ptr);
+
+  // faster, equivalent way of checking iter != m_map->end()
+  return iter->second ? iter->second->back() : nullptr;
+}
+
 AllocationRecord AllocationMap::remove(void* ptr)
 {
   std::lock_guard<std::mutex> lock(m_mutex);
@@ -260,6 +289,30 @@ AllocationRecord AllocationMap::remove(void* ptr)
   return ret;
 }
 
+void AllocationMap::remove(void* const* ptrs, std::size_t count, AllocationRecord* records)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    UMPIRE_LOG(Debug, "Removing " << ptrs[i]);
+
+    auto iter = m_map.find(ptrs[i]);
+
+    if (!iter->second) {
+      for (std::size_t j = 0; j < i; ++j) {
+        doInsert(records[j].ptr, records[j]);
+      }
+      UMPIRE_ERROR(runtime_error, fmt::format("Cannot remove {}", ptrs[i]));
+    }
+
+    records[i] = iter->second->pop_back();
+    if (iter->second->empty())
+      m_map.removeLast();
+
+    --m_size;
+  }
+}
+
 bool AllocationMap::contains(void* ptr) const
 {
   UMPIRE_LOG(Debug, "Searching for " << ptr);
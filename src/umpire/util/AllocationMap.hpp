@@ -117,12 +117,18 @@ class AllocationMap {
 
   AllocationMap();
 
+  // Size the internal record pool, in records per block
+  explicit AllocationMap(std::size_t records_per_block);
+
   // Would require a deep copy of the Judy data
   AllocationMap(const AllocationMap&) = delete;
 
   // Insert a new record -- copies record
   void insert(void* ptr, AllocationRecord record);
 
+  // Insert count records, each at its own ptr, under a single lock
+  void insert(const AllocationRecord* records, std::size_t count);
+
   // Find a record -- throws an exception if the record is not found.
   // AllocationRecord addresses will not change once registered, so
   // the resulting address of a find(ptr) call can be stored
@@ -136,9 +142,18 @@ class AllocationMap {
   const AllocationRecord* findRecord(void* ptr) const noexcept;
   AllocationRecord* findRecord(void* ptr) noexcept;
 
+  // Return the last record inserted at the greatest key <= ptr, without
+  // checking that ptr lies inside it. Returns nullptr if there is no such key.
+  const AllocationRecord* findOrBefore(void* ptr) const noexcept;
+
   // Only allows erasing the last inserted entry for key = ptr
   AllocationRecord remove(void* ptr);
 
+  // Remove the records of count pointers into records, under a single lock.
+  // If a pointer is not found, the records already removed are inserted
+  // again before throwing.
+  void remove(void* const* ptrs, std::size_t count, AllocationRecord* records);
+
   // Check if a pointer has been added to the map.
   bool contains(void* ptr) const;
 
@@ -160,6 +175,9 @@ class AllocationMap {
   // Content of findRecord(void*) without the lock
   const AllocationRecord* doFindRecord(void* ptr) const noexcept;
 
+  // Content of insert(void*, AllocationRecord) without the lock
+  void doInsert(void* ptr, const AllocationRecord& record);
+
   // This block pool is used inside RecordList, but is needed here so its
   // destruction is linked to that of AllocationMap
   FixedMallocPool m_block_pool;
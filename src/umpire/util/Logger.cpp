@@ -21,6 +21,8 @@ static message::Level defaultLevel = message::Info;
 
 static const char* MessageLevelName[message::Num_Levels] = {"ERROR", "WARNING", "INFO", "DEBUG"};
 
+std::atomic<int> Logger::s_enabled_levels{0};
+
 static int case_insensitive_match(const std::string s1, const std::string s2)
 {
   return (s1.size() == s2.size()) && std::equal(s1.begin(), s1.end(), s2.begin(), [](char c1, char c2) {
@@ -51,6 +53,8 @@ void Logger::setLoggingMsgLevel(message::Level level) noexcept
 {
   for (int i = 0; i < message::Num_Levels; ++i)
     m_is_enabled[i] = (i <= level);
+
+  s_enabled_levels.store(level + 1, std::memory_order_relaxed);
 }
 
 void Logger::logMessage(message::Level level, const std::string& message, const std::string& fileName,
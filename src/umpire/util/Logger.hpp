@@ -7,6 +7,7 @@
 #ifndef UMPIRE_Logger_HPP
 #define UMPIRE_Logger_HPP
 
+#include <atomic>
 #include <string>
 
 namespace umpire {
@@ -43,6 +44,22 @@ class Logger {
       return true;
   };
 
+  /*!
+   * \brief Check whether messages of level are logged by the active Logger.
+   *
+   * Once the active Logger exists this is a single load and compare, so it
+   * can be checked on every allocation.
+   */
+  static bool isEnabled(message::Level level) noexcept
+  {
+    const int enabled_levels{s_enabled_levels.load(std::memory_order_relaxed)};
+
+    if (enabled_levels == 0)
+      return getActiveLogger()->logLevelEnabled(level);
+
+    return level < enabled_levels;
+  }
+
   ~Logger() noexcept = default;
   Logger(const Logger&) = delete;
   Logger& operator=(const Logger&) = delete;
@@ -51,6 +68,10 @@ class Logger {
   Logger() noexcept;
 
   bool m_is_enabled[message::Num_Levels];
+
+  // One more than the most verbose level enabled, or 0 before the active
+  // Logger is created
+  static std::atomic<int> s_enabled_levels;
 };
 
 } // end namespace util
@@ -18,6 +18,14 @@
 
 #define UMPIRE_ASSERT(condition) assert(condition)
 
+#if defined(__GNUC__) || defined(__clang__)
+#define UMPIRE_LIKELY(condition) __builtin_expect(!!(condition), 1)
+#define UMPIRE_UNLIKELY(condition) __builtin_expect(!!(condition), 0)
+#else
+#define UMPIRE_LIKELY(condition) (condition)
+#define UMPIRE_UNLIKELY(condition) (condition)
+#endif
+
 #ifdef UMPIRE_ENABLE_LOGGING
 #ifdef UMPIRE_ENABLE_SLIC
 #include <stdlib.h>  // for getenv()
@@ -61,7 +69,7 @@
 #include "umpire/util/Logger.hpp"
 #define UMPIRE_LOG(lvl, msg)                                                                           \
   {                                                                                                    \
-    if (umpire::util::Logger::getActiveLogger()->logLevelEnabled(umpire::util::message::lvl)) {        \
+    if (UMPIRE_UNLIKELY(umpire::util::Logger::isEnabled(umpire::util::message::lvl))) {                \
       std::ostringstream local_msg;                                                                    \
       local_msg << " " << __func__ << " " << msg;                                                      \
       umpire::util::Logger::getActiveLogger()->logMessage(umpire::util::message::lvl, local_msg.str(), \
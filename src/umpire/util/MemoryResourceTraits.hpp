@@ -29,6 +29,8 @@ struct MemoryResourceTraits {
 
   enum class shared_scope { unknown, node, socket };
 
+  enum class page_type { standard, transparent_huge, huge };
+
   int id;
 
   // variables for only SYCL devices (i.e., Intel GPUs)
@@ -47,6 +49,11 @@ struct MemoryResourceTraits {
   resource_type resource = resource_type::unknown;
   shared_scope scope = shared_scope::unknown;
   bool tracking{true};
+
+  // Pages backing memory from the HUGEPAGE resource, and the size of huge
+  // pages (0 for the default huge page size of the system)
+  page_type pages = page_type::standard;
+  std::size_t page_size = 0;
 };
 
 } // end of namespace umpire
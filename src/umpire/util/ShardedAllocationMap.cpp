@@ -0,0 +1,271 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/util/ShardedAllocationMap.hpp"
+
+#include "umpire/util/Macros.hpp"
+#include "umpire/util/error.hpp"
+
+namespace umpire {
+namespace util {
+
+namespace {
+
+// Records per FixedMallocPool block used by a single AllocationMap
+constexpr std::size_t s_total_records_per_block{1024 * 1024};
+
+// Records are assigned to shards by the 4 KiB region their address lies in,
+// so that a pointer into an allocation usually maps to the same shard as the
+// start of that allocation
+constexpr unsigned int s_region_shift{12};
+
+inline std::uintptr_t region_of(const void* ptr) noexcept
+{
+  return reinterpret_cast<std::uintptr_t>(ptr) >> s_region_shift;
+}
+
+} // end of anonymous namespace
+
+constexpr std::size_t ShardedAllocationMap::s_default_num_shards;
+
+ShardedAllocationMap::ShardedAllocationMap(std::size_t num_shards) : m_shards{}, m_shard_shift{64}
+{
+  std::size_t shards{1};
+  while (shards < num_shards) {
+    shards <<= 1;
+    --m_shard_shift;
+  }
+
+  const std::size_t records_per_block{(s_total_records_per_block / shards > 1024) ? s_total_records_per_block / shards
+                                                                                   : 1024};
+
+  m_shards.reserve(shards);
+  for (std::size_t i = 0; i < shards; ++i) {
+    m_shards.emplace_back(new AllocationMap{records_per_block});
+  }
+}
+
+AllocationMap& ShardedAllocationMap::shardFor(void* ptr) const noexcept
+{
+  if (m_shards.size() == 1) {
+    return *m_shards.front();
+  }
+
+  // Fibonacci hashing: multiply by 2^64 / golden ratio and keep the top bits
+  const std::uint64_t key{static_cast<std::uint64_t>(region_of(ptr))};
+  return *m_shards[static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> m_shard_shift)];
+}
+
+void ShardedAllocationMap::insert(void* ptr, AllocationRecord record)
+{
+  shardFor(ptr).insert(ptr, record);
+}
+
+void ShardedAllocationMap::insert(const AllocationRecord* records, std::size_t count)
+{
+  for (std::size_t i = 0; i < count; ++i) {
+    shardFor(records[i].ptr).insert(records[i].ptr, records[i]);
+  }
+}
+
+const AllocationRecord* ShardedAllocationMap::find(void* ptr) const
+{
+  UMPIRE_LOG(Debug, "Searching for " << ptr);
+
+  const AllocationRecord* alloc_record = findRecord(ptr);
+
+  if (alloc_record) {
+    return alloc_record;
+  } else {
+#if !(defined(NDEBUG) || defined(UMPIRE_DISABLE_ALLOCATIONMAP_DEBUG))
+    // use this from a debugger to dump the contents of the AllocationMap
+    printAll();
+#endif
+    UMPIRE_ERROR(unknown_pointer_error, fmt::format("Allocation not mapped: {}", ptr));
+  }
+}
+
+AllocationRecord* ShardedAllocationMap::find(void* ptr)
+{
+  return const_cast<AllocationRecord*>(const_cast<const ShardedAllocationMap*>(this)->find(ptr));
+}
+
+const AllocationRecord* ShardedAllocationMap::findRecord(void* ptr) const noexcept
+{
+  //
+  // Every key in the same region as ptr lives in ptr's shard, so if the
+  // closest key in that shard is in ptr's region it is the closest key
+  // overall. This covers lookups by start address and most interior pointers.
+  //
+  const AllocationRecord* candidate = shardFor(ptr).findOrBefore(ptr);
+
+  if (!candidate || region_of(candidate->ptr) != region_of(ptr)) {
+    //
+    // Otherwise the closest key is in an earlier region, which may belong to
+    // any shard.
+    //
+    candidate = nullptr;
+    for (const auto& shard : m_shards) {
+      const AllocationRecord* record = shard->findOrBefore(ptr);
+      if (record && (!candidate || record->ptr > candidate->ptr)) {
+        candidate = record;
+      }
+    }
+  }
+
+  if (candidate) {
+    UMPIRE_ASSERT(candidate->ptr <= ptr);
+
+    // Check if ptr is inside candidate's allocation
+    const bool in_candidate =
+        (static_cast<char*>(candidate->ptr) + candidate->size) > static_cast<char*>(ptr) || (candidate->ptr == ptr);
+
+    if (in_candidate) {
+      UMPIRE_LOG(Debug, "Found " << ptr << " at " << candidate->ptr << " with size " << candidate->size);
+      return candidate;
+    }
+  }
+
+  return nullptr;
+}
+
+AllocationRecord* ShardedAllocationMap::findRecord(void* ptr) noexcept
+{
+  return const_cast<AllocationRecord*>(const_cast<const ShardedAllocationMap*>(this)->findRecord(ptr));
+}
+
+AllocationRecord ShardedAllocationMap::remove(void* ptr)
+{
+  return shardFor(ptr).remove(ptr);
+}
+
+void ShardedAllocationMap::remove(void* const* ptrs, std::size_t count, AllocationRecord* records)
+{
+  for (std::size_t i = 0; i < count; ++i) {
+    try {
+      records[i] = shardFor(ptrs[i]).remove(ptrs[i]);
+    } catch (...) {
+      insert(records, i);
+      throw;
+    }
+  }
+}
+
+bool ShardedAllocationMap::contains(void* ptr) const
+{
+  UMPIRE_LOG(Debug, "Searching for " << ptr);
+  return (findRecord(ptr) != nullptr);
+}
+
+void ShardedAllocationMap::clear()
+{
+  for (auto& shard : m_shards) {
+    shard->clear();
+  }
+}
+
+std::size_t ShardedAllocationMap::size() const
+{
+  std::size_t total{0};
+  for (const auto& shard : m_shards) {
+    total += shard->size();
+  }
+  return total;
+}
+
+std::size_t ShardedAllocationMap::numShards() const noexcept
+{
+  return m_shards.size();
+}
+
+void ShardedAllocationMap::print(const std::function<bool(const AllocationRecord&)>&& pred, std::ostream& os) const
+{
+  for (const auto& shard : m_shards) {
+    shard->print(std::function<bool(const AllocationRecord&)>{pred}, os);
+  }
+}
+
+void ShardedAllocationMap::printAll(std::ostream& os) const
+{
+  os << "🔍 Printing allocation map contents..." << std::endl;
+  print([](const AllocationRecord&) { return true; }, os);
+  os << "done." << std::endl;
+}
+
+ShardedAllocationMap::ConstIterator ShardedAllocationMap::begin() const
+{
+  return ShardedAllocationMap::ConstIterator{this, iterator_begin{}};
+}
+
+ShardedAllocationMap::ConstIterator ShardedAllocationMap::end() const
+{
+  return ShardedAllocationMap::ConstIterator{this, iterator_end{}};
+}
+
+ShardedAllocationMap::ConstIterator::ConstIterator(const ShardedAllocationMap* map, iterator_begin)
+    : m_map(map), m_shard(0), m_iter(map->m_shards.front()->begin()), m_end(map->m_shards.front()->end())
+{
+  skipEmptyShards();
+}
+
+ShardedAllocationMap::ConstIterator::ConstIterator(const ShardedAllocationMap* map, iterator_end)
+    : m_map(map),
+      m_shard(map->m_shards.size()),
+      m_iter(map->m_shards.back()->end()),
+      m_end(map->m_shards.back()->end())
+{
+}
+
+void ShardedAllocationMap::ConstIterator::skipEmptyShards()
+{
+  while (m_iter == m_end && m_shard < m_map->m_shards.size()) {
+    ++m_shard;
+    if (m_shard < m_map->m_shards.size()) {
+      m_iter = m_map->m_shards[m_shard]->begin();
+      m_end = m_map->m_shards[m_shard]->end();
+    } else {
+      m_iter = m_map->m_shards.back()->end();
+      m_end = m_iter;
+    }
+  }
+}
+
+const AllocationRecord& ShardedAllocationMap::ConstIterator::operator*()
+{
+  return m_iter.operator*();
+}
+
+const AllocationRecord* ShardedAllocationMap::ConstIterator::operator->()
+{
+  return m_iter.operator->();
+}
+
+ShardedAllocationMap::ConstIterator& ShardedAllocationMap::ConstIterator::operator++()
+{
+  ++m_iter;
+  skipEmptyShards();
+  return *this;
+}
+
+ShardedAllocationMap::ConstIterator ShardedAllocationMap::ConstIterator::operator++(int)
+{
+  ConstIterator tmp{*this};
+  ++(*this);
+  return tmp;
+}
+
+bool ShardedAllocationMap::ConstIterator::operator==(const ShardedAllocationMap::ConstIterator& other) const
+{
+  return m_map == other.m_map && m_shard == other.m_shard && m_iter == other.m_iter;
+}
+
+bool ShardedAllocationMap::ConstIterator::operator!=(const ShardedAllocationMap::ConstIterator& other) const
+{
+  return !(*this == other);
+}
+
+} // end of namespace util
+} // end of namespace umpire
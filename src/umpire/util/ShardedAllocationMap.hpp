@@ -0,0 +1,121 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_ShardedAllocationMap_HPP
+#define UMPIRE_ShardedAllocationMap_HPP
+
+// ShardedAllocationMap splits the AllocationMap into independently locked
+// shards selected by a hash of the address region an allocation starts in,
+// so that threads registering and deregistering different allocations do not
+// contend on a single lock. It provides the same interface as AllocationMap.
+// Looking up a pointer whose closest allocation starts in an earlier region
+// has to search every shard.
+
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include "umpire/util/AllocationMap.hpp"
+#include "umpire/util/AllocationRecord.hpp"
+
+namespace umpire {
+namespace util {
+
+class ShardedAllocationMap {
+ public:
+  static constexpr std::size_t s_default_num_shards{64};
+
+  // Iterator that walks each shard in turn. Records are ordered by address
+  // within a shard, but not across shards.
+  class ConstIterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = AllocationRecord;
+    using difference_type = std::ptrdiff_t;
+    using pointer = value_type*;
+    using reference = value_type&;
+
+    ConstIterator(const ShardedAllocationMap* map, iterator_begin);
+    ConstIterator(const ShardedAllocationMap* map, iterator_end);
+    ConstIterator(const ConstIterator&) = default;
+
+    const AllocationRecord& operator*();
+    const AllocationRecord* operator->();
+    ConstIterator& operator++();
+    ConstIterator operator++(int);
+
+    bool operator==(const ConstIterator& other) const;
+    bool operator!=(const ConstIterator& other) const;
+
+   private:
+    void skipEmptyShards();
+
+    const ShardedAllocationMap* m_map;
+    std::size_t m_shard;
+    AllocationMap::ConstIterator m_iter;
+    AllocationMap::ConstIterator m_end;
+  };
+
+  // num_shards is rounded up to a power of two
+  explicit ShardedAllocationMap(std::size_t num_shards = s_default_num_shards);
+
+  ShardedAllocationMap(const ShardedAllocationMap&) = delete;
+
+  // Insert a new record -- copies record
+  void insert(void* ptr, AllocationRecord record);
+
+  // Insert count records, each at its own ptr. Each record takes the lock of
+  // its shard separately.
+  void insert(const AllocationRecord* records, std::size_t count);
+
+  // Find a record -- throws an exception if the record is not found.
+  const AllocationRecord* find(void* ptr) const;
+  AllocationRecord* find(void* ptr);
+
+  // This version of find never throws an exception
+  const AllocationRecord* findRecord(void* ptr) const noexcept;
+  AllocationRecord* findRecord(void* ptr) noexcept;
+
+  // Only allows erasing the last inserted entry for key = ptr
+  AllocationRecord remove(void* ptr);
+
+  // Remove the records of count pointers into records. If a pointer is not
+  // found, the records already removed are inserted again before throwing.
+  void remove(void* const* ptrs, std::size_t count, AllocationRecord* records);
+
+  // Check if a pointer has been added to the map.
+  bool contains(void* ptr) const;
+
+  // Clear all records from the map
+  void clear();
+
+  // Returns number of entries
+  std::size_t size() const;
+
+  std::size_t numShards() const noexcept;
+
+  // Print methods -- either matching a predicate or all records
+  void print(const std::function<bool(const AllocationRecord&)>&& predicate, std::ostream& os = std::cout) const;
+
+  void printAll(std::ostream& os = std::cout) const;
+
+  ConstIterator begin() const;
+  ConstIterator end() const;
+
+ private:
+  AllocationMap& shardFor(void* ptr) const noexcept;
+
+  std::vector<std::unique_ptr<AllocationMap>> m_shards;
+  std::size_t m_shard_shift;
+};
+
+} // end of namespace util
+} // end of namespace umpire
+
+#endif // UMPIRE_ShardedAllocationMap_HPP
@@ -15,17 +15,33 @@ namespace util {
 
 float relative_fragmentation(std::vector<util::AllocationRecord>& recs)
 {
+  if (recs.size() < 2) {
+    return 0.0f;
+  }
+
+  std::sort(recs.begin(), recs.end(),
+            [](const util::AllocationRecord& a, const util::AllocationRecord& b) { return a.ptr < b.ptr; });
+
   auto r1 = recs.begin();
   auto r2 = recs.begin();
   ++r2;
   std::size_t largest_free_space = 0;
   std::size_t total_free_space = 0;
-  while (r2 != recs.end()) {
+  for (; r2 != recs.end(); ++r1, ++r2) {
     const std::size_t free_space = reinterpret_cast<char*>(r2->ptr) - (reinterpret_cast<char*>(r1->ptr) + r1->size);
     largest_free_space = std::max(largest_free_space, free_space);
     total_free_space += free_space;
   }
 
+  return relative_fragmentation(largest_free_space, total_free_space);
+}
+
+float relative_fragmentation(std::size_t largest_free_space, std::size_t total_free_space) noexcept
+{
+  if (total_free_space == 0) {
+    return 0.0f;
+  }
+
   return 1.0f - static_cast<float>(largest_free_space) / (total_free_space + std::numeric_limits<float>::epsilon());
 }
 
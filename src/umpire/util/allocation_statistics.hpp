@@ -7,6 +7,7 @@
 #ifndef UMPIRE_allocation_statistics_HPP
 #define UMPIRE_allocation_statistics_HPP
 
+#include <cstddef>
 #include <vector>
 
 #include "umpire/util/AllocationRecord.hpp"
@@ -17,10 +18,21 @@ namespace util {
 /*!
  * \brief Compute the relative fragmentation of a set of allocation records.
  *
+ * The free space is taken to be the gaps between the records, which are
+ * sorted by address.
+ *
  * Fragmentation = 1 - (largest free block) / (total free space)
  */
 float relative_fragmentation(std::vector<util::AllocationRecord>& recs);
 
+/*!
+ * \brief Compute the relative fragmentation of free space that has already
+ * been measured, such as the free blocks of a pool.
+ *
+ * Returns 0 if there is no free space.
+ */
+float relative_fragmentation(std::size_t largest_free_space, std::size_t total_free_space) noexcept;
+
 } // namespace util
 } // namespace umpire
 
@@ -81,6 +81,8 @@ class out_of_memory_error : public umpire::runtime_error {
   int m_allocator{-1};
 
   friend class Allocator;
+  template <typename Strategy>
+  friend class StaticAllocator;
 };
 
 class unknown_pointer_error : public umpire::runtime_error {
@@ -8,8 +8,11 @@
 
 #include <numa.h>
 #include <numaif.h>
+#include <sched.h>
 #include <unistd.h>
 
+#include <cstdint>
+
 #include "umpire/util/Macros.hpp"
 #include "umpire/util/error.hpp"
 
@@ -30,6 +33,19 @@ int preferred_node()
   return numa_preferred();
 }
 
+int current_node()
+{
+  if (numa_available() < 0)
+    UMPIRE_ERROR(runtime_error, "libnuma is unusable.");
+
+  const int cpu = sched_getcpu();
+  if (cpu < 0) {
+    UMPIRE_ERROR(runtime_error, fmt::format("numa::current_node error: sched_getcpu() failed: {}", strerror(errno)));
+  }
+
+  return numa_node_of_cpu(cpu);
+}
+
 void move_to_node(void* ptr, std::size_t bytes, int node)
 {
   if (numa_available() < 0)
@@ -48,6 +64,37 @@ void move_to_node(void* ptr, std::size_t bytes, int node)
   numa_bitmask_free(mask);
 }
 
+void interleave(void* ptr, std::size_t bytes, const std::vector<int>& nodes)
+{
+  if (numa_available() < 0)
+    UMPIRE_ERROR(runtime_error, "libnuma is unusable.");
+
+  struct bitmask* mask = numa_bitmask_alloc(numa_max_node() + 1);
+  numa_bitmask_clearall(mask);
+  for (auto node : nodes) {
+    numa_bitmask_setbit(mask, node);
+  }
+
+  if (mbind(ptr, bytes, MPOL_INTERLEAVE, mask->maskp, mask->size + 1, MPOL_MF_MOVE) != 0) {
+    numa_bitmask_free(mask);
+    UMPIRE_ERROR(runtime_error, fmt::format("numa::interleave error: mbind( ptr = {}, bytes = {} ) failed: {}", ptr,
+                                            bytes, strerror(errno)));
+  }
+
+  numa_bitmask_free(mask);
+}
+
+void run_on_node(int node)
+{
+  if (numa_available() < 0)
+    UMPIRE_ERROR(runtime_error, "libnuma is unusable.");
+
+  if (numa_run_on_node(node) != 0) {
+    UMPIRE_ERROR(runtime_error, fmt::format("numa::run_on_node error: numa_run_on_node( node = {} ) failed: {}", node,
+                                            strerror(errno)));
+  }
+}
+
 int get_location(void* ptr)
 {
   int numa_node = -1;
@@ -58,6 +105,19 @@ int get_location(void* ptr)
   return numa_node;
 }
 
+int get_resident_node(const void* ptr) noexcept
+{
+  const std::uintptr_t page_size = static_cast<std::uintptr_t>(get_page_size());
+  void* page = reinterpret_cast<void*>(reinterpret_cast<std::uintptr_t>(ptr) & ~(page_size - 1));
+
+  // With no target nodes, move_pages only reports where the pages are
+  int status = -1;
+  if (move_pages(0, 1, &page, NULL, &status, 0) != 0 || status < 0) {
+    return -1;
+  }
+  return status;
+}
+
 std::vector<int> get_host_nodes()
 {
   if (numa_available() < 0)
@@ -20,12 +20,25 @@ namespace numa {
 // Return the preferred numa node
 int preferred_node();
 
+// Return the numa node of the CPU the calling thread is running on
+int current_node();
+
 // Move page-aligned address of size bytes to node
 void move_to_node(void* ptr, std::size_t bytes, int node);
 
+// Interleave the pages of page-aligned address of size bytes across nodes
+void interleave(void* ptr, std::size_t bytes, const std::vector<int>& nodes);
+
+// Restrict the calling thread to run on the CPUs of node
+void run_on_node(int node);
+
 // Return the numa node where address ptr resides
 int get_location(void* ptr);
 
+// Return the numa node of the page holding ptr without faulting it in, or -1
+// if the page is not resident
+int get_resident_node(const void* ptr) noexcept;
+
 // List host NUMA nodes
 std::vector<int> get_host_nodes();
 
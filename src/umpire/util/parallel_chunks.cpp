@@ -0,0 +1,107 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/util/parallel_chunks.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "umpire/config.hpp"
+
+#if defined(UMPIRE_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+#if defined(UMPIRE_ENABLE_NUMA)
+#include "umpire/util/numa.hpp"
+#endif
+
+namespace umpire {
+namespace util {
+
+namespace {
+
+// The smallest page size in use, so chunks never share a page
+constexpr std::uintptr_t s_page_size{4096};
+
+} // end of anonymous namespace
+
+std::size_t parallel_chunk_threads() noexcept
+{
+#if defined(UMPIRE_ENABLE_OPENMP)
+  return static_cast<std::size_t>(omp_get_max_threads());
+#else
+  return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+#endif
+}
+
+void parallel_for_each_chunk(void* ptr, std::size_t length, std::size_t min_chunk_size, std::size_t num_threads,
+                             const std::function<void(std::size_t, std::size_t)>& f)
+{
+  if (num_threads == 0) {
+    num_threads = parallel_chunk_threads();
+  }
+
+  min_chunk_size = std::max<std::size_t>(min_chunk_size, s_page_size);
+  const std::size_t num_chunks{std::min(num_threads, length / min_chunk_size)};
+
+  if (num_chunks < 2) {
+    f(0, length);
+    return;
+  }
+
+  //
+  // Chunk boundaries are moved down to the start of their page, which keeps
+  // them in order as every chunk is at least a page long.
+  //
+  const std::uintptr_t base{reinterpret_cast<std::uintptr_t>(ptr)};
+  std::vector<std::size_t> offsets(num_chunks + 1);
+  for (std::size_t i = 1; i < num_chunks; ++i) {
+    const std::uintptr_t boundary{base + length / num_chunks * i};
+    offsets[i] = static_cast<std::size_t>((boundary & ~(s_page_size - 1)) - base);
+  }
+  offsets[0] = 0;
+  offsets[num_chunks] = length;
+
+#if defined(UMPIRE_ENABLE_OPENMP)
+  const int n{static_cast<int>(num_chunks)};
+#pragma omp parallel for schedule(static, 1) num_threads(n)
+  for (int i = 0; i < n; ++i) {
+    f(offsets[i], offsets[i + 1] - offsets[i]);
+  }
+#else
+  std::vector<std::thread> threads;
+  threads.reserve(num_chunks - 1);
+
+  for (std::size_t i = 1; i < num_chunks; ++i) {
+    threads.emplace_back([&, i] {
+#if defined(UMPIRE_ENABLE_NUMA)
+      const int node{numa::get_resident_node(static_cast<char*>(ptr) + offsets[i])};
+      if (node >= 0) {
+        try {
+          numa::run_on_node(node);
+        } catch (...) {
+          // Running anywhere is only slower
+        }
+      }
+#endif
+      f(offsets[i], offsets[i + 1] - offsets[i]);
+    });
+  }
+
+  // The calling thread keeps its own affinity and does the first chunk
+  f(offsets[0], offsets[1] - offsets[0]);
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+#endif
+}
+
+} // namespace util
+} // namespace umpire
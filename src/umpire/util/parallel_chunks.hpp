@@ -0,0 +1,47 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_parallel_chunks_HPP
+#define UMPIRE_parallel_chunks_HPP
+
+#include <cstddef>
+#include <functional>
+
+namespace umpire {
+namespace util {
+
+/*!
+ * \brief Return the number of threads parallel_for_each_chunk may use.
+ *
+ * This is the number of OpenMP threads when Umpire is built with OpenMP, and
+ * the number of hardware threads otherwise.
+ */
+std::size_t parallel_chunk_threads() noexcept;
+
+/*!
+ * \brief Split length bytes starting at ptr into chunks of at least
+ * min_chunk_size bytes, and call f(offset, bytes) for every chunk in
+ * parallel on up to num_threads threads, or parallel_chunk_threads() when
+ * num_threads is 0.
+ *
+ * The chunks are contiguous, one per thread, and start on page boundaries so
+ * that no two threads write to the same page. With OpenMP, chunk i is run by
+ * OpenMP thread i, the static partition a "parallel for" uses, so memory
+ * placed by first touch in such a loop is written by threads on its own NUMA
+ * node. Without OpenMP, each chunk gets its own thread, which is run on the
+ * NUMA node holding the start of its chunk when Umpire is built with NUMA
+ * support.
+ *
+ * When length is less than twice min_chunk_size, f(0, length) is called on
+ * the calling thread.
+ */
+void parallel_for_each_chunk(void* ptr, std::size_t length, std::size_t min_chunk_size, std::size_t num_threads,
+                             const std::function<void(std::size_t, std::size_t)>& f);
+
+} // namespace util
+} // namespace umpire
+
+#endif // UMPIRE_parallel_chunks_HPP
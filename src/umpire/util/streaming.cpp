@@ -0,0 +1,276 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "umpire/util/streaming.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define UMPIRE_STREAMING_X86
+#include <immintrin.h>
+#endif
+
+#if defined(__unix__)
+#include <unistd.h>
+#endif
+
+namespace umpire {
+namespace util {
+
+namespace {
+
+#if defined(UMPIRE_STREAMING_X86)
+
+//
+// Each kernel copies the bytes up to the first address of dst aligned to its
+// vector width with std::memcpy, streams whole blocks of four vectors, and
+// copies what is left with std::memcpy. The sfence orders the non-temporal
+// stores before any store that follows, such as one that publishes the data
+// to another thread.
+//
+template <std::size_t Width>
+std::size_t head_bytes(const void* dst, std::size_t length) noexcept
+{
+  const std::size_t misalignment{reinterpret_cast<std::uintptr_t>(dst) & (Width - 1)};
+  return std::min(length, misalignment == 0 ? 0 : Width - misalignment);
+}
+
+void copy_sse2(char* dst, const char* src, std::size_t length) noexcept
+{
+  const std::size_t head{head_bytes<16>(dst, length)};
+  std::memcpy(dst, src, head);
+  dst += head;
+  src += head;
+  length -= head;
+
+  const std::size_t body{length & ~std::size_t{63}};
+  for (std::size_t i = 0; i < body; i += 64) {
+    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 16));
+    const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 32));
+    const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 48));
+    _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i), a);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 16), b);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 32), c);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 48), d);
+  }
+  _mm_sfence();
+
+  std::memcpy(dst + body, src + body, length - body);
+}
+
+__attribute__((target("avx2"))) void copy_avx2(char* dst, const char* src, std::size_t length) noexcept
+{
+  const std::size_t head{head_bytes<32>(dst, length)};
+  std::memcpy(dst, src, head);
+  dst += head;
+  src += head;
+  length -= head;
+
+  const std::size_t body{length & ~std::size_t{127}};
+  for (std::size_t i = 0; i < body; i += 128) {
+    const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+    const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 32));
+    const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 64));
+    const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 96));
+    _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + i), a);
+    _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + i + 32), b);
+    _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + i + 64), c);
+    _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + i + 96), d);
+  }
+  _mm_sfence();
+
+  std::memcpy(dst + body, src + body, length - body);
+}
+
+__attribute__((target("avx512f"))) void copy_avx512(char* dst, const char* src, std::size_t length) noexcept
+{
+  const std::size_t head{head_bytes<64>(dst, length)};
+  std::memcpy(dst, src, head);
+  dst += head;
+  src += head;
+  length -= head;
+
+  const std::size_t body{length & ~std::size_t{255}};
+  for (std::size_t i = 0; i < body; i += 256) {
+    const __m512i a = _mm512_loadu_si512(src + i);
+    const __m512i b = _mm512_loadu_si512(src + i + 64);
+    const __m512i c = _mm512_loadu_si512(src + i + 128);
+    const __m512i d = _mm512_loadu_si512(src + i + 192);
+    _mm512_stream_si512(reinterpret_cast<__m512i*>(dst + i), a);
+    _mm512_stream_si512(reinterpret_cast<__m512i*>(dst + i + 64), b);
+    _mm512_stream_si512(reinterpret_cast<__m512i*>(dst + i + 128), c);
+    _mm512_stream_si512(reinterpret_cast<__m512i*>(dst + i + 192), d);
+  }
+  _mm_sfence();
+
+  std::memcpy(dst + body, src + body, length - body);
+}
+
+void set_sse2(char* ptr, int value, std::size_t length) noexcept
+{
+  const std::size_t head{head_bytes<16>(ptr, length)};
+  std::memset(ptr, value, head);
+  ptr += head;
+  length -= head;
+
+  const __m128i v = _mm_set1_epi8(static_cast<char>(value));
+  const std::size_t body{length & ~std::size_t{63}};
+  for (std::size_t i = 0; i < body; i += 64) {
+    _mm_stream_si128(reinterpret_cast<__m128i*>(ptr + i), v);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(ptr + i + 16), v);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(ptr + i + 32), v);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(ptr + i + 48), v);
+  }
+  _mm_sfence();
+
+  std::memset(ptr + body, value, length - body);
+}
+
+__attribute__((target("avx2"))) void set_avx2(char* ptr, int value, std::size_t length) noexcept
+{
+  const std::size_t head{head_bytes<32>(ptr, length)};
+  std::memset(ptr, value, head);
+  ptr += head;
+  length -= head;
+
+  const __m256i v = _mm256_set1_epi8(static_cast<char>(value));
+  const std::size_t body{length & ~std::size_t{127}};
+  for (std::size_t i = 0; i < body; i += 128) {
+    _mm256_stream_si256(reinterpret_cast<__m256i*>(ptr + i), v);
+    _mm256_stream_si256(reinterpret_cast<__m256i*>(ptr + i + 32), v);
+    _mm256_stream_si256(reinterpret_cast<__m256i*>(ptr + i + 64), v);
+    _mm256_stream_si256(reinterpret_cast<__m256i*>(ptr + i + 96), v);
+  }
+  _mm_sfence();
+
+  std::memset(ptr + body, value, length - body);
+}
+
+__attribute__((target("avx512f"))) void set_avx512(char* ptr, int value, std::size_t length) noexcept
+{
+  const std::size_t head{head_bytes<64>(ptr, length)};
+  std::memset(ptr, value, head);
+  ptr += head;
+  length -= head;
+
+  // Broadcasting bytes needs AVX-512BW, so the byte is repeated in an int
+  const int word{static_cast<int>(static_cast<unsigned char>(value) * 0x01010101u)};
+  const __m512i v = _mm512_set1_epi32(word);
+  const std::size_t body{length & ~std::size_t{255}};
+  for (std::size_t i = 0; i < body; i += 256) {
+    _mm512_stream_si512(reinterpret_cast<__m512i*>(ptr + i), v);
+    _mm512_stream_si512(reinterpret_cast<__m512i*>(ptr + i + 64), v);
+    _mm512_stream_si512(reinterpret_cast<__m512i*>(ptr + i + 128), v);
+    _mm512_stream_si512(reinterpret_cast<__m512i*>(ptr + i + 192), v);
+  }
+  _mm_sfence();
+
+  std::memset(ptr + body, value, length - body);
+}
+
+streaming_isa detect_isa() noexcept
+{
+  __builtin_cpu_init();
+
+  if (__builtin_cpu_supports("avx512f")) {
+    return streaming_isa::avx512;
+  } else if (__builtin_cpu_supports("avx2")) {
+    return streaming_isa::avx2;
+  }
+  return streaming_isa::sse2;
+}
+
+#else
+
+streaming_isa detect_isa() noexcept
+{
+  return streaming_isa::scalar;
+}
+
+#endif
+
+} // end of anonymous namespace
+
+streaming_isa best_streaming_isa() noexcept
+{
+  static const streaming_isa s_isa{detect_isa()};
+  return s_isa;
+}
+
+std::size_t last_level_cache_size() noexcept
+{
+  static const std::size_t s_size{[] {
+    long size{0};
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+    size = ::sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+#if defined(_SC_LEVEL2_CACHE_SIZE)
+    if (size <= 0) {
+      size = ::sysconf(_SC_LEVEL2_CACHE_SIZE);
+    }
+#endif
+    return size > 0 ? static_cast<std::size_t>(size) : std::size_t{32} * 1024 * 1024;
+  }()};
+
+  return s_size;
+}
+
+void streaming_memcpy(void* dst, const void* src, std::size_t length, streaming_isa isa) noexcept
+{
+#if defined(UMPIRE_STREAMING_X86)
+  char* d{static_cast<char*>(dst)};
+  const char* s{static_cast<const char*>(src)};
+
+  switch (std::min(isa, best_streaming_isa())) {
+    case streaming_isa::avx512:
+      copy_avx512(d, s, length);
+      return;
+    case streaming_isa::avx2:
+      copy_avx2(d, s, length);
+      return;
+    case streaming_isa::sse2:
+      copy_sse2(d, s, length);
+      return;
+    case streaming_isa::scalar:
+      break;
+  }
+#else
+  static_cast<void>(isa);
+#endif
+
+  std::memcpy(dst, src, length);
+}
+
+void streaming_memset(void* ptr, int value, std::size_t length, streaming_isa isa) noexcept
+{
+#if defined(UMPIRE_STREAMING_X86)
+  char* p{static_cast<char*>(ptr)};
+
+  switch (std::min(isa, best_streaming_isa())) {
+    case streaming_isa::avx512:
+      set_avx512(p, value, length);
+      return;
+    case streaming_isa::avx2:
+      set_avx2(p, value, length);
+      return;
+    case streaming_isa::sse2:
+      set_sse2(p, value, length);
+      return;
+    case streaming_isa::scalar:
+      break;
+  }
+#else
+  static_cast<void>(isa);
+#endif
+
+  std::memset(ptr, value, length);
+}
+
+} // namespace util
+} // namespace umpire
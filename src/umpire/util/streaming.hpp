@@ -0,0 +1,59 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef UMPIRE_streaming_HPP
+#define UMPIRE_streaming_HPP
+
+#include <cstddef>
+
+namespace umpire {
+namespace util {
+
+/*!
+ * \brief Instruction sets with which memory can be written using
+ * non-temporal stores, from the least to the most capable.
+ */
+enum class streaming_isa { scalar, sse2, avx2, avx512 };
+
+/*!
+ * \brief Return the most capable instruction set supported by the CPU, found
+ * with CPUID the first time this is called.
+ *
+ * This is streaming_isa::scalar when Umpire is not built for x86-64 with GCC
+ * or Clang.
+ */
+streaming_isa best_streaming_isa() noexcept;
+
+/*!
+ * \brief Return the size of the last level cache in bytes, or 32MiB when it
+ * cannot be found.
+ */
+std::size_t last_level_cache_size() noexcept;
+
+/*!
+ * \brief Copy length bytes from src to dst with non-temporal stores.
+ *
+ * Non-temporal stores write whole cache lines straight to memory, so the
+ * destination is neither read first nor left in the cache. This is only
+ * faster than std::memcpy for transfers larger than the last level cache.
+ * The bytes before the first aligned vector and after the last are copied
+ * with std::memcpy, as is everything with streaming_isa::scalar. An isa the
+ * CPU does not support is lowered to best_streaming_isa().
+ */
+void streaming_memcpy(void* dst, const void* src, std::size_t length,
+                      streaming_isa isa = best_streaming_isa()) noexcept;
+
+/*!
+ * \brief Set length bytes starting at ptr to value with non-temporal stores.
+ *
+ * \see streaming_memcpy
+ */
+void streaming_memset(void* ptr, int value, std::size_t length, streaming_isa isa = best_streaming_isa()) noexcept;
+
+} // namespace util
+} // namespace umpire
+
+#endif // UMPIRE_streaming_HPP
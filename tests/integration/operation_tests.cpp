@@ -4,10 +4,18 @@
 //
 // SPDX-License-Identifier: (MIT)
 //////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <memory>
+
 #include "test_helpers.hpp"
 #include "umpire/Allocator.hpp"
 #include "umpire/ResourceManager.hpp"
 #include "umpire/config.hpp"
+#include "umpire/op/HostCopyOperation.hpp"
+#include "umpire/op/HostParallelCopyOperation.hpp"
+#include "umpire/op/HostParallelMemsetOperation.hpp"
+#include "umpire/op/HostStreamingCopyOperation.hpp"
+#include "umpire/op/HostStreamingMemsetOperation.hpp"
 #include "umpire/op/MemoryOperationRegistry.hpp"
 #include "umpire/strategy/AlignedAllocator.hpp"
 #include "umpire/strategy/AllocationAdvisor.hpp"
@@ -22,6 +30,7 @@
 #include "umpire/strategy/SlotPool.hpp"
 #include "umpire/strategy/ThreadSafeAllocator.hpp"
 #include "umpire/util/error.hpp"
+#include "umpire/util/streaming.hpp"
 
 #if defined(UMPIRE_ENABLE_CUDA)
 #include <cuda_runtime_api.h>
@@ -836,3 +845,110 @@ TEST(AsyncTest, Prefetch)
   alloc.deallocate(array);
 }
 #endif
+
+TEST(ParallelHostTest, Chunks)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+  auto alloc = rm.getAllocator("HOST");
+
+  // Small chunks and an unaligned start, so the copy is split unevenly
+  const std::size_t size{1024 * 1024 + 13};
+  char* src = static_cast<char*>(alloc.allocate(size + 1));
+  char* dst = static_cast<char*>(alloc.allocate(size + 1));
+
+  for (std::size_t i = 0; i < size + 1; ++i) {
+    src[i] = static_cast<char>(i % 251);
+  }
+
+  umpire::op::HostParallelMemsetOperation memset_op{4096, 4};
+  memset_op.apply(dst, nullptr, 7, size + 1);
+  ASSERT_TRUE(std::all_of(dst, dst + size + 1, [](char c) { return c == 7; }));
+
+  void* dst_ptr = dst + 1;
+  umpire::op::HostParallelCopyOperation copy_op{4096, 4};
+  copy_op.transform(src + 1, &dst_ptr, nullptr, nullptr, size);
+  ASSERT_EQ(dst[0], 7);
+  ASSERT_TRUE(std::equal(src + 1, src + size + 1, dst + 1));
+
+  alloc.deallocate(src);
+  alloc.deallocate(dst);
+}
+
+TEST(ParallelHostTest, SelectedPerAllocator)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+  auto& op_registry = umpire::op::MemoryOperationRegistry::getInstance();
+
+  auto host = rm.getAllocator("HOST");
+  auto parallel = rm.makeAllocator<umpire::strategy::NamedAllocationStrategy>("parallel_host", host);
+
+  EXPECT_THROW(op_registry.setAllocatorOperation(parallel.getAllocationStrategy(), "COPY", "NO_SUCH_COPY"),
+               umpire::runtime_error);
+
+  op_registry.setAllocatorOperation(parallel.getAllocationStrategy(), "COPY", "PARALLEL_COPY");
+  op_registry.setAllocatorOperation(parallel.getAllocationStrategy(), "MEMSET", "PARALLEL_MEMSET");
+
+  auto copy = op_registry.find("COPY", host.getAllocationStrategy(), parallel.getAllocationStrategy());
+  ASSERT_NE(nullptr, std::dynamic_pointer_cast<umpire::op::HostParallelCopyOperation>(copy));
+  copy = op_registry.find("COPY", parallel.getAllocationStrategy(), host.getAllocationStrategy());
+  ASSERT_NE(nullptr, std::dynamic_pointer_cast<umpire::op::HostParallelCopyOperation>(copy));
+  copy = op_registry.find("COPY", host.getAllocationStrategy(), host.getAllocationStrategy());
+  ASSERT_NE(nullptr, std::dynamic_pointer_cast<umpire::op::HostCopyOperation>(copy));
+
+  const std::size_t size{16 * 1024 * 1024};
+  char* src = static_cast<char*>(host.allocate(size));
+  char* dst = static_cast<char*>(parallel.allocate(size));
+
+  rm.memset(src, 3);
+  rm.copy(dst, src);
+  ASSERT_TRUE(std::all_of(dst, dst + size, [](char c) { return c == 3; }));
+
+  op_registry.setAllocatorOperation(parallel.getAllocationStrategy(), "COPY", "");
+  copy = op_registry.find("COPY", host.getAllocationStrategy(), parallel.getAllocationStrategy());
+  ASSERT_NE(nullptr, std::dynamic_pointer_cast<umpire::op::HostCopyOperation>(copy));
+
+  host.deallocate(src);
+  parallel.deallocate(dst);
+}
+
+TEST(StreamingHostTest, SelectedPerAllocator)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+  auto& op_registry = umpire::op::MemoryOperationRegistry::getInstance();
+
+  auto host = rm.getAllocator("HOST");
+  auto streaming = rm.makeAllocator<umpire::strategy::NamedAllocationStrategy>("streaming_host", host);
+
+  op_registry.setAllocatorOperation(streaming.getAllocationStrategy(), "COPY", "STREAMING_COPY");
+  op_registry.setAllocatorOperation(streaming.getAllocationStrategy(), "MEMSET", "STREAMING_MEMSET");
+
+  auto copy = op_registry.find("COPY", host.getAllocationStrategy(), streaming.getAllocationStrategy());
+  ASSERT_NE(nullptr, std::dynamic_pointer_cast<umpire::op::HostStreamingCopyOperation>(copy));
+  auto memset = op_registry.find("MEMSET", streaming.getAllocationStrategy(), streaming.getAllocationStrategy());
+  ASSERT_NE(nullptr, std::dynamic_pointer_cast<umpire::op::HostStreamingMemsetOperation>(memset));
+
+  // Larger than the default threshold, so the non-temporal stores are used
+  const std::size_t size{umpire::util::last_level_cache_size() + 4099};
+  char* src = static_cast<char*>(host.allocate(size));
+  char* dst = static_cast<char*>(streaming.allocate(size));
+
+  rm.memset(src, 5);
+  rm.memset(dst, 0);
+  rm.copy(dst, src);
+  ASSERT_TRUE(std::all_of(dst, dst + size, [](char c) { return c == 5; }));
+
+  // A threshold of one byte streams small, unaligned copies too
+  umpire::op::HostStreamingMemsetOperation memset_op{1};
+  memset_op.apply(dst, nullptr, 9, 1000);
+  ASSERT_TRUE(std::all_of(dst, dst + 1000, [](char c) { return c == 9; }));
+  ASSERT_EQ(dst[1000], 5);
+
+  void* dst_ptr = dst + 3;
+  umpire::op::HostStreamingCopyOperation copy_op{1};
+  copy_op.transform(src + 1, &dst_ptr, nullptr, nullptr, 1000);
+  ASSERT_EQ(dst[2], 9);
+  ASSERT_TRUE(std::all_of(dst + 3, dst + 1003, [](char c) { return c == 5; }));
+
+  host.deallocate(src);
+  streaming.deallocate(dst);
+}
@@ -6,6 +6,7 @@
 //////////////////////////////////////////////////////////////////////////////
 #include <random>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "camp/camp.hpp"
@@ -16,6 +17,7 @@
 #include "umpire/config.hpp"
 #include "umpire/strategy/DynamicPoolList.hpp"
 #include "umpire/strategy/QuickPool.hpp"
+#include "umpire/strategy/SegregatedFitPool.hpp"
 #include "umpire/util/wrap_allocator.hpp"
 
 template <>
@@ -28,6 +30,11 @@ struct tag_to_string<umpire::strategy::QuickPool> {
   static constexpr const char* value = "QuickPool";
 };
 
+template <>
+struct tag_to_string<umpire::strategy::SegregatedFitPool> {
+  static constexpr const char* value = "SegregatedFitPool";
+};
+
 using ResourceTypes = camp::list<host_resource_tag
 #if defined(UMPIRE_ENABLE_DEVICE)
                                  ,
@@ -47,7 +54,8 @@ using ResourceTypes = camp::list<host_resource_tag
 #endif
                                  >;
 
-using PoolTypes = camp::list<umpire::strategy::DynamicPoolList, umpire::strategy::QuickPool>;
+using PoolTypes =
+    camp::list<umpire::strategy::DynamicPoolList, umpire::strategy::QuickPool, umpire::strategy::SegregatedFitPool>;
 using TestTypes = camp::cartesian_product<PoolTypes, ResourceTypes>;
 
 using PoolTestTypes = Test<TestTypes>::Types;
@@ -684,9 +692,129 @@ TYPED_TEST(PrimaryPoolTest, ReleasableSizeCheck)
   ASSERT_EQ(pool->getReleasableSize(), 0);
 }
 
+TYPED_TEST(PrimaryPoolTest, ReallocateInPlace)
+{
+  using Pool = typename TestFixture::Pool;
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  // SegregatedFitPool does not resize allocations, so reallocate copies
+  const bool in_place{!std::is_same<Pool, umpire::strategy::SegregatedFitPool>::value};
+
+  void* ptr{nullptr};
+  ASSERT_NO_THROW({ ptr = this->m_allocator->allocate(1024); });
+
+  // The rest of the first block is free
+  void* grown{nullptr};
+  ASSERT_NO_THROW({ grown = rm.reallocate(ptr, 4096); });
+  if (in_place) {
+    ASSERT_EQ(grown, ptr);
+  }
+  ASSERT_EQ(this->m_allocator->getSize(grown), 4096);
+  ASSERT_EQ(this->m_allocator->getCurrentSize(), 4096);
+
+  void* blocker{nullptr};
+  ASSERT_NO_THROW({ blocker = this->m_allocator->allocate(1024); });
+
+  void* shrunk{nullptr};
+  ASSERT_NO_THROW({ shrunk = rm.reallocate(grown, 512); });
+  if (in_place) {
+    ASSERT_EQ(shrunk, grown);
+  }
+  ASSERT_EQ(this->m_allocator->getSize(shrunk), 512);
+  ASSERT_EQ(this->m_allocator->getCurrentSize(), 512 + 1024);
+
+  // The space given up by the shrink can be grown back into
+  void* regrown{nullptr};
+  ASSERT_NO_THROW({ regrown = rm.reallocate(shrunk, 4096); });
+  if (in_place) {
+    ASSERT_EQ(regrown, shrunk);
+  }
+  ASSERT_EQ(this->m_allocator->getSize(regrown), 4096);
+
+  // Growing past the blocker has to move the allocation
+  void* moved{nullptr};
+  ASSERT_NO_THROW({ moved = rm.reallocate(regrown, 8192); });
+  ASSERT_NE(moved, regrown);
+  ASSERT_EQ(this->m_allocator->getSize(moved), 8192);
+  ASSERT_EQ(this->m_allocator->getCurrentSize(), 8192 + 1024);
+
+  ASSERT_NO_THROW({
+    this->m_allocator->deallocate(moved);
+    this->m_allocator->deallocate(blocker);
+  });
+  ASSERT_EQ(this->m_allocator->getCurrentSize(), 0);
+
+  ASSERT_NO_THROW(this->m_allocator->release());
+  ASSERT_EQ(this->m_allocator->getActualSize(), 0);
+}
+
+TYPED_TEST(PrimaryPoolTest, AllocateDeallocateBatch)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+  std::vector<std::size_t> sizes;
+  std::vector<void*> ptrs;
+  std::size_t total_size{0};
+
+  for (std::size_t i = 1; i <= 100; ++i) {
+    sizes.push_back(i * 8);
+    total_size += i * 8;
+  }
+
+  ASSERT_NO_THROW(this->m_allocator->allocate_batch(sizes, ptrs));
+  ASSERT_EQ(ptrs.size(), sizes.size());
+
+  for (std::size_t i = 0; i < ptrs.size(); ++i) {
+    ASSERT_NE(ptrs[i], nullptr);
+    ASSERT_EQ(rm.getSize(ptrs[i]), sizes[i]);
+    ASSERT_EQ(rm.getAllocator(ptrs[i]).getId(), this->m_allocator->getId());
+  }
+
+  ASSERT_EQ(this->m_allocator->getStatistics().current_size, total_size);
+  ASSERT_EQ(this->m_allocator->getAllocationCount(), sizes.size());
+
+  // Each allocation may also be freed on its own
+  ASSERT_NO_THROW(this->m_allocator->deallocate(ptrs.back()));
+  ptrs.back() = nullptr;
+
+  ASSERT_NO_THROW(this->m_allocator->deallocate_batch(ptrs));
+  ASSERT_EQ(this->m_allocator->getStatistics().current_size, 0);
+  ASSERT_EQ(this->m_allocator->getAllocationCount(), 0);
+
+  // Zero byte allocations are allowed
+  sizes = {0, 16, 0};
+  ASSERT_NO_THROW(this->m_allocator->allocate_batch(sizes, ptrs));
+  ASSERT_EQ(this->m_allocator->getAllocationCount(), 3);
+  ASSERT_NO_THROW(this->m_allocator->deallocate_batch(ptrs));
+  ASSERT_EQ(this->m_allocator->getAllocationCount(), 0);
+
+  ASSERT_NO_THROW(this->m_allocator->release());
+  ASSERT_EQ(this->m_allocator->getActualSize(), 0);
+}
+
+TYPED_TEST(PrimaryPoolTest, DeallocateBatchForeignPointer)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+  auto host = rm.getAllocator("HOST");
+
+  void* own{this->m_allocator->allocate(64)};
+  void* foreign{host.allocate(64)};
+  std::vector<void*> ptrs{own, foreign};
+
+  ASSERT_THROW(this->m_allocator->deallocate_batch(ptrs), umpire::runtime_error);
+
+  // Both allocations are still registered to their allocators
+  ASSERT_EQ(rm.getAllocator(own).getId(), this->m_allocator->getId());
+  ASSERT_EQ(rm.getAllocator(foreign).getId(), host.getId());
+  ASSERT_EQ(this->m_allocator->getAllocationCount(), 1);
+
+  ASSERT_NO_THROW(this->m_allocator->deallocate(own));
+  ASSERT_NO_THROW(host.deallocate(foreign));
+}
+
 #if defined(UMPIRE_ENABLE_CONST)
 using ConstResourceTypes = camp::list<device_const_resource_tag>;
-using ConstPoolTypes = camp::list<umpire::strategy::DynamicPoolList, umpire::strategy::QuickPool>;
+using ConstPoolTypes =
+    camp::list<umpire::strategy::DynamicPoolList, umpire::strategy::QuickPool, umpire::strategy::SegregatedFitPool>;
 using ConstTestTypes = camp::cartesian_product<ConstPoolTypes, ConstResourceTypes>;
 
 using ConstPoolTestTypes = Test<ConstTestTypes>::Types;
@@ -57,4 +57,36 @@ if [ $? -ne 0 ]; then
     cleanupandexit 1
 fi
 
+echo "$replayprogram -q --threads -i replay.replay"
+$replayprogram -i replay.replay -q --threads
+if [ $? -ne 0 ]; then
+    echo "$replayprogram --threads Failed"
+    cleanupandexit 1
+fi
+
+echo "$replayprogram -q --sweep --sweep-first-block-sizes 0 1048576 --sweep-heuristics None Block:2 -i replay.replay"
+$replayprogram -i replay.replay -q --sweep --sweep-first-block-sizes 0 1048576 --sweep-heuristics None Block:2
+if [ $? -ne 0 ]; then
+    echo "$replayprogram --sweep Failed"
+    cleanupandexit 1
+fi
+
+#
+# threads.replay interleaves the reallocates of two threads, which must
+# compile to the same operations as threads_serial.replay
+#
+echo "$diffprogram -q --recompile $replay_tests_dir/threads.replay $replay_tests_dir/threads_serial.replay"
+$diffprogram -q --recompile $replay_tests_dir/threads.replay $replay_tests_dir/threads_serial.replay
+if [ $? -ne 0 ]; then
+    echo "Diff failed on interleaved thread reallocates"
+    cleanupandexit 1
+fi
+
+echo "$replayprogram -q --threads -i $replay_tests_dir/threads.replay"
+$replayprogram -i $replay_tests_dir/threads.replay -q --threads
+if [ $? -ne 0 ]; then
+    echo "$replayprogram --threads Failed on interleaved thread reallocates"
+    cleanupandexit 1
+fi
+
 cleanupandexit 0
@@ -0,0 +1,107 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include "gtest/gtest.h"
+#include "umpire/ResourceManager.hpp"
+#include "umpire/StaticAllocator.hpp"
+#include "umpire/Umpire.hpp"
+#include "umpire/alloc/MallocAllocator.hpp"
+#include "umpire/alloc/PosixMemalignAllocator.hpp"
+#include "umpire/config.hpp"
+#include "umpire/resource/DefaultMemoryResource.hpp"
+#include "umpire/strategy/DynamicPoolList.hpp"
+#include "umpire/strategy/QuickPool.hpp"
+#include "umpire/strategy/SizeLimiter.hpp"
+
+class StaticAllocatorTest : public ::testing::Test {
+ public:
+  void SetUp() override
+  {
+    static int unique_counter{0};
+    auto& rm = umpire::ResourceManager::getInstance();
+
+    m_pool = rm.makeAllocator<umpire::strategy::QuickPool>(
+        "static_allocator_pool_" + std::to_string(unique_counter++), rm.getAllocator("HOST"));
+  }
+
+  umpire::Allocator m_pool;
+};
+
+TEST_F(StaticAllocatorTest, AllocateDeallocate)
+{
+  umpire::StaticAllocator<umpire::strategy::QuickPool> allocator{m_pool};
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  ASSERT_EQ(allocator.getAllocationStrategy(), m_pool.getAllocationStrategy());
+  ASSERT_EQ(allocator.getAllocator().getId(), m_pool.getId());
+
+  void* ptr{nullptr};
+  ASSERT_NO_THROW({ ptr = allocator.allocate(100); });
+  ASSERT_NE(ptr, nullptr);
+
+  ASSERT_TRUE(rm.hasAllocator(ptr));
+  ASSERT_EQ(rm.getAllocator(ptr).getId(), m_pool.getId());
+  ASSERT_EQ(m_pool.getSize(ptr), 100);
+  ASSERT_EQ(m_pool.getStatistics().current_size, 100);
+  ASSERT_EQ(m_pool.getStatistics().allocation_count, 1);
+
+  ASSERT_NO_THROW(allocator.deallocate(ptr));
+  ASSERT_EQ(m_pool.getStatistics().current_size, 0);
+  ASSERT_EQ(m_pool.getStatistics().allocation_count, 0);
+  ASSERT_EQ(m_pool.getStatistics().high_watermark, 100);
+}
+
+TEST_F(StaticAllocatorTest, Interoperability)
+{
+  umpire::StaticAllocator<umpire::strategy::QuickPool> allocator{m_pool};
+
+  void* ptr{allocator.allocate(64)};
+  ASSERT_NO_THROW(m_pool.deallocate(ptr));
+
+  ptr = m_pool.allocate(64);
+  ASSERT_NO_THROW(allocator.deallocate(ptr));
+
+  ASSERT_EQ(m_pool.getAllocationCount(), 0);
+}
+
+TEST_F(StaticAllocatorTest, Nothing)
+{
+  umpire::StaticAllocator<umpire::strategy::QuickPool> allocator{m_pool};
+
+  void* ptr{nullptr};
+  ASSERT_NO_THROW({ ptr = allocator.allocate(0); });
+  ASSERT_NE(ptr, nullptr);
+  ASSERT_NO_THROW(allocator.deallocate(ptr));
+
+  ASSERT_NO_THROW(allocator.deallocate(nullptr));
+}
+
+TEST_F(StaticAllocatorTest, Resource)
+{
+  // The same allocator that HostResourceFactory uses for HOST
+#if defined(UMPIRE_ENABLE_NUMA)
+  using HostAllocator = umpire::alloc::PosixMemalignAllocator;
+#else
+  using HostAllocator = umpire::alloc::MallocAllocator;
+#endif
+
+  auto& rm = umpire::ResourceManager::getInstance();
+  umpire::StaticAllocator<umpire::resource::DefaultMemoryResource<HostAllocator>> allocator{rm.getAllocator("HOST")};
+
+  void* ptr{allocator.allocate(100)};
+  ASSERT_EQ(rm.getSize(ptr), 100);
+  ASSERT_NO_THROW(allocator.deallocate(ptr));
+}
+
+TEST_F(StaticAllocatorTest, WrongStrategy)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+  auto limiter = rm.makeAllocator<umpire::strategy::SizeLimiter>("static_allocator_limiter", m_pool, 1024);
+
+  ASSERT_THROW((umpire::StaticAllocator<umpire::strategy::DynamicPoolList>{m_pool}), umpire::runtime_error);
+  ASSERT_THROW((umpire::StaticAllocator<umpire::strategy::QuickPool>{limiter}), umpire::runtime_error);
+  ASSERT_NO_THROW((umpire::StaticAllocator<umpire::strategy::SizeLimiter>{limiter}));
+}
@@ -4,8 +4,10 @@
 //
 // SPDX-License-Identifier: (MIT)
 //////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "umpire/ResourceManager.hpp"
@@ -13,18 +15,27 @@
 #include "umpire/strategy/AlignedAllocator.hpp"
 #include "umpire/strategy/AllocationAdvisor.hpp"
 #include "umpire/strategy/AllocationStrategy.hpp"
+#include "umpire/strategy/ArenaPool.hpp"
+#include "umpire/strategy/DeferredFreePool.hpp"
 #include "umpire/strategy/DynamicPoolList.hpp"
 #include "umpire/strategy/FixedPool.hpp"
 #include "umpire/strategy/MixedPool.hpp"
 #include "umpire/strategy/MonotonicAllocationStrategy.hpp"
 #include "umpire/strategy/NamedAllocationStrategy.hpp"
 #include "umpire/strategy/QuickPool.hpp"
+#include "umpire/strategy/SegregatedFitPool.hpp"
 #include "umpire/strategy/SizeLimiter.hpp"
+#include "umpire/strategy/SlabPool.hpp"
 #include "umpire/strategy/SlotPool.hpp"
+#include "umpire/strategy/ThreadCachingPool.hpp"
 #include "umpire/strategy/ThreadSafeAllocator.hpp"
+#include "umpire/util/wrap_allocator.hpp"
 
 #if defined(UMPIRE_ENABLE_NUMA)
+#include "umpire/strategy/NumaFirstTouchPolicy.hpp"
+#include "umpire/strategy/NumaInterleavePolicy.hpp"
 #include "umpire/strategy/NumaPolicy.hpp"
+#include "umpire/strategy/NumaShardedPool.hpp"
 #include "umpire/util/numa.hpp"
 #endif
 
@@ -150,9 +161,11 @@ using Strategies =
 #if defined(UMPIRE_ENABLE_CUDA)
                      umpire::strategy::AllocationAdvisor,
 #endif
-                     umpire::strategy::DynamicPoolList, umpire::strategy::FixedPool, umpire::strategy::MixedPool,
+                     umpire::strategy::ArenaPool, umpire::strategy::DeferredFreePool, umpire::strategy::DynamicPoolList,
+                     umpire::strategy::FixedPool, umpire::strategy::MixedPool,
                      umpire::strategy::MonotonicAllocationStrategy, umpire::strategy::NamedAllocationStrategy,
-                     umpire::strategy::QuickPool, umpire::strategy::SizeLimiter, umpire::strategy::SlotPool,
+                     umpire::strategy::QuickPool, umpire::strategy::SegregatedFitPool, umpire::strategy::SizeLimiter,
+                     umpire::strategy::SlabPool, umpire::strategy::SlotPool, umpire::strategy::ThreadCachingPool,
                      umpire::strategy::ThreadSafeAllocator>;
 
 TYPED_TEST_SUITE(StrategyTest, Strategies, );
@@ -317,7 +330,8 @@ void ReleaseTest<umpire::strategy::FixedPool>::SetUp()
 }
 
 using ReleaseStrategies =
-    ::testing::Types<umpire::strategy::DynamicPoolList, umpire::strategy::FixedPool, umpire::strategy::QuickPool>;
+    ::testing::Types<umpire::strategy::DeferredFreePool, umpire::strategy::DynamicPoolList, umpire::strategy::FixedPool,
+                     umpire::strategy::QuickPool, umpire::strategy::SegregatedFitPool>;
 
 TYPED_TEST_SUITE(ReleaseTest, ReleaseStrategies, );
 
@@ -464,6 +478,54 @@ TEST(FixedPool, Host)
   allocator.deallocate(alloc);
 }
 
+TEST(FixedPool, HostBatch)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  const std::size_t data_size = 100 * sizeof(int);
+  const std::size_t objects_per_pool = 64;
+
+  auto allocator = rm.makeAllocator<umpire::strategy::FixedPool>("host_fixed_pool_batch", rm.getAllocator("HOST"),
+                                                                 data_size, objects_per_pool);
+  auto pool = umpire::util::unwrap_allocator<umpire::strategy::FixedPool>(allocator);
+
+  // Leave holes in the first sub-pool for the batch to fill
+  std::vector<void*> singles;
+  for (int i = 0; i < 10; ++i) {
+    singles.push_back(allocator.allocate(data_size));
+  }
+  for (int i = 0; i < 10; i += 2) {
+    allocator.deallocate(singles[i]);
+  }
+
+  const std::size_t count{2 * objects_per_pool + 20};
+  std::vector<void*> ptrs;
+  allocator.allocate_batch(std::vector<std::size_t>(count, data_size), ptrs);
+
+  ASSERT_EQ(ptrs.size(), count);
+  ASSERT_EQ(allocator.getCurrentSize(), (count + 5) * data_size);
+  ASSERT_EQ(pool->numPools(), 3);
+
+  std::vector<void*> all{ptrs};
+  for (int i = 1; i < 10; i += 2) {
+    all.push_back(singles[i]);
+  }
+  std::sort(all.begin(), all.end());
+  ASSERT_EQ(std::unique(all.begin(), all.end()), all.end());
+
+  for (auto ptr : ptrs) {
+    ASSERT_TRUE(pool->pointerIsFromPool(ptr));
+    ASSERT_EQ(allocator.getSize(ptr), data_size);
+    std::fill_n(static_cast<char*>(ptr), data_size, 0);
+  }
+
+  allocator.deallocate_batch(ptrs);
+  for (int i = 1; i < 10; i += 2) {
+    allocator.deallocate(singles[i]);
+  }
+  ASSERT_EQ(allocator.getCurrentSize(), 0);
+}
+
 TEST(MixedPool, Host)
 {
   auto& rm = umpire::ResourceManager::getInstance();
@@ -489,6 +551,37 @@ TEST(MixedPool, Host)
     allocator.deallocate(alloc[i]);
 }
 
+TEST(MixedPool, HostBatch)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto allocator = rm.makeAllocator<umpire::strategy::MixedPool>("host_mixed_pool_batch", rm.getAllocator("HOST"));
+
+  // Sizes for every fixed pool and the quick pool, interleaved
+  std::vector<std::size_t> sizes;
+  std::size_t total_size{0};
+  for (int repeat = 0; repeat < 4; ++repeat) {
+    for (std::size_t size = 4; size <= (std::size_t{1} << 20); size *= 4) {
+      sizes.push_back(size + repeat);
+      total_size += size + repeat;
+    }
+  }
+
+  std::vector<void*> ptrs;
+  allocator.allocate_batch(sizes, ptrs);
+
+  ASSERT_EQ(ptrs.size(), sizes.size());
+  ASSERT_EQ(allocator.getCurrentSize(), total_size);
+
+  for (std::size_t i = 0; i < ptrs.size(); ++i) {
+    ASSERT_EQ(allocator.getSize(ptrs[i]), sizes[i]);
+    std::fill_n(static_cast<char*>(ptrs[i]), sizes[i], 0);
+  }
+
+  allocator.deallocate_batch(ptrs);
+  ASSERT_EQ(allocator.getCurrentSize(), 0);
+}
+
 TEST(ThreadSafeAllocator, HostStdThread)
 {
   auto& rm = umpire::ResourceManager::getInstance();
@@ -520,11 +613,65 @@ TEST(ThreadSafeAllocator, HostStdThread)
     ASSERT_NE(alloc, nullptr);
   }
 
+  auto statistics = allocator.getStatistics();
+  ASSERT_EQ(statistics.current_size, N * 1024);
+  ASSERT_EQ(statistics.allocation_count, N);
+  ASSERT_GE(statistics.high_watermark, N * 1024);
+
   ASSERT_NO_THROW({
     for (auto alloc : thread_allocs) {
       allocator.deallocate(alloc);
     }
   });
+
+  ASSERT_EQ(allocator.getStatistics().current_size, 0);
+  ASSERT_EQ(allocator.getStatistics().allocation_count, 0);
+}
+
+TEST(ThreadSafeAllocator, HostBatch)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto allocator = rm.makeAllocator<umpire::strategy::ThreadSafeAllocator>(
+      "thread_safe_allocator_host_batch", rm.makeAllocator<umpire::strategy::QuickPool>(
+                                              "thread_safe_allocator_host_batch_pool", rm.getAllocator("HOST")));
+
+  constexpr int N = 16;
+  std::vector<std::thread> threads;
+
+  for (std::size_t i = 0; i < N; i++) {
+    threads.push_back(std::thread([=, &allocator] {
+      std::vector<std::size_t> sizes(N, 1024);
+      std::vector<void*> ptrs;
+
+      for (int j = 0; j < N; ++j) {
+        allocator.allocate_batch(sizes, ptrs);
+        ASSERT_EQ(ptrs.size(), N);
+        allocator.deallocate_batch(ptrs);
+      }
+    }));
+  }
+
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  auto statistics = allocator.getStatistics();
+  ASSERT_EQ(statistics.current_size, 0);
+  ASSERT_EQ(statistics.allocation_count, 0);
+  ASSERT_GE(statistics.high_watermark, N * 1024);
+
+  // Batches reach the pool as batches, and are counted by it
+  auto pool = rm.getAllocator("thread_safe_allocator_host_batch_pool");
+  std::vector<void*> ptrs;
+
+  allocator.allocate_batch(std::vector<std::size_t>(N, 1024), ptrs);
+  ASSERT_EQ(pool.getAllocationCount(), N);
+  ASSERT_EQ(pool.getCurrentSize(), N * 1024);
+
+  allocator.deallocate_batch(ptrs);
+  ASSERT_EQ(pool.getAllocationCount(), 0);
+  ASSERT_EQ(pool.getCurrentSize(), 0);
 }
 
 #if defined(_OPENMP)
@@ -548,6 +695,55 @@ TEST(ThreadSafeAllocator, HostOpenMP)
 }
 #endif
 
+TEST(ThreadCachingPool, HostStdThread)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto allocator = rm.makeAllocator<umpire::strategy::ThreadCachingPool>("thread_caching_pool_host_std",
+                                                                         rm.getAllocator("HOST"), 1024, 4);
+
+  constexpr int N = 16;
+  std::vector<std::vector<void*>> thread_allocs{N};
+  std::vector<std::thread> threads;
+
+  for (std::size_t i = 0; i < N; i++) {
+    threads.push_back(std::thread([=, &allocator, &thread_allocs] {
+      for (int j = 0; j < N; ++j) {
+        thread_allocs[i].push_back(allocator.allocate(8 * (j + 1)));
+        ASSERT_NE(thread_allocs[i].back(), nullptr);
+      }
+      for (int j = 0; j < N / 2; ++j) {
+        allocator.deallocate(thread_allocs[i].back());
+        thread_allocs[i].pop_back();
+      }
+      thread_allocs[i].push_back(allocator.allocate(4096));
+      ASSERT_NE(thread_allocs[i].back(), nullptr);
+    }));
+  }
+
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  // Blocks are handed back to the deallocating thread's cache, so freeing
+  // everything from the main thread must also work.
+  ASSERT_NO_THROW({
+    for (auto& allocs : thread_allocs) {
+      for (auto alloc : allocs) {
+        allocator.deallocate(alloc);
+      }
+    }
+  });
+
+  auto pool = umpire::util::unwrap_allocator<umpire::strategy::ThreadCachingPool>(allocator);
+  ASSERT_EQ(pool->getMaxCachedSize(), 1024);
+  ASSERT_EQ(pool->getCacheCapacity(), 4);
+
+  ASSERT_NO_THROW(pool->flush());
+  ASSERT_NO_THROW(allocator.release());
+  ASSERT_EQ(allocator.getActualSize(), 0);
+}
+
 #if defined(UMPIRE_ENABLE_DEVICE)
 TEST(ThreadSafeAllocator, DeviceStdThread)
 {
@@ -629,6 +825,320 @@ TEST(SizeLimiter, Host)
   EXPECT_NO_THROW(alloc.deallocate(data));
 }
 
+namespace {
+
+// An event that completes when the test says so, standing in for work that
+// is still running on an asynchronous resource
+struct ManualEvent {
+  bool check() const
+  {
+    return *done;
+  }
+
+  void wait() const
+  {
+    *done = true;
+  }
+
+  std::shared_ptr<bool> done{std::make_shared<bool>(false)};
+};
+
+} // namespace
+
+TEST(DeferredFreePool, Host)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto allocator = rm.makeAllocator<umpire::strategy::DeferredFreePool>("host_deferred_free_pool",
+                                                                        rm.getAllocator("HOST"), 4096, 1024);
+  auto pool = umpire::util::unwrap_allocator<umpire::strategy::DeferredFreePool>(allocator);
+
+  ManualEvent copy_done;
+  void* data = allocator.allocate(1024);
+  allocator.deallocate(data, camp::resources::Event{copy_done});
+
+  // The memory is freed as far as the Allocator is concerned...
+  ASSERT_FALSE(rm.hasAllocator(data));
+  ASSERT_EQ(allocator.getCurrentSize(), 0);
+  ASSERT_EQ(pool->getPendingCount(), 1);
+  ASSERT_EQ(pool->getPendingSize(), 1024);
+
+  // ...but it is not reused until the event completes
+  std::vector<void*> allocs;
+  for (int i = 0; i < 8; ++i) {
+    allocs.push_back(allocator.allocate(1024));
+    ASSERT_NE(allocs.back(), data);
+  }
+
+  *copy_done.done = true;
+  allocator.deallocate(allocator.allocate(16));
+  ASSERT_EQ(pool->getPendingCount(), 0);
+  ASSERT_EQ(pool->getPendingSize(), 0);
+
+  // Completed events free the memory straight away
+  auto resource = camp::resources::Resource{camp::resources::Host{}};
+  for (auto alloc : allocs) {
+    allocator.deallocate(alloc, resource);
+  }
+  ASSERT_EQ(pool->getPendingCount(), 0);
+  ASSERT_EQ(allocator.getCurrentSize(), 0);
+
+  // release waits for pending memory
+  ManualEvent kernel_done;
+  allocator.deallocate(allocator.allocate(64), camp::resources::Event{kernel_done});
+  ASSERT_EQ(pool->getPendingCount(), 1);
+  ASSERT_NO_THROW(allocator.release());
+  ASSERT_TRUE(*kernel_done.done);
+  ASSERT_EQ(pool->getPendingCount(), 0);
+  ASSERT_EQ(allocator.getActualSize(), 0);
+}
+
+TEST(DeferredFreePool, WaitsWhenOutOfMemory)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto limiter =
+      rm.makeAllocator<umpire::strategy::SizeLimiter>("deferred_free_pool_limiter", rm.getAllocator("HOST"), 6000);
+  auto allocator =
+      rm.makeAllocator<umpire::strategy::DeferredFreePool>("deferred_free_pool_limited", limiter, 4096, 4096);
+  auto pool = umpire::util::unwrap_allocator<umpire::strategy::DeferredFreePool>(allocator);
+
+  ManualEvent copy_done;
+  void* data = allocator.allocate(4096);
+  allocator.deallocate(data, camp::resources::Event{copy_done});
+  ASSERT_EQ(pool->getPendingCount(), 1);
+
+  // The pool cannot grow, so it waits for the pending memory and reuses it
+  void* reused{nullptr};
+  ASSERT_NO_THROW(reused = allocator.allocate(4096));
+  ASSERT_TRUE(*copy_done.done);
+  ASSERT_EQ(reused, data);
+  ASSERT_EQ(pool->getPendingCount(), 0);
+
+  // With nothing pending, the error reaches the caller
+  ASSERT_THROW(allocator.allocate(4096), umpire::out_of_memory_error);
+
+  allocator.deallocate(reused);
+}
+
+TEST(DeferredFreePool, ThreadSafe)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto deferred = rm.makeAllocator<umpire::strategy::DeferredFreePool>("deferred_free_pool_for_thread_safe",
+                                                                       rm.getAllocator("HOST"));
+  auto allocator = rm.makeAllocator<umpire::strategy::ThreadSafeAllocator>("thread_safe_deferred_free_pool", deferred);
+  auto pool = umpire::util::unwrap_allocator<umpire::strategy::DeferredFreePool>(deferred);
+
+  ManualEvent copy_done;
+  allocator.deallocate(allocator.allocate(64), camp::resources::Event{copy_done});
+  ASSERT_EQ(pool->getPendingCount(), 1);
+
+  *copy_done.done = true;
+  pool->reclaim();
+  ASSERT_EQ(pool->getPendingCount(), 0);
+  ASSERT_EQ(allocator.getCurrentSize(), 0);
+}
+
+TEST(QuickPool, DeallocateAfterEvent)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto allocator =
+      rm.makeAllocator<umpire::strategy::QuickPool>("quick_pool_deallocate_after", rm.getAllocator("HOST"));
+
+  // Strategies that do not defer deallocation wait for the event
+  ManualEvent copy_done;
+  allocator.deallocate(allocator.allocate(64), camp::resources::Event{copy_done});
+  ASSERT_TRUE(*copy_done.done);
+  ASSERT_EQ(allocator.getCurrentSize(), 0);
+}
+
+TEST(QuickPool, Decommit)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  const std::size_t block_size{64 * 1024 * 1024};
+  auto allocator =
+      rm.makeAllocator<umpire::strategy::QuickPool>("quick_pool_decommit", rm.getAllocator("HOST"), block_size);
+  auto pool = umpire::util::unwrap_allocator<umpire::strategy::QuickPool>(allocator);
+
+  using release_mode = umpire::strategy::QuickPool::release_mode;
+  ASSERT_EQ(pool->getReleaseMode(), release_mode::deallocate);
+  ASSERT_NO_THROW(pool->setReleaseMode(release_mode::decommit));
+
+  char* data = static_cast<char*>(allocator.allocate(block_size));
+  std::fill(data, data + block_size, 1);
+  const std::size_t resident_size{umpire::get_process_memory_usage()};
+
+  allocator.deallocate(data);
+  allocator.release();
+
+  // The block is kept, but its pages are given back
+  ASSERT_EQ(pool->getActualSize(), block_size);
+  ASSERT_EQ(pool->getTotalBlocks(), 1);
+  if (resident_size != 0) {
+    ASSERT_LT(umpire::get_process_memory_usage(), resident_size - block_size / 2);
+  }
+
+  // The pool reuses the block without growing
+  char* reused = static_cast<char*>(allocator.allocate(block_size));
+  ASSERT_EQ(reused, data);
+  ASSERT_EQ(pool->getActualSize(), block_size);
+  std::fill(reused, reused + block_size, 2);
+  allocator.deallocate(reused);
+}
+
+TEST(QuickPool, DecommitOncePerFreeChunk)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  const std::size_t block_size{1024 * 1024};
+  auto allocator = rm.makeAllocator<umpire::strategy::QuickPool>("quick_pool_decommit_once", rm.getAllocator("HOST"),
+                                                                 block_size, block_size, 16,
+                                                                 umpire::strategy::QuickPool::percent_releasable(100));
+  auto pool = umpire::util::unwrap_allocator<umpire::strategy::QuickPool>(allocator);
+  pool->setReleaseMode(umpire::strategy::QuickPool::release_mode::decommit);
+
+  // Deallocations that meet the heuristic keep the pages of the block, so
+  // what was written is still there when the block is reused
+  char* data = static_cast<char*>(allocator.allocate(block_size));
+  for (char value = 1; value < 8; ++value) {
+    std::fill(data, data + block_size, value);
+    allocator.deallocate(data);
+    ASSERT_EQ(pool->getDecommittedSize(), 0);
+
+    data = static_cast<char*>(allocator.allocate(block_size));
+    ASSERT_EQ(data[0], value);
+    ASSERT_EQ(data[block_size - 1], value);
+  }
+
+  // Release decommits the free chunk, which stays decommitted until it is
+  // used again
+  allocator.deallocate(data);
+  allocator.release();
+  ASSERT_EQ(pool->getDecommittedSize(), block_size);
+  allocator.release();
+  ASSERT_EQ(pool->getDecommittedSize(), block_size);
+
+  // Only the pages that lie entirely within the block are given back
+  data = static_cast<char*>(allocator.allocate(block_size));
+  ASSERT_EQ(data[block_size / 2], 0);
+  ASSERT_EQ(pool->getDecommittedSize(), 0);
+
+  std::fill(data, data + block_size, 1);
+  allocator.deallocate(data);
+  ASSERT_EQ(pool->getDecommittedSize(), 0);
+
+  pool->coalesce();
+  ASSERT_EQ(pool->getDecommittedSize(), block_size);
+  ASSERT_EQ(pool->getActualSize(), block_size);
+}
+
+TEST(ArenaPool, Host)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  const std::size_t commit_size{1024 * 1024};
+  const std::size_t reserved_size{8 * commit_size};
+  auto allocator = rm.makeAllocator<umpire::strategy::ArenaPool>("host_arena_pool", rm.getAllocator("HOST"),
+                                                                 reserved_size, commit_size);
+  auto pool = umpire::util::unwrap_allocator<umpire::strategy::ArenaPool>(allocator);
+
+  ASSERT_EQ(pool->getReservedSize(), reserved_size);
+  ASSERT_EQ(allocator.getActualSize(), 0);
+
+  // The arena grows in place, so allocations are contiguous
+  char* first = static_cast<char*>(allocator.allocate(commit_size));
+  char* second = static_cast<char*>(allocator.allocate(commit_size));
+  ASSERT_EQ(second, first + commit_size);
+  ASSERT_EQ(allocator.getActualSize(), 2 * commit_size);
+  std::fill(first, first + 2 * commit_size, 1);
+
+  ASSERT_TRUE(pool->owns(first));
+  ASSERT_TRUE(pool->owns(first + reserved_size - 1));
+  ASSERT_FALSE(pool->owns(first + reserved_size));
+
+  void* host_data = rm.getAllocator("HOST").allocate(64);
+  ASSERT_FALSE(pool->owns(host_data));
+  rm.getAllocator("HOST").deallocate(host_data);
+
+  // Freed ranges below the top of the arena are reused
+  allocator.deallocate(first);
+  char* small = static_cast<char*>(allocator.allocate(100));
+  ASSERT_EQ(small, first);
+  char* next = static_cast<char*>(allocator.allocate(100));
+  ASSERT_EQ(next, first + 112);
+
+  EXPECT_THROW(allocator.allocate(reserved_size), umpire::out_of_memory_error);
+
+  // Freeing everything lowers the top of the arena so release can decommit
+  allocator.deallocate(small);
+  allocator.deallocate(next);
+  allocator.deallocate(second);
+  ASSERT_EQ(allocator.getCurrentSize(), 0);
+  ASSERT_EQ(pool->getReleasableSize(), 2 * commit_size);
+
+  allocator.release();
+  ASSERT_EQ(allocator.getActualSize(), 0);
+
+  char* reused = static_cast<char*>(allocator.allocate(commit_size));
+  ASSERT_EQ(reused, first);
+  std::fill(reused, reused + commit_size, 2);
+  allocator.deallocate(reused);
+}
+
+TEST(SlabPool, Host)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  ASSERT_EQ(umpire::strategy::SlabPool::sizeClass(1), 0);
+  ASSERT_EQ(umpire::strategy::SlabPool::sizeClass(16), 0);
+  ASSERT_EQ(umpire::strategy::SlabPool::sizeClass(17), 1);
+  ASSERT_EQ(umpire::strategy::SlabPool::classSize(umpire::strategy::SlabPool::sizeClass(128)), 128);
+  ASSERT_EQ(umpire::strategy::SlabPool::classSize(umpire::strategy::SlabPool::sizeClass(129)), 160);
+  ASSERT_EQ(umpire::strategy::SlabPool::classSize(umpire::strategy::SlabPool::sizeClass(4096)), 4096);
+  ASSERT_EQ(umpire::strategy::SlabPool::sizeClass(4097), umpire::strategy::SlabPool::s_num_size_classes);
+
+  for (std::size_t bytes = 1; bytes <= 4096; ++bytes) {
+    const std::size_t size_class{umpire::strategy::SlabPool::sizeClass(bytes)};
+    ASSERT_GE(umpire::strategy::SlabPool::classSize(size_class), bytes);
+    if (size_class > 0) {
+      ASSERT_LT(umpire::strategy::SlabPool::classSize(size_class - 1), bytes);
+    }
+  }
+
+  EXPECT_THROW(rm.makeAllocator<umpire::strategy::SlabPool>("host_slab_pool_bad", rm.getAllocator("HOST"), 10000),
+               umpire::runtime_error);
+
+  auto allocator = rm.makeAllocator<umpire::strategy::SlabPool>("host_slab_pool", rm.getAllocator("HOST"));
+
+  std::vector<void*> allocs;
+  for (int i = 0; i < 3; ++i) {
+    for (std::size_t bytes = 16; bytes <= 8192; bytes *= 2) {
+      char* data = static_cast<char*>(allocator.allocate(bytes));
+      ASSERT_NE(data, nullptr);
+      ASSERT_EQ(reinterpret_cast<std::uintptr_t>(data) % 16, 0);
+      std::fill(data, data + bytes, static_cast<char>(i));
+      allocs.push_back(data);
+    }
+  }
+
+  ASSERT_GT(allocator.getActualSize(), 0);
+
+  void* reused = allocs.front();
+  allocator.deallocate(reused);
+  ASSERT_EQ(allocator.allocate(16), reused);
+
+  for (auto alloc : allocs) {
+    allocator.deallocate(alloc);
+  }
+
+  ASSERT_EQ(allocator.getCurrentSize(), 0);
+  ASSERT_NO_THROW(allocator.release());
+  ASSERT_EQ(allocator.getActualSize(), 0);
+}
+
 #if defined(UMPIRE_ENABLE_NUMA)
 TEST(NumaPolicyTest, EdgeCases)
 {
@@ -666,6 +1176,141 @@ TEST(NumaPolicyTest, Location)
   }
 }
 
+TEST(NumaInterleavePolicyTest, Location)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  EXPECT_THROW(rm.makeAllocator<umpire::strategy::NumaInterleavePolicy>("numa_interleave_bad", rm.getAllocator("HOST"),
+                                                                        std::vector<int>{-1}),
+               umpire::runtime_error);
+
+  auto alloc = rm.makeAllocator<umpire::strategy::NumaInterleavePolicy>("numa_interleave", rm.getAllocator("HOST"));
+  auto policy = umpire::util::unwrap_allocator<umpire::strategy::NumaInterleavePolicy>(alloc);
+  auto nodes = umpire::numa::get_host_nodes();
+  ASSERT_EQ(policy->getNodes(), nodes);
+
+  const std::size_t num_pages{16};
+  char* ptr = static_cast<char*>(alloc.allocate(num_pages * umpire::get_page_size()));
+  rm.memset(ptr, 0);
+
+  std::vector<int> used;
+  for (std::size_t i = 0; i < num_pages; ++i) {
+    const int node{umpire::numa::get_location(ptr + i * umpire::get_page_size())};
+    ASSERT_NE(std::find(nodes.begin(), nodes.end(), node), nodes.end());
+    used.push_back(node);
+  }
+
+  // Pages are spread over every node
+  for (auto n : nodes) {
+    ASSERT_NE(std::find(used.begin(), used.end(), n), used.end());
+  }
+
+  alloc.deallocate(ptr);
+}
+
+TEST(NumaFirstTouchPolicyTest, Location)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  EXPECT_THROW(rm.makeAllocator<umpire::strategy::NumaFirstTouchPolicy>("numa_first_touch_bad", rm.getAllocator("HOST"),
+                                                                        std::vector<int>{-1}),
+               umpire::runtime_error);
+
+  // Two parts per node, as two threads bound to each socket would use
+  std::vector<int> partitions;
+  for (auto n : umpire::numa::get_host_nodes()) {
+    partitions.push_back(n);
+    partitions.push_back(n);
+  }
+
+  // Pages of the arena are untouched until the policy touches them, unlike
+  // heap pages that "HOST" may reuse
+  auto arena = rm.makeAllocator<umpire::strategy::ArenaPool>("numa_first_touch_arena", rm.getAllocator("HOST"));
+  auto alloc = rm.makeAllocator<umpire::strategy::NumaFirstTouchPolicy>("numa_first_touch", arena, partitions);
+
+  const std::size_t pages_per_part{4};
+  const std::size_t part_size{pages_per_part * umpire::get_page_size()};
+  char* ptr = static_cast<char*>(alloc.allocate(partitions.size() * part_size));
+
+  // The pages are placed before they are written to
+  rm.memset(ptr, 0);
+
+  for (std::size_t i = 0; i < partitions.size(); ++i) {
+    for (std::size_t page = 0; page < pages_per_part; ++page) {
+      ASSERT_EQ(umpire::numa::get_location(ptr + i * part_size + page * umpire::get_page_size()), partitions[i]);
+    }
+  }
+
+  alloc.deallocate(ptr);
+}
+
+TEST(NumaShardedPoolTest, Location)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto nodes = umpire::numa::get_host_nodes();
+
+  std::vector<umpire::Allocator> node_allocators;
+  for (auto n : nodes) {
+    node_allocators.push_back(rm.makeAllocator<umpire::strategy::NumaPolicy>(
+        "numa_sharded_policy_" + std::to_string(n), rm.getAllocator("HOST"), n));
+  }
+
+  const std::size_t block_size{16 * static_cast<std::size_t>(umpire::get_page_size())};
+  auto alloc =
+      rm.makeAllocator<umpire::strategy::NumaShardedPool>("numa_sharded_pool", node_allocators, block_size, block_size);
+  auto pool = umpire::util::unwrap_allocator<umpire::strategy::NumaShardedPool>(alloc);
+
+  ASSERT_EQ(pool->getNodes(), nodes);
+
+  // Each node has several threads allocating from its pool at the same time
+  const int threads_per_node{4};
+  const int iterations{1000};
+
+  std::vector<char*> ptrs(nodes.size() * threads_per_node);
+  std::vector<int> locations(ptrs.size(), -1);
+  std::vector<std::thread> threads;
+
+  for (std::size_t i = 0; i < ptrs.size(); ++i) {
+    const int node{nodes[i / threads_per_node]};
+    threads.emplace_back([&, i, node] {
+      umpire::numa::run_on_node(node);
+
+      for (int j = 0; j < iterations; ++j) {
+        alloc.deallocate(alloc.allocate(j % 64 + 1));
+      }
+
+      ptrs[i] = static_cast<char*>(alloc.allocate(umpire::get_page_size()));
+      rm.memset(ptrs[i], 0);
+      locations[i] = umpire::numa::get_location(ptrs[i]);
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (std::size_t i = 0; i < ptrs.size(); ++i) {
+    ASSERT_EQ(locations[i], nodes[i / threads_per_node]);
+  }
+
+  for (auto n : nodes) {
+    ASSERT_EQ(pool->getActualSize(n), block_size);
+  }
+
+  ASSERT_EQ(alloc.getCurrentSize(), ptrs.size() * umpire::get_page_size());
+  ASSERT_EQ(alloc.getActualSize(), nodes.size() * block_size);
+
+  // Memory is returned to the pool of its node by any thread
+  for (auto ptr : ptrs) {
+    alloc.deallocate(ptr);
+  }
+
+  ASSERT_EQ(alloc.getCurrentSize(), 0);
+  alloc.release();
+  ASSERT_EQ(alloc.getActualSize(), 0);
+}
+
 #endif // defined(UMPIRE_ENABLE_NUMA)
 
 static inline void test_alignment(uintptr_t p, unsigned int align)
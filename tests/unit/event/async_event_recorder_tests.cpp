@@ -0,0 +1,210 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "umpire/event/async_event_recorder.hpp"
+#include "umpire/event/event.hpp"
+
+namespace {
+
+// Store that keeps the pointer of every event, in the order they are written
+class vector_store : public umpire::event::event_store {
+ public:
+  explicit vector_store(std::chrono::microseconds delay = std::chrono::microseconds{0}) : m_delay{delay}
+  {
+  }
+
+  void insert(const umpire::event::event& e) override
+  {
+    names.push_back(e.name);
+    pointers.push_back(nullptr);
+  }
+
+  void insert(const umpire::event::allocate& e) override
+  {
+    std::this_thread::sleep_for(m_delay);
+    names.push_back("allocate");
+    pointers.push_back(e.ptr);
+  }
+
+  void insert(const umpire::event::named_allocate& e) override
+  {
+    names.push_back(e.name);
+    pointers.push_back(e.ptr);
+  }
+
+  void insert(const umpire::event::deallocate& e) override
+  {
+    names.push_back("deallocate");
+    pointers.push_back(e.ptr);
+  }
+
+  std::vector<umpire::event::event> get_events() override
+  {
+    return {};
+  }
+
+  std::vector<std::string> names;
+  std::vector<void*> pointers;
+
+ private:
+  std::chrono::microseconds m_delay;
+};
+
+void* as_pointer(std::uintptr_t i)
+{
+  return reinterpret_cast<void*>(i);
+}
+
+} // namespace
+
+TEST(AsyncEventRecorder, PreservesOrder)
+{
+  vector_store store;
+  umpire::event::async_event_recorder recorder{&store, umpire::event::async_event_recorder::overflow_policy::block, 16};
+
+  umpire::event::event e;
+  e.name = "make_allocator";
+  recorder.record(e);
+
+  for (std::uintptr_t i = 1; i <= 1000; ++i) {
+    recorder.record(umpire::event::allocate{8, nullptr, as_pointer(i)});
+    if (i % 3 == 0) {
+      recorder.record(umpire::event::named_allocate{8, nullptr, as_pointer(i), "named"});
+    }
+    recorder.record(umpire::event::deallocate{nullptr, as_pointer(i)});
+  }
+
+  recorder.flush();
+
+  ASSERT_EQ(store.names.size(), 1 + 2000 + 333);
+  EXPECT_EQ(store.names[0], "make_allocator");
+
+  std::size_t index{1};
+  for (std::uintptr_t i = 1; i <= 1000; ++i) {
+    EXPECT_EQ(store.names[index], "allocate");
+    EXPECT_EQ(store.pointers[index++], as_pointer(i));
+    if (i % 3 == 0) {
+      EXPECT_EQ(store.names[index], "named");
+      EXPECT_EQ(store.pointers[index++], as_pointer(i));
+    }
+    EXPECT_EQ(store.names[index], "deallocate");
+    EXPECT_EQ(store.pointers[index++], as_pointer(i));
+  }
+
+  EXPECT_EQ(recorder.get_dropped_count(), 0);
+}
+
+TEST(AsyncEventRecorder, OrdersAcrossThreads)
+{
+  vector_store store;
+  umpire::event::async_event_recorder recorder{&store, umpire::event::async_event_recorder::overflow_policy::block, 64};
+
+  constexpr std::uintptr_t num_threads{4};
+  constexpr std::uintptr_t num_pointers{2000};
+
+  // Each pointer is allocated by one thread and deallocated by the next, so
+  // the deallocation must never be written before the allocation
+  std::vector<std::thread> threads;
+
+  for (std::uintptr_t t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&, t] {
+      for (std::uintptr_t i = 0; i < num_pointers; ++i) {
+        recorder.record(umpire::event::allocate{8, nullptr, as_pointer(t * num_pointers + i + 1)});
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  threads.clear();
+
+  for (std::uintptr_t t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&, t] {
+      const std::uintptr_t owner{(t + 1) % num_threads};
+      for (std::uintptr_t i = 0; i < num_pointers; ++i) {
+        recorder.record(umpire::event::deallocate{nullptr, as_pointer(owner * num_pointers + i + 1)});
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  recorder.flush();
+
+  ASSERT_EQ(store.names.size(), 2 * num_threads * num_pointers);
+
+  std::map<void*, std::size_t> allocated_at;
+  for (std::size_t i = 0; i < store.names.size(); ++i) {
+    if (store.names[i] == "allocate") {
+      allocated_at[store.pointers[i]] = i;
+    } else {
+      ASSERT_EQ(allocated_at.count(store.pointers[i]), 1);
+    }
+  }
+}
+
+TEST(AsyncEventRecorder, DropPolicy)
+{
+  // A slow store makes the two slot ring overflow
+  vector_store store{std::chrono::microseconds{100}};
+  umpire::event::async_event_recorder recorder{&store, umpire::event::async_event_recorder::overflow_policy::drop, 2,
+                                               std::chrono::milliseconds{1000}};
+
+  EXPECT_EQ(recorder.get_overflow_policy(), umpire::event::async_event_recorder::overflow_policy::drop);
+
+  constexpr std::size_t num_events{100};
+  for (std::uintptr_t i = 1; i <= num_events; ++i) {
+    recorder.record(umpire::event::allocate{8, nullptr, as_pointer(i)});
+  }
+
+  recorder.flush();
+
+  EXPECT_GT(recorder.get_dropped_count(), 0);
+  EXPECT_EQ(store.names.size() + recorder.get_dropped_count(), num_events);
+
+  // Events that were kept are still in order
+  for (std::size_t i = 1; i < store.pointers.size(); ++i) {
+    EXPECT_LT(store.pointers[i - 1], store.pointers[i]);
+  }
+
+  recorder.set_overflow_policy(umpire::event::async_event_recorder::overflow_policy::block);
+  const std::size_t dropped{recorder.get_dropped_count()};
+
+  for (std::uintptr_t i = 1; i <= num_events; ++i) {
+    recorder.record(umpire::event::allocate{8, nullptr, as_pointer(i)});
+  }
+
+  recorder.flush();
+
+  EXPECT_EQ(recorder.get_dropped_count(), dropped);
+  EXPECT_EQ(store.names.size() + dropped, 2 * num_events);
+}
+
+TEST(AsyncEventRecorder, Shutdown)
+{
+  vector_store store;
+  umpire::event::async_event_recorder recorder{&store};
+
+  recorder.record(umpire::event::allocate{8, nullptr, as_pointer(1)});
+  recorder.shutdown();
+
+  ASSERT_EQ(store.names.size(), 1);
+
+  // Once shut down, events are written immediately
+  recorder.record(umpire::event::deallocate{nullptr, as_pointer(1)});
+
+  ASSERT_EQ(store.names.size(), 2);
+  EXPECT_EQ(store.names[1], "deallocate");
+}
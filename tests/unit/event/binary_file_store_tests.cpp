@@ -0,0 +1,163 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "umpire/event/binary_file_store.hpp"
+#include "umpire/event/event.hpp"
+#include "umpire/event/json_file_store.hpp"
+#include "umpire/util/error.hpp"
+
+namespace {
+
+void* as_pointer(std::uintptr_t i)
+{
+  return reinterpret_cast<void*>(i);
+}
+
+std::chrono::time_point<std::chrono::system_clock> at(std::int64_t ns)
+{
+  return std::chrono::time_point<std::chrono::system_clock>{
+      std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds{ns})};
+}
+
+// Write the same events, covering every record type, to store. Events are
+// spread over three threads. Addresses look like heap addresses so the JSON
+// is its usual length.
+void write_events(umpire::event::event_store& store)
+{
+  constexpr std::uintptr_t base{0x7f0000000000};
+
+  umpire::event::event version;
+  version.name = "version";
+  version.cat = umpire::event::category::metadata;
+  version.numeric_args["major"] = 2024;
+  version.tags["replay"] = "true";
+  version.timestamp = at(1000);
+  store.insert(version);
+
+  for (std::uintptr_t i = 1; i <= 100; ++i) {
+    void* ref{as_pointer(i % 2 == 0 ? 0x1000 : 0x2000)};
+    const std::uint64_t thread{i / 50};
+    store.insert(umpire::event::allocate{i * 8, ref, as_pointer(base + i * 64), at(2000 + i), thread});
+    if (i % 10 == 0) {
+      store.insert(umpire::event::named_allocate{i, ref, as_pointer(base + i * 64 + 1), i % 20 == 0 ? "even" : "odd",
+                                                 at(3000 + i), thread});
+    }
+    // Some pointers are freed by another thread
+    const std::uint64_t free_thread{i % 25 == 0 ? (thread + 1) % 3 : thread};
+    store.insert(umpire::event::deallocate{ref, as_pointer(base + i * 64), at(4000 + i), free_thread});
+  }
+}
+
+long file_size(const std::string& filename)
+{
+  FILE* f{fopen(filename.c_str(), "rb")};
+  fseek(f, 0, SEEK_END);
+  const long size{ftell(f)};
+  fclose(f);
+  return size;
+}
+
+} // namespace
+
+TEST(BinaryFileStore, MatchesJsonFileStore)
+{
+  const std::string binary_file{"binary_file_store_tests.stats.bin"};
+  const std::string json_file{"binary_file_store_tests.stats"};
+
+  {
+    umpire::event::binary_file_store binary{binary_file};
+    umpire::event::json_file_store json{json_file};
+    write_events(binary);
+    write_events(json);
+  }
+
+  EXPECT_TRUE(umpire::event::binary_file_store::is_binary_file(binary_file));
+  EXPECT_FALSE(umpire::event::binary_file_store::is_binary_file(json_file));
+  EXPECT_LT(5 * file_size(binary_file), file_size(json_file));
+
+  umpire::event::binary_file_store binary{binary_file, true};
+  umpire::event::json_file_store json{json_file, true};
+
+  auto binary_events = binary.get_events();
+  auto json_events = json.get_events();
+
+  ASSERT_EQ(binary_events.size(), 1 + 200 + 10);
+  ASSERT_EQ(binary_events.size(), json_events.size());
+
+  for (std::size_t i = 0; i < json_events.size(); ++i) {
+    EXPECT_EQ(binary_events[i].name, json_events[i].name);
+    EXPECT_EQ(binary_events[i].cat, json_events[i].cat);
+    EXPECT_EQ(binary_events[i].string_args, json_events[i].string_args);
+    EXPECT_EQ(binary_events[i].numeric_args, json_events[i].numeric_args);
+    EXPECT_EQ(binary_events[i].tags, json_events[i].tags);
+    EXPECT_EQ(binary_events[i].timestamp, json_events[i].timestamp);
+  }
+
+  std::remove(binary_file.c_str());
+  std::remove(json_file.c_str());
+}
+
+TEST(BinaryFileStore, ConvertsToJson)
+{
+  const std::string binary_file{"binary_file_store_convert.stats.bin"};
+  const std::string json_file{"binary_file_store_convert.stats"};
+  const std::string converted_file{"binary_file_store_converted.stats"};
+
+  {
+    umpire::event::binary_file_store binary{binary_file};
+    umpire::event::json_file_store json{json_file};
+    write_events(binary);
+    write_events(json);
+  }
+
+  {
+    umpire::event::binary_file_store binary{binary_file, true};
+    umpire::event::json_file_store converted{converted_file};
+    binary.copy_to(converted);
+  }
+
+  // Conversion produces the same file as recording to JSON
+  std::FILE* expected{fopen(json_file.c_str(), "rb")};
+  std::FILE* actual{fopen(converted_file.c_str(), "rb")};
+  ASSERT_NE(expected, nullptr);
+  ASSERT_NE(actual, nullptr);
+
+  int e, a;
+  do {
+    e = fgetc(expected);
+    a = fgetc(actual);
+    ASSERT_EQ(e, a);
+  } while (e != EOF);
+
+  fclose(expected);
+  fclose(actual);
+
+  std::remove(binary_file.c_str());
+  std::remove(json_file.c_str());
+  std::remove(converted_file.c_str());
+}
+
+TEST(BinaryFileStore, RejectsJsonFile)
+{
+  const std::string json_file{"binary_file_store_reject.stats"};
+
+  {
+    umpire::event::json_file_store json{json_file};
+    json.insert(umpire::event::allocate{8, nullptr, as_pointer(64)});
+  }
+
+  umpire::event::binary_file_store binary{json_file, true};
+  EXPECT_THROW(binary.get_events(), umpire::runtime_error);
+
+  std::remove(json_file.c_str());
+}
@@ -0,0 +1,115 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include "gtest/gtest.h"
+#include "resource_tests.hpp"
+#include "umpire/ResourceManager.hpp"
+#include "umpire/resource/HugePageMemoryResource.hpp"
+#include "umpire/strategy/QuickPool.hpp"
+#include "umpire/util/error.hpp"
+
+TYPED_TEST_P(ResourceTest, AllocateDeallocate)
+{
+  const auto page_size = sysconf(_SC_PAGE_SIZE);
+
+  auto pointer_1 = this->memory_resource->allocate(page_size + 5000);
+  ASSERT_NE(pointer_1, nullptr);
+
+  auto pointer_2 = this->memory_resource->allocate(page_size - 1010);
+  ASSERT_NE(pointer_2, nullptr);
+
+  std::memset(pointer_1, 0xff, page_size + 5000);
+  std::memset(pointer_2, 0xff, page_size - 1010);
+
+  this->memory_resource->deallocate(pointer_1, page_size + 5000);
+  this->memory_resource->deallocate(pointer_2, page_size - 1010);
+}
+
+TYPED_TEST_P(ResourceTest, DeallocateUnknown)
+{
+  int local{0};
+  ASSERT_THROW(this->memory_resource->deallocate(&local, sizeof(local)), umpire::runtime_error);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ResourceTest, Constructor, Allocate, getCurrentSize, getHighWatermark, getPlatform,
+                            getTraits, AllocateDeallocate, DeallocateUnknown);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(HugePage, ResourceTest, umpire::resource::HugePageMemoryResource, );
+
+namespace {
+umpire::MemoryResourceTraits page_traits(umpire::MemoryResourceTraits::page_type pages, std::size_t page_size = 0)
+{
+  umpire::MemoryResourceTraits traits;
+  traits.pages = pages;
+  traits.page_size = page_size;
+  return traits;
+}
+} // namespace
+
+TEST(HugePageMemoryResource, TransparentHugePagesAreAligned)
+{
+  umpire::resource::HugePageMemoryResource resource{
+      umpire::Platform::host, "thp", 0, page_traits(umpire::MemoryResourceTraits::page_type::transparent_huge)};
+
+  const std::size_t page_size{resource.getPageSize()};
+  ASSERT_GT(page_size, static_cast<std::size_t>(sysconf(_SC_PAGE_SIZE)));
+
+  for (std::size_t bytes : {std::size_t{1}, page_size, 3 * page_size + 1}) {
+    void* ptr{resource.allocate(bytes)};
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % page_size, 0u);
+    std::memset(ptr, 0, bytes);
+    resource.deallocate(ptr, bytes);
+  }
+}
+
+TEST(HugePageMemoryResource, HugeFallsBack)
+{
+  // Succeeds whether or not the system has huge pages reserved
+  umpire::resource::HugePageMemoryResource resource{
+      umpire::Platform::host, "huge", 0, page_traits(umpire::MemoryResourceTraits::page_type::huge)};
+
+  const std::size_t bytes{2 * resource.getPageSize()};
+  void* ptr{nullptr};
+  ASSERT_NO_THROW(ptr = resource.allocate(bytes));
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % resource.getPageSize(), 0u);
+  std::memset(ptr, 0, bytes);
+  resource.deallocate(ptr, bytes);
+}
+
+TEST(HugePageMemoryResource, InvalidPageSize)
+{
+  ASSERT_THROW((umpire::resource::HugePageMemoryResource{
+                   umpire::Platform::host, "invalid", 0,
+                   page_traits(umpire::MemoryResourceTraits::page_type::transparent_huge, 3 * 1024 * 1024)}),
+               umpire::runtime_error);
+
+  // A power of 2 smaller than a system page
+  ASSERT_THROW((umpire::resource::HugePageMemoryResource{
+                   umpire::Platform::host, "invalid", 0,
+                   page_traits(umpire::MemoryResourceTraits::page_type::transparent_huge, 512)}),
+               umpire::runtime_error);
+}
+
+TEST(HugePageMemoryResource, BacksPool)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+
+  auto resource = rm.getAllocator("HUGEPAGE");
+  ASSERT_EQ(resource.getAllocationStrategy()->getTraits().pages,
+            umpire::MemoryResourceTraits::page_type::transparent_huge);
+
+  auto pool = rm.makeAllocator<umpire::strategy::QuickPool>("hugepage_pool", resource, 4 * 1024 * 1024);
+
+  void* ptr{pool.allocate(1024)};
+  ASSERT_TRUE(pool.getActualSize() >= 4 * 1024 * 1024);
+  std::memset(ptr, 0, 1024);
+  pool.deallocate(ptr);
+}
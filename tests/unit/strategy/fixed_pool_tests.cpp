@@ -5,6 +5,9 @@
 // SPDX-License-Identifier: (MIT)
 //////////////////////////////////////////////////////////////////////////////
 
+#include <set>
+#include <vector>
+
 #include "gtest/gtest.h"
 #include "umpire/ResourceManager.hpp"
 #include "umpire/config.hpp"
@@ -83,3 +86,99 @@ TEST(FixedPoolTest, Allocate_2_pools)
   EXPECT_EQ(pool.getCurrentSize(), 0);
   EXPECT_EQ(pool.getHighWatermark(), 3 * sizeof(int));
 }
+
+TEST(FixedPoolTest, Allocate_many_pools)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+  auto alloc = rm.getAllocator("HOST");
+
+  // Not a multiple of 64, so the last bitmap word of each pool is partial
+  const std::size_t objects_per_pool{100};
+  const std::size_t num_pools{50};
+
+  umpire::strategy::FixedPool pool{"FixedPool", 0, alloc, sizeof(double), objects_per_pool};
+
+  std::vector<void*> ptrs;
+  for (std::size_t i = 0; i < objects_per_pool * num_pools; ++i) {
+    ptrs.push_back(pool.allocate());
+  }
+
+  EXPECT_EQ(pool.numPools(), num_pools);
+
+  std::set<void*> unique_ptrs{ptrs.begin(), ptrs.end()};
+  EXPECT_EQ(unique_ptrs.size(), ptrs.size());
+
+  // Freed objects in a full middle pool are reused before a new pool is made
+  std::set<void*> freed;
+  for (std::size_t i = 0; i < 10; ++i) {
+    void* ptr{ptrs[objects_per_pool * (num_pools / 2) + 7 * i]};
+    pool.deallocate(ptr, sizeof(double));
+    freed.insert(ptr);
+  }
+
+  for (std::size_t i = 0; i < 10; ++i) {
+    EXPECT_EQ(freed.count(pool.allocate()), 1);
+  }
+
+  EXPECT_EQ(pool.numPools(), num_pools);
+
+  for (auto ptr : ptrs) {
+    EXPECT_TRUE(pool.pointerIsFromPool(ptr));
+    pool.deallocate(ptr, sizeof(double));
+  }
+
+  EXPECT_EQ(pool.getCurrentSize(), 0);
+
+  pool.release();
+  EXPECT_EQ(pool.numPools(), 0);
+
+  void* ptr{pool.allocate()};
+  EXPECT_EQ(pool.numPools(), 1);
+  pool.deallocate(ptr, sizeof(double));
+}
+
+TEST(FixedPoolTest, Pointer_lookup)
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+  auto alloc = rm.getAllocator("HOST");
+
+  const std::size_t objects_per_pool{64};
+
+  umpire::strategy::FixedPool pool{"FixedPool", 0, alloc, 4 * sizeof(double), objects_per_pool};
+
+  std::vector<void*> ptrs;
+  for (std::size_t i = 0; i < objects_per_pool * 20; ++i) {
+    ptrs.push_back(pool.allocate());
+  }
+
+  ASSERT_EQ(pool.numPools(), 20);
+
+  for (auto ptr : ptrs) {
+    EXPECT_TRUE(pool.pointerIsFromPool(ptr));
+    EXPECT_TRUE(pool.pointerIsFromPool(static_cast<char*>(ptr) + sizeof(double)));
+  }
+
+  double not_from_pool{0.0};
+  EXPECT_FALSE(pool.pointerIsFromPool(&not_from_pool));
+  EXPECT_FALSE(pool.pointerIsFromPool(nullptr));
+  EXPECT_THROW(pool.deallocate(&not_from_pool, sizeof(double)), umpire::runtime_error);
+
+  // Free every other sub-pool so release() has to rebuild the index
+  for (std::size_t i = 0; i < ptrs.size(); ++i) {
+    if ((i / objects_per_pool) % 2 == 0) {
+      pool.deallocate(ptrs[i], 4 * sizeof(double));
+    }
+  }
+
+  pool.release();
+  EXPECT_EQ(pool.numPools(), 10);
+
+  for (std::size_t i = 0; i < ptrs.size(); ++i) {
+    if ((i / objects_per_pool) % 2 == 1) {
+      EXPECT_TRUE(pool.pointerIsFromPool(ptrs[i]));
+      pool.deallocate(ptrs[i], 4 * sizeof(double));
+    }
+  }
+
+  EXPECT_EQ(pool.getCurrentSize(), 0);
+}
@@ -5,15 +5,20 @@
 // SPDX-License-Identifier: (MIT)
 //////////////////////////////////////////////////////////////////////////////
 
+#include <chrono>
+#include <random>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
 
 #include "gtest/gtest.h"
 #include "umpire/ResourceManager.hpp"
+#include "umpire/strategy/CoalesceHeuristics.hpp"
 #include "umpire/strategy/DynamicPoolList.hpp"
 #include "umpire/strategy/PoolCoalesceHeuristic.hpp"
 #include "umpire/strategy/QuickPool.hpp"
+#include "umpire/strategy/SegregatedFitPool.hpp"
 
 namespace {
 template <typename T>
@@ -30,6 +35,11 @@ template <>
 struct PoolName<umpire::strategy::QuickPool> {
   static constexpr const char* value = "QuickPool";
 };
+
+template <>
+struct PoolName<umpire::strategy::SegregatedFitPool> {
+  static constexpr const char* value = "SegregatedFitPool";
+};
 } // namespace
 
 template <typename POOL>
@@ -58,7 +68,8 @@ struct PoolHeuristicsTest : public ::testing::Test {
   }
 };
 
-using PoolTypes = testing::Types<umpire::strategy::DynamicPoolList, umpire::strategy::QuickPool>;
+using PoolTypes =
+    testing::Types<umpire::strategy::DynamicPoolList, umpire::strategy::QuickPool, umpire::strategy::SegregatedFitPool>;
 
 TYPED_TEST_SUITE(PoolHeuristicsTest, PoolTypes, );
 
@@ -194,3 +205,295 @@ TYPED_TEST(PoolHeuristicsTest, BlocksReleasableHWM)
   ASSERT_EQ(a.second->getReleasableBlocks(), 1);
   ASSERT_EQ(a.second->getTotalBlocks(), 1);
 }
+
+TYPED_TEST(PoolHeuristicsTest, PercentReleasableManyDeallocations)
+{
+  using myPoolType = typename TestFixture::myPoolType;
+  using TestAllocator = typename TestFixture::TestAllocator;
+  TestAllocator a;
+
+  ASSERT_NO_THROW(a = this->getAllocator(myPoolType::percent_releasable(50)););
+  ASSERT_NE(a.second, nullptr);
+
+  // The deallocation made by a coalesce may meet the heuristic again, which
+  // must not start another coalesce
+  std::mt19937 mt{42};
+  std::uniform_int_distribution<std::size_t> size_dist(1, this->first_block / 2);
+  std::vector<void*> ptrs;
+
+  for (int i{0}; i < 10000; ++i) {
+    if (ptrs.empty() || mt() % 2) {
+      ASSERT_NO_THROW(ptrs.push_back(a.first.allocate(size_dist(mt))););
+    } else {
+      const std::size_t index{mt() % ptrs.size()};
+      ASSERT_NO_THROW(a.first.deallocate(ptrs[index]););
+      ptrs[index] = ptrs.back();
+      ptrs.pop_back();
+    }
+  }
+
+  for (auto ptr : ptrs) {
+    ASSERT_NO_THROW(a.first.deallocate(ptr););
+  }
+
+  ASSERT_EQ(a.second->getCurrentSize(), 0);
+}
+
+template <typename POOL>
+struct PoolCoalesceBudgetTest : public PoolHeuristicsTest<POOL> {
+};
+
+using BudgetPoolTypes = testing::Types<umpire::strategy::DynamicPoolList, umpire::strategy::QuickPool>;
+
+TYPED_TEST_SUITE(PoolCoalesceBudgetTest, BudgetPoolTypes, );
+
+TYPED_TEST(PoolCoalesceBudgetTest, SpreadOverDeallocations)
+{
+  using myPoolType = typename TestFixture::myPoolType;
+  using TestAllocator = typename TestFixture::TestAllocator;
+  TestAllocator a;
+
+  ASSERT_NO_THROW(a = this->getAllocator(myPoolType::percent_releasable(100)););
+  ASSERT_NE(a.second, nullptr);
+
+  // Every step can only release one block before the budget is spent
+  a.second->setCoalesceBudget(std::chrono::nanoseconds{1});
+  ASSERT_EQ(a.second->getCoalesceBudget(), std::chrono::nanoseconds{1});
+
+  std::vector<void*> ptrs;
+  const int max_blocks{9};
+
+  for (int i{0}; i < max_blocks; i++) {
+    ASSERT_NO_THROW(ptrs.push_back(a.first.allocate(this->first_block)););
+  }
+
+  const std::size_t actual_size{a.second->getActualSize()};
+
+  for (int i{max_blocks - 1}; i > 0; i--) {
+    ASSERT_NO_THROW(a.first.deallocate(ptrs[i]););
+    ASSERT_FALSE(a.second->isCoalescePending());
+  }
+
+  // The deallocation that meets the heuristic starts the coalesce...
+  ASSERT_NO_THROW(a.first.deallocate(ptrs[0]););
+  ASSERT_TRUE(a.second->isCoalescePending());
+  ASSERT_EQ(a.second->getTotalBlocks(), max_blocks - 1);
+
+  // ...and the following ones finish it, while the pool is still in use
+  int steps{1};
+  while (a.second->isCoalescePending()) {
+    ASSERT_NO_THROW(a.first.deallocate(a.first.allocate(16)););
+    ASSERT_LT(++steps, 2 * max_blocks);
+  }
+
+  ASSERT_GE(steps, max_blocks - 1);
+  ASSERT_EQ(a.second->getTotalBlocks(), 1);
+  ASSERT_EQ(a.second->getReleasableBlocks(), 1);
+  ASSERT_EQ(a.second->getActualSize(), actual_size);
+}
+
+TYPED_TEST(PoolCoalesceBudgetTest, CoalesceFinishesPending)
+{
+  using myPoolType = typename TestFixture::myPoolType;
+  using TestAllocator = typename TestFixture::TestAllocator;
+  TestAllocator a;
+
+  ASSERT_NO_THROW(a = this->getAllocator(myPoolType::percent_releasable(100)););
+  a.second->setCoalesceBudget(std::chrono::nanoseconds{1});
+
+  std::vector<void*> ptrs;
+  for (int i{0}; i < 4; i++) {
+    ASSERT_NO_THROW(ptrs.push_back(a.first.allocate(this->first_block)););
+  }
+  for (auto ptr : ptrs) {
+    ASSERT_NO_THROW(a.first.deallocate(ptr););
+  }
+  ASSERT_TRUE(a.second->isCoalescePending());
+
+  // An explicit coalesce is not limited by the budget
+  a.second->coalesce();
+  ASSERT_FALSE(a.second->isCoalescePending());
+  ASSERT_EQ(a.second->getTotalBlocks(), 1);
+}
+
+template <typename POOL>
+struct PoolCoalesceHeuristicsTest : public PoolHeuristicsTest<POOL> {
+  using TestAllocator = typename PoolHeuristicsTest<POOL>::TestAllocator;
+
+  // A pool that never coalesces by itself, so the heuristic under test can
+  // be called directly
+  TestAllocator getPool()
+  {
+    return this->getAllocator(POOL::percent_releasable(0));
+  }
+};
+
+TYPED_TEST_SUITE(PoolCoalesceHeuristicsTest, BudgetPoolTypes, );
+
+TYPED_TEST(PoolCoalesceHeuristicsTest, PercentReleasableHysteresis)
+{
+  using myPoolType = typename TestFixture::myPoolType;
+  namespace heuristics = umpire::strategy::heuristics;
+
+  ASSERT_THROW(heuristics::percent_releasable_hysteresis<myPoolType>(50, 50), umpire::runtime_error);
+  ASSERT_THROW(heuristics::percent_releasable_hysteresis<myPoolType>(101, 50), umpire::runtime_error);
+
+  auto a = this->getPool();
+  auto h = heuristics::percent_releasable_hysteresis<myPoolType>(100, 50);
+
+  std::vector<void*> ptrs;
+  for (int i{0}; i < 4; i++) {
+    ASSERT_NO_THROW(ptrs.push_back(a.first.allocate(this->first_block)););
+  }
+  ASSERT_EQ(h(*a.second), 0);
+
+  for (auto ptr : ptrs) {
+    ASSERT_NO_THROW(a.first.deallocate(ptr););
+  }
+  ASSERT_EQ(h(*a.second), a.second->getActualSize());
+
+  // Not again until the pool has been in use
+  ASSERT_EQ(h(*a.second), 0);
+  void* ptr{a.first.allocate(this->first_block)};
+  ASSERT_EQ(h(*a.second), 0);
+  a.first.deallocate(ptr);
+  ASSERT_EQ(h(*a.second), 0);
+
+  for (auto& p : ptrs) {
+    ASSERT_NO_THROW(p = a.first.allocate(this->first_block););
+  }
+  ASSERT_EQ(h(*a.second), 0);
+
+  for (auto p : ptrs) {
+    ASSERT_NO_THROW(a.first.deallocate(p););
+  }
+  ASSERT_EQ(h(*a.second), a.second->getActualSize());
+}
+
+TYPED_TEST(PoolCoalesceHeuristicsTest, MinInterval)
+{
+  using myPoolType = typename TestFixture::myPoolType;
+  namespace heuristics = umpire::strategy::heuristics;
+
+  auto a = this->getPool();
+  a.first.deallocate(a.first.allocate(this->first_block));
+
+  auto h = heuristics::min_interval<myPoolType>(myPoolType::percent_releasable(100), std::chrono::hours{1});
+  ASSERT_EQ(h(*a.second), a.second->getActualSize());
+  ASSERT_EQ(h(*a.second), 0);
+
+  auto every_time = heuristics::min_interval<myPoolType>(myPoolType::percent_releasable(100), std::chrono::hours{0});
+  ASSERT_EQ(every_time(*a.second), a.second->getActualSize());
+  ASSERT_EQ(every_time(*a.second), a.second->getActualSize());
+}
+
+TYPED_TEST(PoolCoalesceHeuristicsTest, WhenNotGrowing)
+{
+  using myPoolType = typename TestFixture::myPoolType;
+  namespace heuristics = umpire::strategy::heuristics;
+
+  auto a = this->getPool();
+  const auto period = std::chrono::milliseconds{50};
+  auto h = heuristics::when_not_growing<myPoolType>(myPoolType::percent_releasable(100), period);
+
+  a.first.deallocate(a.first.allocate(this->first_block));
+  ASSERT_EQ(h(*a.second), 0);
+
+  std::this_thread::sleep_for(2 * period);
+  ASSERT_EQ(h(*a.second), a.second->getActualSize());
+
+  // Growing the pool holds the coalesce back again
+  a.first.deallocate(a.first.allocate(8 * this->first_block));
+  ASSERT_EQ(h(*a.second), 0);
+
+  std::this_thread::sleep_for(2 * period);
+  ASSERT_EQ(h(*a.second), a.second->getActualSize());
+}
+
+TYPED_TEST(PoolCoalesceHeuristicsTest, MemoryBudget)
+{
+  using myPoolType = typename TestFixture::myPoolType;
+  using TestAllocator = typename TestFixture::TestAllocator;
+  namespace heuristics = umpire::strategy::heuristics;
+
+  std::size_t usage{0};
+  auto h = heuristics::memory_budget<myPoolType>(1000, std::chrono::milliseconds{0}, [&usage]() { return usage; });
+
+  TestAllocator a;
+  ASSERT_NO_THROW(a = this->getAllocator(h););
+
+  std::vector<void*> ptrs;
+  for (int i{0}; i < 4; i++) {
+    ASSERT_NO_THROW(ptrs.push_back(a.first.allocate(this->first_block)););
+  }
+  const std::size_t actual_size{a.second->getActualSize()};
+
+  // Under budget, the free blocks are kept
+  for (int i{3}; i > 1; i--) {
+    ASSERT_NO_THROW(a.first.deallocate(ptrs[i]););
+  }
+  ASSERT_EQ(a.second->getActualSize(), actual_size);
+
+  // Over budget, they are given back even though the pool is still in use
+  usage = 2000;
+  ASSERT_NO_THROW(a.first.deallocate(ptrs[1]););
+  ASSERT_LT(a.second->getActualSize(), actual_size);
+  ASSERT_GE(a.second->getActualSize(), this->first_block);
+
+  ASSERT_NO_THROW(a.first.deallocate(ptrs[0]););
+}
+
+TYPED_TEST(PoolCoalesceHeuristicsTest, MemoryBudgetIdle)
+{
+  using myPoolType = typename TestFixture::myPoolType;
+  using TestAllocator = typename TestFixture::TestAllocator;
+  namespace heuristics = umpire::strategy::heuristics;
+
+  std::size_t usage{2000};
+  auto h = heuristics::memory_budget<myPoolType>(1000, std::chrono::milliseconds{0}, [&usage]() { return usage; });
+
+  TestAllocator a;
+  ASSERT_NO_THROW(a = this->getAllocator(h););
+
+  // A single free block is released, and no block is allocated in its place
+  ASSERT_NO_THROW(a.first.deallocate(a.first.allocate(this->first_block)););
+  ASSERT_EQ(a.second->getActualSize(), 0);
+  ASSERT_EQ(a.second->getTotalBlocks(), 0);
+
+  std::vector<void*> ptrs;
+  for (int i{0}; i < 4; i++) {
+    ASSERT_NO_THROW(ptrs.push_back(a.first.allocate(this->first_block)););
+  }
+
+  // Each block is released as it becomes free, leaving the pool empty
+  for (auto ptr : ptrs) {
+    ASSERT_NO_THROW(a.first.deallocate(ptr););
+    ASSERT_EQ(a.second->getActualSize(), a.second->getCurrentSize());
+  }
+
+  ASSERT_EQ(a.second->getActualSize(), 0);
+  ASSERT_EQ(a.second->getTotalBlocks(), 0);
+}
+
+TYPED_TEST(PoolCoalesceHeuristicsTest, AnyOf)
+{
+  using myPoolType = typename TestFixture::myPoolType;
+  namespace heuristics = umpire::strategy::heuristics;
+
+  auto a = this->getPool();
+  a.first.deallocate(a.first.allocate(this->first_block));
+
+  int calls{0};
+  umpire::strategy::PoolCoalesceHeuristic<myPoolType> counted = [&calls](const myPoolType& pool) -> std::size_t {
+    ++calls;
+    return pool.getActualSize();
+  };
+
+  auto never_first = heuristics::any_of<myPoolType>(myPoolType::percent_releasable(0), counted);
+  ASSERT_EQ(never_first(*a.second), a.second->getActualSize());
+  ASSERT_EQ(calls, 1);
+
+  auto always_first = heuristics::any_of<myPoolType>(myPoolType::percent_releasable(100), counted);
+  ASSERT_EQ(always_first(*a.second), a.second->getActualSize());
+  ASSERT_EQ(calls, 1);
+}
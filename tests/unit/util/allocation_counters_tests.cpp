@@ -0,0 +1,106 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "umpire/util/AllocationCounters.hpp"
+
+using umpire::util::AllocationCounters;
+
+TEST(AllocationCounters, Empty)
+{
+  AllocationCounters counters;
+  auto snapshot = counters.snapshot();
+
+  EXPECT_EQ(snapshot.current_size, 0);
+  EXPECT_EQ(snapshot.high_watermark, 0);
+  EXPECT_EQ(snapshot.allocation_count, 0);
+}
+
+TEST(AllocationCounters, RegisterDeregister)
+{
+  AllocationCounters counters;
+
+  counters.registerAllocation(100);
+  counters.registerAllocation(200);
+  EXPECT_EQ(counters.getCurrentSize(), 300);
+  EXPECT_EQ(counters.getHighWatermark(), 300);
+  EXPECT_EQ(counters.getAllocationCount(), 2);
+
+  counters.deregisterAllocation(200);
+  EXPECT_EQ(counters.getCurrentSize(), 100);
+  EXPECT_EQ(counters.getHighWatermark(), 300);
+  EXPECT_EQ(counters.getAllocationCount(), 1);
+
+  counters.registerAllocation(50);
+  EXPECT_EQ(counters.getCurrentSize(), 150);
+  EXPECT_EQ(counters.getHighWatermark(), 300);
+}
+
+TEST(AllocationCounters, Resize)
+{
+  AllocationCounters counters;
+
+  counters.registerAllocation(100);
+  counters.resizeAllocation(100, 400);
+  EXPECT_EQ(counters.getCurrentSize(), 400);
+  EXPECT_EQ(counters.getHighWatermark(), 400);
+  EXPECT_EQ(counters.getAllocationCount(), 1);
+
+  counters.resizeAllocation(400, 10);
+  EXPECT_EQ(counters.getCurrentSize(), 10);
+  EXPECT_EQ(counters.getHighWatermark(), 400);
+  EXPECT_EQ(counters.getAllocationCount(), 1);
+}
+
+TEST(AllocationCounters, Concurrent)
+{
+  constexpr int num_threads{4};
+  constexpr int iterations{10000};
+  constexpr std::size_t size{64};
+
+  AllocationCounters counters;
+  std::atomic<bool> done{false};
+  std::vector<std::thread> threads;
+
+  // Poll while the other threads update the counters
+  std::thread reader{[&] {
+    while (!done) {
+      auto snapshot = counters.snapshot();
+      EXPECT_GE(snapshot.high_watermark, snapshot.current_size);
+      EXPECT_LE(snapshot.high_watermark, num_threads * 2 * size);
+    }
+  }};
+
+  for (int i = 0; i < num_threads; ++i) {
+    threads.emplace_back([&] {
+      for (int j = 0; j < iterations; ++j) {
+        counters.registerAllocation(size);
+        counters.registerAllocation(size);
+        counters.deregisterAllocation(size);
+        counters.deregisterAllocation(size);
+      }
+      counters.registerAllocation(size);
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  done = true;
+  reader.join();
+
+  auto snapshot = counters.snapshot();
+  EXPECT_EQ(snapshot.current_size, num_threads * size);
+  EXPECT_EQ(snapshot.allocation_count, num_threads);
+  EXPECT_GE(snapshot.high_watermark, num_threads * size);
+  EXPECT_LE(snapshot.high_watermark, num_threads * 2 * size);
+}
@@ -176,6 +176,41 @@ TEST_F(AllocationMapTest, FindMultiple)
   ASSERT_EQ(*actual_record, record);
 }
 
+TEST_F(AllocationMapTest, InsertRemoveBatch)
+{
+  umpire::util::AllocationRecord records[3] = {
+      {data, sizeof(double), nullptr}, {data + 1, sizeof(double), nullptr}, {data + 2, sizeof(double), nullptr}};
+  void* ptrs[3] = {data, data + 1, data + 2};
+  umpire::util::AllocationRecord removed[3];
+
+  ASSERT_NO_THROW(map.insert(records, 3));
+  ASSERT_EQ(map.size(), 3);
+  ASSERT_EQ(*map.find(data + 1), records[1]);
+
+  ASSERT_NO_THROW(map.remove(ptrs, 3, removed));
+  ASSERT_EQ(map.size(), 0);
+
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(removed[i], records[i]);
+  }
+}
+
+TEST_F(AllocationMapTest, RemoveBatchNotFound)
+{
+  umpire::util::AllocationRecord records[2] = {{data, sizeof(double), nullptr}, {data + 1, sizeof(double), nullptr}};
+  void* ptrs[3] = {data, data + 1, data + 2};
+  umpire::util::AllocationRecord removed[3];
+
+  map.insert(records, 2);
+
+  ASSERT_THROW(map.remove(ptrs, 3, removed), umpire::runtime_error);
+
+  // Nothing is removed when one of the pointers is not found
+  ASSERT_EQ(map.size(), 2);
+  ASSERT_EQ(*map.find(data), records[0]);
+  ASSERT_EQ(*map.find(data + 1), records[1]);
+}
+
 TEST_F(AllocationMapTest, Print)
 {
   umpire::util::AllocationRecord next_record{data, 1, nullptr};
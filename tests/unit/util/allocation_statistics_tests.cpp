@@ -0,0 +1,56 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "umpire/util/allocation_statistics.hpp"
+
+using umpire::util::AllocationRecord;
+using umpire::util::relative_fragmentation;
+
+namespace {
+
+AllocationRecord record(std::uintptr_t address, std::size_t size)
+{
+  return AllocationRecord{reinterpret_cast<void*>(address), size, nullptr};
+}
+
+} // namespace
+
+TEST(RelativeFragmentation, NoFreeSpace)
+{
+  std::vector<AllocationRecord> records;
+  EXPECT_EQ(relative_fragmentation(records), 0.0f);
+
+  records.push_back(record(0x1000, 64));
+  EXPECT_EQ(relative_fragmentation(records), 0.0f);
+
+  records.push_back(record(0x1040, 64));
+  EXPECT_EQ(relative_fragmentation(records), 0.0f);
+
+  EXPECT_EQ(relative_fragmentation(0, 0), 0.0f);
+}
+
+TEST(RelativeFragmentation, SingleGap)
+{
+  std::vector<AllocationRecord> records{record(0x1000, 64), record(0x1100, 64)};
+
+  EXPECT_NEAR(relative_fragmentation(records), 0.0f, 1e-6);
+}
+
+TEST(RelativeFragmentation, UnsortedRecords)
+{
+  // Gaps of 0x40, 0x40 and 0x80 bytes between the records
+  std::vector<AllocationRecord> records{record(0x11c0, 64), record(0x1000, 64), record(0x1080, 64),
+                                        record(0x1100, 64)};
+
+  EXPECT_NEAR(relative_fragmentation(records), 0.5f, 1e-6);
+  EXPECT_NEAR(relative_fragmentation(128, 256), 0.5f, 1e-6);
+  EXPECT_NEAR(relative_fragmentation(64, 256), 0.75f, 1e-6);
+}
@@ -0,0 +1,190 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "umpire/util/AllocationRecord.hpp"
+#include "umpire/util/ShardedAllocationMap.hpp"
+#include "umpire/util/error.hpp"
+
+class ShardedAllocationMapTest : public ::testing::Test {
+ protected:
+  ShardedAllocationMapTest() : data(new double[1024]), size(1024 * sizeof(double))
+  {
+  }
+
+  virtual ~ShardedAllocationMapTest()
+  {
+    delete[] data;
+  }
+
+  void TearDown() override
+  {
+    map.clear();
+  }
+
+  umpire::util::ShardedAllocationMap map;
+
+  double* data;
+  std::size_t size;
+};
+
+TEST_F(ShardedAllocationMapTest, NumShards)
+{
+  ASSERT_EQ(map.numShards(), umpire::util::ShardedAllocationMap::s_default_num_shards);
+
+  umpire::util::ShardedAllocationMap odd_map{5};
+  ASSERT_EQ(odd_map.numShards(), 8);
+
+  umpire::util::ShardedAllocationMap single_map{1};
+  ASSERT_EQ(single_map.numShards(), 1);
+}
+
+TEST_F(ShardedAllocationMapTest, FindNotFound)
+{
+  ASSERT_THROW(map.find(data), umpire::runtime_error);
+  ASSERT_FALSE(map.contains(data));
+}
+
+TEST_F(ShardedAllocationMapTest, FindAndRemove)
+{
+  for (std::size_t i = 0; i < 1024; i += 2) {
+    map.insert(&data[i], umpire::util::AllocationRecord{&data[i], sizeof(double), nullptr});
+  }
+  ASSERT_EQ(map.size(), 512);
+
+  for (std::size_t i = 0; i < 1024; i += 2) {
+    ASSERT_EQ(map.find(&data[i])->ptr, &data[i]);
+    ASSERT_FALSE(map.contains(&data[i + 1]));
+  }
+
+  for (std::size_t i = 0; i < 1024; i += 2) {
+    ASSERT_EQ(map.remove(&data[i]).ptr, &data[i]);
+  }
+  ASSERT_EQ(map.size(), 0);
+  ASSERT_THROW(map.remove(data), umpire::runtime_error);
+}
+
+TEST_F(ShardedAllocationMapTest, InsertRemoveBatch)
+{
+  std::vector<umpire::util::AllocationRecord> records;
+  std::vector<void*> ptrs;
+
+  for (std::size_t i = 0; i < 1024; i += 2) {
+    records.push_back(umpire::util::AllocationRecord{&data[i], sizeof(double), nullptr});
+    ptrs.push_back(&data[i]);
+  }
+
+  map.insert(records.data(), records.size());
+  ASSERT_EQ(map.size(), 512);
+
+  // The last pointer is not in the map, so none are removed
+  std::vector<umpire::util::AllocationRecord> removed(ptrs.size() + 1);
+  ptrs.push_back(&data[1]);
+  ASSERT_THROW(map.remove(ptrs.data(), ptrs.size(), removed.data()), umpire::runtime_error);
+  ASSERT_EQ(map.size(), 512);
+
+  ptrs.pop_back();
+  map.remove(ptrs.data(), ptrs.size(), removed.data());
+  ASSERT_EQ(map.size(), 0);
+
+  for (std::size_t i = 0; i < ptrs.size(); ++i) {
+    ASSERT_EQ(removed[i].ptr, ptrs[i]);
+  }
+}
+
+TEST_F(ShardedAllocationMapTest, FindOffset)
+{
+  // Most of the pointers looked up are in a later region than their record
+  map.insert(data, umpire::util::AllocationRecord{data, size, nullptr});
+  map.insert(&data[512], umpire::util::AllocationRecord{&data[512], 16 * sizeof(double), nullptr});
+
+  for (std::size_t i = 0; i < 512; ++i) {
+    ASSERT_EQ(map.find(&data[i])->ptr, data);
+  }
+
+  for (std::size_t i = 512; i < 512 + 16; ++i) {
+    ASSERT_EQ(map.find(&data[i])->ptr, &data[512]);
+  }
+
+  // As with AllocationMap, only the closest record at or before ptr is checked
+  ASSERT_FALSE(map.contains(&data[512 + 16]));
+}
+
+TEST_F(ShardedAllocationMapTest, FindMultiple)
+{
+  umpire::util::AllocationRecord record{data, size, nullptr};
+  umpire::util::AllocationRecord next_record{data, 1, nullptr};
+
+  map.insert(data, record);
+  map.insert(data, next_record);
+
+  ASSERT_EQ(map.find(data)->size, 1);
+
+  map.remove(data);
+
+  ASSERT_EQ(map.find(data)->size, size);
+}
+
+TEST_F(ShardedAllocationMapTest, Iterate)
+{
+  ASSERT_EQ(map.begin(), map.end());
+
+  for (std::size_t i = 0; i < 100; ++i) {
+    map.insert(&data[i], umpire::util::AllocationRecord{&data[i], sizeof(double), nullptr});
+  }
+
+  std::vector<bool> seen(100, false);
+  for (auto iter = map.begin(); iter != map.end(); ++iter) {
+    const std::size_t i = static_cast<std::size_t>(static_cast<double*>(iter->ptr) - data);
+    ASSERT_LT(i, 100);
+    ASSERT_FALSE(seen[i]);
+    seen[i] = true;
+  }
+
+  for (auto s : seen) {
+    ASSERT_TRUE(s);
+  }
+}
+
+TEST_F(ShardedAllocationMapTest, Print)
+{
+  map.insert(data, umpire::util::AllocationRecord{data, size, nullptr});
+  map.insert(&data[1], umpire::util::AllocationRecord{&data[1], sizeof(double), nullptr});
+
+  map.printAll();
+
+  map.print([this](const umpire::util::AllocationRecord& r) { return r.ptr == data; });
+}
+
+TEST_F(ShardedAllocationMapTest, Concurrent)
+{
+  constexpr std::size_t num_threads{8};
+  constexpr std::size_t per_thread{1024 / num_threads};
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&, t]() {
+      for (int iter = 0; iter < 100; ++iter) {
+        for (std::size_t i = t * per_thread; i < (t + 1) * per_thread; ++i) {
+          map.insert(&data[i], umpire::util::AllocationRecord{&data[i], sizeof(double), nullptr});
+        }
+        for (std::size_t i = t * per_thread; i < (t + 1) * per_thread; ++i) {
+          ASSERT_EQ(map.find(&data[i])->ptr, &data[i]);
+          map.remove(&data[i]);
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(map.size(), 0);
+}
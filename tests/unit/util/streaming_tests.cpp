@@ -0,0 +1,74 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "umpire/util/streaming.hpp"
+
+using umpire::util::streaming_isa;
+
+class StreamingTest : public ::testing::TestWithParam<streaming_isa> {
+ protected:
+  // Sizes around the vector widths and block sizes of every kernel
+  const std::vector<std::size_t> m_sizes{0, 1, 15, 16, 17, 63, 64, 65, 127, 128, 255, 256, 257, 1000, 4096, 65543};
+
+  // Guard bytes on both sides of the range written
+  static constexpr std::size_t s_guard{64};
+};
+
+TEST_P(StreamingTest, Memcpy)
+{
+  for (const std::size_t size : m_sizes) {
+    for (std::size_t offset = 0; offset < 64; offset += 7) {
+      std::vector<char> src(size + 2 * s_guard);
+      std::vector<char> dst(size + 2 * s_guard, 'x');
+
+      for (std::size_t i = 0; i < src.size(); ++i) {
+        src[i] = static_cast<char>(i % 251);
+      }
+
+      // The source is misaligned differently from the destination
+      char* to{dst.data() + offset};
+      const char* from{src.data() + s_guard - offset / 2};
+      umpire::util::streaming_memcpy(to, from, size, GetParam());
+
+      ASSERT_TRUE(std::equal(from, from + size, to)) << "size=" << size << ", offset=" << offset;
+      ASSERT_TRUE(std::all_of(dst.data(), to, [](char c) { return c == 'x'; }));
+      ASSERT_TRUE(std::all_of(to + size, dst.data() + dst.size(), [](char c) { return c == 'x'; }));
+    }
+  }
+}
+
+TEST_P(StreamingTest, Memset)
+{
+  for (const std::size_t size : m_sizes) {
+    for (std::size_t offset = 0; offset < 64; offset += 7) {
+      std::vector<char> dst(size + 2 * s_guard, 'x');
+
+      char* ptr{dst.data() + offset};
+      umpire::util::streaming_memset(ptr, 0xA5, size, GetParam());
+
+      ASSERT_TRUE(std::all_of(ptr, ptr + size, [](char c) { return c == static_cast<char>(0xA5); }))
+          << "size=" << size << ", offset=" << offset;
+      ASSERT_TRUE(std::all_of(dst.data(), ptr, [](char c) { return c == 'x'; }));
+      ASSERT_TRUE(std::all_of(ptr + size, dst.data() + dst.size(), [](char c) { return c == 'x'; }));
+    }
+  }
+}
+
+// Instruction sets the CPU does not support fall back to the best one
+INSTANTIATE_TEST_SUITE_P(Isas, StreamingTest,
+                         ::testing::Values(streaming_isa::scalar, streaming_isa::sse2, streaming_isa::avx2,
+                                           streaming_isa::avx512));
+
+TEST(Streaming, LastLevelCacheSize)
+{
+  ASSERT_GT(umpire::util::last_level_cache_size(), 0u);
+}
@@ -0,0 +1,54 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+
+#include <exception>
+#include <iostream>
+#include <string>
+
+#include "umpire/CLI11/CLI11.hpp"
+#include "umpire/event/binary_file_store.hpp"
+#include "umpire/event/json_file_store.hpp"
+
+//
+// Converts an event file written with UMPIRE_EVENTS_FORMAT=binary to the
+// JSON format that replay and the analysis scripts read.
+//
+int main(int argc, char* argv[])
+{
+  std::string input_file;
+  std::string output_file;
+
+  CLI::App app{"Convert a binary Umpire event file to JSON"};
+
+  app.add_option("-i,--infile", input_file, "Binary event file (*.stats.bin)")->required()->check(CLI::ExistingFile);
+
+  app.add_option("-o,--outfile", output_file, "JSON event file to write (defaults to the input without .bin)");
+
+  CLI11_PARSE(app, argc, argv);
+
+  if (output_file.empty()) {
+    const std::string extension{".bin"};
+    if (input_file.size() > extension.size()
+        && input_file.compare(input_file.size() - extension.size(), extension.size(), extension) == 0) {
+      output_file = input_file.substr(0, input_file.size() - extension.size());
+    } else {
+      output_file = input_file + ".json";
+    }
+  }
+
+  try {
+    umpire::event::binary_file_store input{input_file, true};
+    umpire::event::json_file_store output{output_file};
+
+    input.copy_to(output);
+  } catch (const std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
@@ -103,6 +103,7 @@ public:
     std::size_t op_size;            // Size of allocation/operation
     std::size_t op_offsets[2];      // 0-src, 1-dst
     std::size_t op_alloc_ops[2];    // 0-src, 1-dst/prev
+    std::size_t op_thread;          // Index of the thread that recorded it
   };
 
   const uint64_t REPLAY_MAGIC =
@@ -115,7 +116,7 @@ public:
           | static_cast<uint64_t>('A') << 8
           | static_cast<uint64_t>('Y'));
 
-  const uint64_t REPLAY_VERSION = 17;
+  const uint64_t REPLAY_VERSION = 18;
 
   struct Header {
     struct Magic {
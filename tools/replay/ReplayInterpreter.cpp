@@ -26,6 +26,7 @@
 #if defined(UMPIRE_ENABLE_SQLITE_EXPERIMENTAL)
 #include "umpire/event/sqlite_database.hpp"
 #else
+#include "umpire/event/binary_file_store.hpp"
 #include "umpire/event/json_file_store.hpp"
 #endif
 
@@ -66,13 +67,19 @@ void ReplayInterpreter::buildOperations()
   op->op_line_number = m_line_number;
   hdr->num_operations = 1;
 
+  std::vector<umpire::event::event> events;
 #if defined(UMPIRE_ENABLE_SQLITE_EXPERIMENTAL)
-umpire::event::sqlite_database store{m_options.input_file};
+  umpire::event::sqlite_database store{m_options.input_file};
+  events = store.get_events();
 #else
-umpire::event::json_file_store store{m_options.input_file, true};
+  if (umpire::event::binary_file_store::is_binary_file(m_options.input_file)) {
+    umpire::event::binary_file_store store{m_options.input_file, true};
+    events = store.get_events();
+  } else {
+    umpire::event::json_file_store store{m_options.input_file, true};
+    events = store.get_events();
+  }
 #endif
-  std::vector<umpire::event::event> events;
-  events = store.get_events();
 
   for (auto e : events) {
     m_line_number++;
@@ -112,6 +119,8 @@ umpire::event::json_file_store store{m_options.input_file, true};
     if ( m_event.cat != umpire::event::category::operation)
       continue;
 
+    const std::size_t first_op{hdr->num_operations};
+
     try {
       if ( m_event.name == "allocate" ) {
         m_allocate_ops++;
@@ -166,6 +175,10 @@ umpire::event::json_file_store store{m_options.input_file, true};
     catch (...) {
       REPLAY_ERROR("Failed to compile: " << m_ops->getLine(m_line_number));
     }
+
+    for (std::size_t i = first_op; i < hdr->num_operations; ++i) {
+      hdr->ops[i].op_thread = getThread();
+    }
   }
 
   //
@@ -683,6 +696,17 @@ int ReplayInterpreter::getAllocatorIndex(const std::string& ref_s)
   return n_iter->second;
 }
 
+std::size_t ReplayInterpreter::getThread()
+{
+  //
+  // Events from the first thread to record do not carry a thread, which also
+  // covers logs written before threads were recorded.
+  //
+  const auto thread = m_event.numeric_args.find("thread");
+
+  return (thread == m_event.numeric_args.end()) ? 0 : thread->second;
+}
+
 uint64_t ReplayInterpreter::getPointer(std::string ptr_name)
 {
   const uint64_t ptr{std::stoul(ptr_name, nullptr, 0)};
@@ -692,7 +716,7 @@ uint64_t ReplayInterpreter::getPointer(std::string ptr_name)
 
 void ReplayInterpreter::compile_allocate()
 {
-  if (m_replaying_reallocate)
+  if (m_pending_reallocates.count(getThread()) != 0)
     return;
 
   ReplayFile::Header* hdr{m_ops->getOperationsTable()};
@@ -722,23 +746,29 @@ void ReplayInterpreter::compile_reallocate()
 {
   const std::string      allocator_ref{m_event.string_args["allocator_ref"]};
   ReplayFile::Header*    hdr{m_ops->getOperationsTable()};
-  ReplayFile::Operation* op{&hdr->ops[hdr->num_operations]};
+  const std::size_t      thread{getThread()};
 
   if (m_event.string_args.find("new_ptr") == m_event.string_args.end() ) {
     //
-    // First of two reallocate replays
+    // First of two reallocate replays. The operation is held back until the
+    // second, as other threads may record operations in between.
     //
     const std::size_t allocation_size{m_event.numeric_args["size"]};
     const std::string current_ptr_string{m_event.string_args["current_ptr"]};
     const std::string current_ptr_key{allocator_ref + current_ptr_string};
     const uint64_t current_ptr{ getPointer(current_ptr_string) };
 
-    m_replaying_reallocate = true;
+    if ( m_pending_reallocates.count(thread) != 0 ) {
+      REPLAY_ERROR("Reallocate started before the last one finished: "
+                   << m_ops->getLine(m_line_number) << std::endl);
+    }
 
     if ( current_ptr != 0 && (m_allocation_id.find(current_ptr_key) == m_allocation_id.end()) ) {
         REPLAY_ERROR("Rogue: " << m_ops->getLine(m_line_number) << std::endl);
     }
 
+    ReplayFile::Operation* op{&m_pending_reallocates[thread]};
+
     memset(op, 0, sizeof(*op));
     op->op_type = ReplayFile::otype::REALLOCATE_EX;
     op->op_line_number = m_line_number;
@@ -752,13 +782,19 @@ void ReplayInterpreter::compile_reallocate()
   else {
     const std::string new_ptr_string{m_event.string_args["new_ptr"]};
     const std::string new_ptr_key{allocator_ref + new_ptr_string};
+    auto pending = m_pending_reallocates.find(thread);
+
+    if ( pending == m_pending_reallocates.end() ) {
+      REPLAY_ERROR("Reallocate finished without being started: " << m_ops->getLine(m_line_number) << std::endl);
+    }
 
     if ( m_allocation_id.find(new_ptr_key) != m_allocation_id.end() ) {
       REPLAY_ERROR("Pointer already allocated: " << m_ops->getLine(m_line_number) << std::endl);
     }
+    hdr->ops[hdr->num_operations] = pending->second;
     m_allocation_id.insert({new_ptr_key, hdr->num_operations});
     hdr->num_operations++;
-    m_replaying_reallocate = false;
+    m_pending_reallocates.erase(pending);
   }
 }
 
@@ -768,7 +804,7 @@ bool ReplayInterpreter::compile_deallocate()
   const std::string memory_ptr_string{m_event.string_args["pointer"]};
   const std::string memory_ptr_key{allocator_ref + memory_ptr_string};
 
-  if (m_replaying_reallocate)
+  if (m_pending_reallocates.count(getThread()) != 0)
     return false;
 
   ReplayFile::Header* hdr = m_ops->getOperationsTable();
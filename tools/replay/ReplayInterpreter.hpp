@@ -44,7 +44,8 @@ class ReplayInterpreter {
     std::vector<std::string> m_row;
     AllocatorIndexMap m_allocator_indices;
     AllocationAllocatorMap m_allocation_id;
-    bool m_replaying_reallocate{false};
+    // First halves of reallocates, by thread, held until their second event
+    std::unordered_map<std::size_t, ReplayFile::Operation> m_pending_reallocates;
     std::size_t m_line_number{0};
 
     int m_log_version_major;
@@ -79,6 +80,7 @@ class ReplayInterpreter {
     void compile_coalesce();
     void compile_release();
     int getAllocatorIndex(const std::string& ref_s);
+    std::size_t getThread();
     uint64_t getPointer(std::string ptr_name);
     void printAllocators(ReplayFile* optable);
     std::string printAllocatorInfo(ReplayFile::AllocatorTableEntry* allocator);
@@ -4,10 +4,15 @@
 //
 // SPDX-License-Identifier: (MIT)
 //////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
 #include <cstdint>
+#include <exception>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #if !defined(_MSC_VER) && !defined(_LIBCPP_VERSION)
@@ -19,6 +24,7 @@
 #include "umpire/strategy/NamedAllocationStrategy.hpp"
 #include "umpire/strategy/QuickPool.hpp"
 #include "umpire/util/AllocationRecord.hpp"
+#include "umpire/util/allocation_statistics.hpp"
 #include "umpire/util/wrap_allocator.hpp"
 #include "umpire/ResourceManager.hpp"
 #include "ReplayMacros.hpp"
@@ -140,86 +146,62 @@ namespace {
     std::size_t deallocations{0};
     std::size_t allocation_count{0};
   };
+
+  // Number of times fragmentation is sampled during a replay
+  const std::size_t fragmentation_samples{1024};
+
+  // Serializes the creation of allocators by the replays of a sweep
+  std::mutex allocator_creation_mutex;
+
+  bool isPool(ReplayFile::rtype type)
+  {
+    return type == ReplayFile::rtype::QUICKPOOL
+        || type == ReplayFile::rtype::DYNAMIC_POOL_LIST
+        || type == ReplayFile::rtype::MIXED_POOL;
+  }
 }
 
 void ReplayOperationManager::runOperations()
 {
+  if (m_options.use_threads) {
+    runThreadedOperations();
+    return;
+  }
+
   std::map<int, TrackedHistogram > size_histogram;
   std::size_t op_counter{0};
-  auto& rm = umpire::ResourceManager::getInstance();
-
-  const int name_width{40};
-  const int num_width{16};
-  if (m_options.track_stats) {
-    std::cout
-      << std::setw(name_width) << std::left << "Filename"
-      << std::setw(name_width) << std::left << "Allocator"
-      << std::setw(num_width) << std::left << "Current Size"
-      << std::setw(num_width) << std::left << "Actual Size"
-      << std::setw(num_width) << std::left << "High Watermark"
-      << std::endl;
-  }
 
   for ( auto op = &m_ops_table->ops[1];
         op < &m_ops_table->ops[m_ops_table->num_operations];
         ++op)
   {
-    try {
-      switch (op->op_type) {
-        case ReplayFile::otype::ALLOCATOR_CREATION:
-          if (m_options.track_stats) {
-            size_histogram[op->op_allocator] = TrackedHistogram{};
-          }
-          makeAllocator(op);
-          break;
-        case ReplayFile::otype::SETDEFAULTALLOCATOR:
-          if (m_options.track_stats) {
-            size_histogram[op->op_allocator] = TrackedHistogram{};
-          }
-          makeSetDefaultAllocator(op);
-          break;
-        case ReplayFile::otype::COPY:
-          if (m_options.skip_operations == false) {
-            makeCopy(op);
-          }
-          break;
-        case ReplayFile::otype::REALLOCATE:
-          makeReallocate(op);
-          break;
-        case ReplayFile::otype::REALLOCATE_EX:
-          makeReallocate_ex(op);
-          break;
-        case ReplayFile::otype::ALLOCATE:
-          if (m_options.track_stats || m_options.dump_statistics) {
-            size_histogram[op->op_allocator].increment(op->op_size);
-          }
-          makeAllocate(op);
-          break;
-        case ReplayFile::otype::DEALLOCATE:
-          if (m_options.track_stats || m_options.dump_statistics) {
-            auto alloc = &m_ops_table->allocators[op->op_allocator];
-            auto ptr = m_ops_table->ops[op->op_alloc_ops[0]].op_allocated_ptr;
-            size_histogram[op->op_allocator].decrement(alloc->allocator->getSize(ptr));
-          }
-          makeDeallocate(op);
-          break;
-        case ReplayFile::otype::COALESCE:
-          makeCoalesce(op);
-          break;
-        case ReplayFile::otype::RELEASE:
-          makeRelease(op);
-          break;
-        default:
-          REPLAY_ERROR("Unknown operation type: " << op->op_type);
-          break;
-      }
+    switch (op->op_type) {
+      case ReplayFile::otype::ALLOCATOR_CREATION:
+      case ReplayFile::otype::SETDEFAULTALLOCATOR:
+        if (m_options.track_stats) {
+          size_histogram[op->op_allocator] = TrackedHistogram{};
+        }
+        break;
+      case ReplayFile::otype::ALLOCATE:
+        if (m_options.track_stats || m_options.dump_statistics) {
+          size_histogram[op->op_allocator].increment(op->op_size);
+        }
+        break;
+      case ReplayFile::otype::DEALLOCATE:
+        if (m_options.track_stats || m_options.dump_statistics) {
+          auto alloc = &m_ops_table->allocators[op->op_allocator];
+          auto ptr = m_ops_table->ops[op->op_alloc_ops[0]].op_allocated_ptr;
+          size_histogram[op->op_allocator].decrement(alloc->allocator->getSize(ptr));
+        }
+        break;
+      default:
+        break;
     }
-    catch(...) {
-      std::cerr << std::endl << std::endl
-        << "Replay Failure Line Number: " << std::endl
-        << "  Line: " << op->op_line_number << m_replay_file->getLine(op->op_line_number)
-        << std::endl << std::endl;
-      throw;
+
+    runOperation(op);
+
+    if (m_options.pool_statistics) {
+      trackPoolStatistics(op_counter);
     }
 
     if (m_options.dump_statistics) {
@@ -291,19 +273,18 @@ void ReplayOperationManager::runOperations()
     dumpStats();
   }
 
-  if (m_options.track_stats) {
-    for (const auto& alloc_name : rm.getAllocatorNames()) {
-      auto alloc = rm.getAllocator(alloc_name);
-      if (alloc.getHighWatermark()) {
-        std::cout
-          << std::setw(name_width) << std::left << m_replay_file->getInputFileName()
-          << std::setw(name_width) << std::left << alloc_name
-          << std::setw(num_width) << std::left << alloc.getCurrentSize()
-          << std::setw(num_width) << std::left << alloc.getActualSize()
-          << std::setw(num_width) << std::left << alloc.getHighWatermark()
-          << std::endl;
-      }
+  if (m_options.pool_statistics) {
+    for (auto i : m_pools) {
+      m_pool_statistics.high_watermark += m_ops_table->allocators[i].allocator->getHighWatermark();
+    }
+    if (m_pool_statistics.fragmentation_samples > 0) {
+      m_pool_statistics.fragmentation /= m_pool_statistics.fragmentation_samples;
     }
+    releasePools();
+  }
+
+  if (m_options.track_stats) {
+    printAllocatorSizes();
 
     for (auto const& x : size_histogram)
     {
@@ -313,25 +294,387 @@ void ReplayOperationManager::runOperations()
   }
 }
 
+//
+// Replays the operations of each recorded thread on a thread of its own.
+//
+// Creating allocators, setting the default allocator, coalescing and
+// releasing act on allocators that every thread may be using, so they are
+// replayed alone, once all operations before them have finished. The
+// operations between them are split into one stream per recorded thread.
+// An operation on memory that another thread allocated waits until that
+// allocation has been replayed, which keeps the order that the original
+// threads were in.
+//
+void ReplayOperationManager::runThreadedOperations()
+{
+  const std::size_t num_operations{m_ops_table->num_operations};
+
+  m_op_done.reset(new std::atomic<bool>[num_operations]());
+  m_abort = false;
+
+  auto op = &m_ops_table->ops[1];
+  const auto end = &m_ops_table->ops[num_operations];
+
+  while (op < end) {
+    auto barrier = op;
+    while (barrier < end
+        && barrier->op_type != ReplayFile::otype::ALLOCATOR_CREATION
+        && barrier->op_type != ReplayFile::otype::SETDEFAULTALLOCATOR
+        && barrier->op_type != ReplayFile::otype::COALESCE
+        && barrier->op_type != ReplayFile::otype::RELEASE) {
+      ++barrier;
+    }
+
+    runOperationStreams(op, barrier);
+
+    if (barrier < end) {
+      runOperation(barrier);
+      ++barrier;
+    }
+    op = barrier;
+  }
+
+  if (m_options.track_stats) {
+    printAllocatorSizes();
+  }
+}
+
+void ReplayOperationManager::runOperationStreams(
+    ReplayFile::Operation* begin, ReplayFile::Operation* end)
+{
+  std::map<std::size_t, std::vector<ReplayFile::Operation*>> streams;
+
+  for (auto op = begin; op < end; ++op) {
+    streams[op->op_thread].push_back(op);
+  }
+
+  if (streams.size() <= 1) {
+    for (auto op = begin; op < end; ++op) {
+      runOperation(op);
+    }
+    return;
+  }
+
+  const std::size_t first{static_cast<std::size_t>(begin - m_ops_table->ops)};
+
+  // Returns false if the replay has been abandoned while waiting
+  auto wait_for = [this, first](std::size_t index) {
+    if (index < first)
+      return true;
+
+    while (!m_op_done[index].load(std::memory_order_acquire)) {
+      if (m_abort.load(std::memory_order_relaxed))
+        return false;
+      std::this_thread::yield();
+    }
+    return true;
+  };
+
+  std::mutex error_mutex;
+  std::exception_ptr error{nullptr};
+  std::vector<std::thread> threads;
+
+  for (auto& stream : streams) {
+    threads.emplace_back([&, this] {
+      for (auto op : stream.second) {
+        bool ready{true};
+
+        switch (op->op_type) {
+          case ReplayFile::otype::DEALLOCATE:
+            ready = wait_for(op->op_alloc_ops[0]);
+            break;
+          case ReplayFile::otype::REALLOCATE:
+          case ReplayFile::otype::REALLOCATE_EX:
+            ready = wait_for(op->op_alloc_ops[1]);
+            break;
+          case ReplayFile::otype::COPY:
+            ready = wait_for(op->op_alloc_ops[0]) && wait_for(op->op_alloc_ops[1]);
+            break;
+          default:
+            break;
+        }
+
+        if (!ready)
+          return;
+
+        try {
+          runOperation(op);
+        }
+        catch (...) {
+          std::lock_guard<std::mutex> lock{error_mutex};
+          if (!error)
+            error = std::current_exception();
+          m_abort = true;
+          return;
+        }
+
+        m_op_done[op - m_ops_table->ops].store(true, std::memory_order_release);
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+void ReplayOperationManager::runOperation(ReplayFile::Operation* op)
+{
+  try {
+    switch (op->op_type) {
+      case ReplayFile::otype::ALLOCATOR_CREATION:
+        makeAllocator(op);
+        break;
+      case ReplayFile::otype::SETDEFAULTALLOCATOR:
+        makeSetDefaultAllocator(op);
+        break;
+      case ReplayFile::otype::COPY:
+        if (m_options.skip_operations == false) {
+          makeCopy(op);
+        }
+        break;
+      case ReplayFile::otype::REALLOCATE:
+        makeReallocate(op);
+        break;
+      case ReplayFile::otype::REALLOCATE_EX:
+        makeReallocate_ex(op);
+        break;
+      case ReplayFile::otype::ALLOCATE:
+        makeAllocate(op);
+        break;
+      case ReplayFile::otype::DEALLOCATE:
+        makeDeallocate(op);
+        break;
+      case ReplayFile::otype::COALESCE:
+        makeCoalesce(op);
+        break;
+      case ReplayFile::otype::RELEASE:
+        makeRelease(op);
+        break;
+      default:
+        REPLAY_ERROR("Unknown operation type: " << op->op_type);
+        break;
+    }
+  }
+  catch(...) {
+    std::cerr << std::endl << std::endl
+      << "Replay Failure Line Number: " << std::endl
+      << "  Line: " << op->op_line_number << m_replay_file->getLine(op->op_line_number)
+      << std::endl << std::endl;
+    throw;
+  }
+}
+
+const ReplayOperationManager::PoolStatistics& ReplayOperationManager::getPoolStatistics() const noexcept
+{
+  return m_pool_statistics;
+}
+
+//
+// Fragmentation is measured from the free blocks of every QuickPool and
+// DynamicPoolList, as though they were one pool. MixedPool does not report
+// its largest free block, so it is left out.
+//
+void ReplayOperationManager::trackPoolStatistics(std::size_t op_counter)
+{
+  std::size_t actual_size{0};
+  for (auto i : m_pools) {
+    actual_size += m_ops_table->allocators[i].allocator->getActualSize();
+  }
+  m_pool_statistics.peak_actual_size = std::max(m_pool_statistics.peak_actual_size, actual_size);
+
+  const std::size_t interval{std::max<std::size_t>(1, m_ops_table->num_operations / fragmentation_samples)};
+  if (op_counter % interval != 0)
+    return;
+
+  std::size_t largest_free{0};
+  std::size_t total_free{0};
+  bool measured{false};
+
+  for (auto i : m_pools) {
+    auto allocator = m_ops_table->allocators[i].allocator;
+    auto strategy = allocator->getAllocationStrategy();
+    std::size_t largest{0};
+
+    if (auto qp_strat = dynamic_cast<umpire::strategy::QuickPool*>(strategy)) {
+      largest = qp_strat->getLargestAvailableBlock();
+    }
+    else if (auto dpl_strat = dynamic_cast<umpire::strategy::DynamicPoolList*>(strategy)) {
+      largest = dpl_strat->getLargestAvailableBlock();
+    }
+    else {
+      continue;
+    }
+
+    measured = true;
+    largest_free = std::max(largest_free, largest);
+    const std::size_t used{allocator->getCurrentSize()};
+    const std::size_t actual{allocator->getActualSize()};
+    total_free += std::max(largest, actual > used ? actual - used : 0);
+  }
+
+  if (measured) {
+    m_pool_statistics.fragmentation += umpire::util::relative_fragmentation(largest_free, total_free);
+    m_pool_statistics.fragmentation_samples++;
+  }
+}
+
+//
+// Returns the memory held by the pools, so that a sweep does not keep the
+// memory of every configuration that it has replayed. Allocations that the
+// recorded program never freed stay in their pools.
+//
+void ReplayOperationManager::releasePools()
+{
+  for (auto i = m_pools.rbegin(); i != m_pools.rend(); ++i) {
+    m_ops_table->allocators[*i].allocator->release();
+  }
+}
+
+//
+// Rewrites the arguments of a recorded pool for the pool and block sizes
+// requested with --use-pool, --first-block-size and --next-block-size.
+// Arguments that were not recorded are given the defaults of the recorded
+// pool, and the fixed size pools of a MixedPool keep their defaults when
+// another pool is replayed as a MixedPool.
+//
+void ReplayOperationManager::applyPoolOptions(ReplayFile::AllocatorTableEntry* alloc)
+{
+  if (!isPool(alloc->type))
+    return;
+
+  if (m_options.pool_to_use.empty() && m_options.first_block_size == 0 && m_options.next_block_size == 0)
+    return;
+
+  std::size_t smallest_fixed_blocksize{1 << 8};
+  std::size_t largest_fixed_blocksize{1 << 17};
+  std::size_t max_fixed_blocksize{1024 * 1024 * 2};
+  std::size_t size_multiplier{16};
+  std::size_t first_block_size{umpire::strategy::QuickPool::s_default_first_block_size};
+  std::size_t next_block_size{umpire::strategy::QuickPool::s_default_next_block_size};
+  std::size_t alignment{umpire::strategy::QuickPool::s_default_alignment};
+
+  if (alloc->type == ReplayFile::rtype::MIXED_POOL) {
+    const auto& mixed_pool = alloc->argv.mixed_pool;
+    first_block_size = 512 * 1024 * 1024;
+    next_block_size = 1024 * 1024;
+    alignment = 16;
+
+    if (alloc->argc >= 2) smallest_fixed_blocksize = mixed_pool.smallest_fixed_blocksize;
+    if (alloc->argc >= 3) largest_fixed_blocksize = mixed_pool.largest_fixed_blocksize;
+    if (alloc->argc >= 4) max_fixed_blocksize = mixed_pool.max_fixed_blocksize;
+    if (alloc->argc >= 5) size_multiplier = mixed_pool.size_multiplier;
+    if (alloc->argc >= 6) first_block_size = mixed_pool.dynamic_initial_alloc_bytes;
+    if (alloc->argc >= 7) next_block_size = mixed_pool.dynamic_min_alloc_bytes;
+    if (alloc->argc >= 8) alignment = mixed_pool.dynamic_align_bytes;
+  }
+  else {
+    if (alloc->type == ReplayFile::rtype::DYNAMIC_POOL_LIST) {
+      first_block_size = umpire::strategy::DynamicPoolList::s_default_first_block_size;
+      next_block_size = umpire::strategy::DynamicPoolList::s_default_next_block_size;
+      alignment = umpire::strategy::DynamicPoolList::s_default_alignment;
+    }
+
+    if (alloc->argc >= 2) first_block_size = alloc->argv.pool.initial_alloc_size;
+    if (alloc->argc >= 3) next_block_size = alloc->argv.pool.min_alloc_size;
+    if (alloc->argc >= 4) alignment = static_cast<std::size_t>(alloc->argv.pool.alignment);
+  }
+
+  if (m_options.first_block_size != 0)
+    first_block_size = m_options.first_block_size;
+  if (m_options.next_block_size != 0)
+    next_block_size = m_options.next_block_size;
+
+  if (m_options.pool_to_use == "List") {
+    alloc->type = ReplayFile::rtype::DYNAMIC_POOL_LIST;
+  }
+  else if (m_options.pool_to_use == "Quick") {
+    alloc->type = ReplayFile::rtype::QUICKPOOL;
+  }
+  else if (m_options.pool_to_use == "Mixed") {
+    alloc->type = ReplayFile::rtype::MIXED_POOL;
+  }
+
+  if (alloc->type == ReplayFile::rtype::MIXED_POOL) {
+    auto& mixed_pool = alloc->argv.mixed_pool;
+    mixed_pool.smallest_fixed_blocksize = smallest_fixed_blocksize;
+    mixed_pool.largest_fixed_blocksize = largest_fixed_blocksize;
+    mixed_pool.max_fixed_blocksize = max_fixed_blocksize;
+    mixed_pool.size_multiplier = size_multiplier;
+    mixed_pool.dynamic_initial_alloc_bytes = first_block_size;
+    mixed_pool.dynamic_min_alloc_bytes = next_block_size;
+    mixed_pool.dynamic_align_bytes = alignment;
+    alloc->argc = 8;
+  }
+  else {
+    alloc->argv.pool.initial_alloc_size = first_block_size;
+    alloc->argv.pool.min_alloc_size = next_block_size;
+    alloc->argv.pool.alignment = static_cast<int>(alignment);
+    alloc->argc = 4;
+  }
+}
+
+void ReplayOperationManager::printAllocatorSizes()
+{
+  auto& rm = umpire::ResourceManager::getInstance();
+  const int name_width{40};
+  const int num_width{16};
+
+  std::cout
+    << std::setw(name_width) << std::left << "Filename"
+    << std::setw(name_width) << std::left << "Allocator"
+    << std::setw(num_width) << std::left << "Current Size"
+    << std::setw(num_width) << std::left << "Actual Size"
+    << std::setw(num_width) << std::left << "High Watermark"
+    << std::endl;
+
+  for (const auto& alloc_name : rm.getAllocatorNames()) {
+    auto alloc = rm.getAllocator(alloc_name);
+    if (alloc.getHighWatermark()) {
+      std::cout
+        << std::setw(name_width) << std::left << m_replay_file->getInputFileName()
+        << std::setw(name_width) << std::left << alloc_name
+        << std::setw(num_width) << std::left << alloc.getCurrentSize()
+        << std::setw(num_width) << std::left << alloc.getActualSize()
+        << std::setw(num_width) << std::left << alloc.getHighWatermark()
+        << std::endl;
+    }
+  }
+}
+
 void ReplayOperationManager::makeAllocator(ReplayFile::Operation* op)
 {
+  std::lock_guard<std::mutex> lock{allocator_creation_mutex};
   auto alloc = &m_ops_table->allocators[op->op_allocator];
   auto& rm = umpire::ResourceManager::getInstance();
 
   //
-  // Check to see if user requested that we switch to a different pool
+  // The replays of a sweep share the ResourceManager, so each gives the
+  // allocators it creates names of its own
   //
-  if ( !m_options.pool_to_use.empty() ) {
-    if (alloc->type == ReplayFile::rtype::DYNAMIC_POOL_LIST || alloc->type == ReplayFile::rtype::QUICKPOOL) {
-      if (m_options.pool_to_use == "List") {
-        alloc->type = ReplayFile::rtype::DYNAMIC_POOL_LIST;
-      }
-      else if (m_options.pool_to_use == "Quick") {
-        alloc->type = ReplayFile::rtype::QUICKPOOL;
-      }
+  if ( !m_options.allocator_prefix.empty() && alloc->type != ReplayFile::rtype::MEMORY_RESOURCE ) {
+    const std::string base_name{m_options.allocator_prefix + alloc->base_name};
+
+    m_replay_file->copyString(m_options.allocator_prefix + alloc->name, alloc->name);
+    if (rm.isAllocator(base_name))
+      m_replay_file->copyString(base_name, alloc->base_name);
+
+    if (alloc->type == ReplayFile::rtype::ALLOCATION_ADVISOR) {
+      const std::string accessing_allocator{m_options.allocator_prefix + alloc->argv.advisor.accessing_allocator};
+      if (rm.isAllocator(accessing_allocator))
+        m_replay_file->copyString(accessing_allocator, alloc->argv.advisor.accessing_allocator);
     }
   }
 
+  //
+  // Check to see if user requested that we switch to a different pool
+  //
+  applyPoolOptions(alloc);
+
   switch (alloc->type) {
   case ReplayFile::rtype::MEMORY_RESOURCE:
     alloc->allocator = new umpire::Allocator(rm.getAllocator(alloc->name));
@@ -538,7 +881,8 @@ void ReplayOperationManager::makeAllocator(ReplayFile::Operation* op)
               , rm.getAllocator(alloc->base_name)
               , init_alloc_size
               , min_alloc_size
-              , alignment));
+              , alignment
+              , heuristic));
       }
     }
     else if (alloc->argc >= 4) {
@@ -665,7 +1009,7 @@ void ReplayOperationManager::makeAllocator(ReplayFile::Operation* op)
               alloc->name, rm.getAllocator(alloc->base_name), init_alloc_size, min_alloc_size, alignment, heuristic));
         } else {
           alloc->allocator = new umpire::Allocator(rm.makeAllocator<umpire::strategy::DynamicPoolList, false>(
-              alloc->name, rm.getAllocator(alloc->base_name), init_alloc_size, min_alloc_size, alignment));
+              alloc->name, rm.getAllocator(alloc->base_name), init_alloc_size, min_alloc_size, alignment, heuristic));
         }
       } else if (alloc->argc >= 4) {
         if (alloc->introspection) {
@@ -1058,6 +1402,10 @@ void ReplayOperationManager::makeAllocator(ReplayFile::Operation* op)
     REPLAY_ERROR("Unknown allocator type: " << alloc->type);
     break;
   }
+
+  if (m_options.pool_statistics && isPool(alloc->type)) {
+    m_pools.push_back(op->op_allocator);
+  }
 }
 
 void ReplayOperationManager::makeAllocate(ReplayFile::Operation* op)
@@ -1069,6 +1417,12 @@ void ReplayOperationManager::makeAllocate(ReplayFile::Operation* op)
 
 void ReplayOperationManager::makeSetDefaultAllocator(ReplayFile::Operation* op)
 {
+  //
+  // The other replays of a sweep would see the default allocator change
+  //
+  if ( !m_options.allocator_prefix.empty() )
+    return;
+
   auto alloc = &m_ops_table->allocators[op->op_allocator];
   auto& rm = umpire::ResourceManager::getInstance();
   rm.setDefaultAllocator(*(alloc->allocator));
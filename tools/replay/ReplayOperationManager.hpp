@@ -8,8 +8,10 @@
 #define REPLAY_ReplayOperationManager_HPP
 
 #if !defined(_MSC_VER) && !defined(_LIBCPP_VERSION)
+#include <atomic>
 #include <iostream>
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 #include "ReplayFile.hpp"
@@ -34,11 +36,36 @@ public:
 
   void runOperations();
 
+  //
+  // Statistics of the pools created by the replay, which are gathered when
+  // ReplayOptions::pool_statistics is set
+  //
+  struct PoolStatistics {
+    std::size_t peak_actual_size{0};  // Largest total actual size of the pools
+    std::size_t high_watermark{0};    // Sum of the high watermarks of the pools
+    float fragmentation{0.0f};        // Mean relative fragmentation of the samples
+    std::size_t fragmentation_samples{0};
+  };
+
+  const PoolStatistics& getPoolStatistics() const noexcept;
+
 private:
+  void runThreadedOperations();
+  void runOperationStreams(ReplayFile::Operation* begin, ReplayFile::Operation* end);
+  void runOperation(ReplayFile::Operation* op);
+  void printAllocatorSizes();
+  void applyPoolOptions(ReplayFile::AllocatorTableEntry* alloc);
+  void trackPoolStatistics(std::size_t op_counter);
+  void releasePools();
+
   std::map<std::string, std::vector< std::pair<size_t, std::size_t>>> m_stat_series;
   ReplayOptions m_options;
   ReplayFile* m_replay_file;
   ReplayFile::Header* m_ops_table;
+  std::unique_ptr<std::atomic<bool>[]> m_op_done;
+  std::atomic<bool> m_abort{false};
+  std::vector<std::size_t> m_pools;
+  PoolStatistics m_pool_statistics;
 
   void makeAllocator(ReplayFile::Operation* op);
   void makeAllocate(ReplayFile::Operation* op);
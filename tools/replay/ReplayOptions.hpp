@@ -7,14 +7,17 @@
 #ifndef REPLAY_ReplayOptions_HPP
 #define REPLAY_ReplayOptions_HPP
 
+#include <cstddef>
 #include <string>
+#include <vector>
+
 #include "umpire/CLI11/CLI11.hpp"
 
 struct ReplayUsePoolValidator : public CLI::Validator {
   ReplayUsePoolValidator() {
     func_ = [](const std::string &str) {
-      if (str != "Quick" && str != "List") {
-        return std::string("Invalid pool name, must be Quick or  List");
+      if (str != "Quick" && str != "List" && str != "Mixed") {
+        return std::string("Invalid pool name, must be Quick, List, or Mixed");
       }
       else
         return std::string();
@@ -34,6 +37,22 @@ struct ReplayUseHeuristicValidator : public CLI::Validator {
   }
 };
 
+struct ReplaySweepHeuristicValidator : public CLI::Validator {
+  ReplaySweepHeuristicValidator() {
+    func_ = [](const std::string &str) {
+      const std::string name{str.substr(0, str.find(':'))};
+
+      if (name == "None")
+        return std::string();
+
+      std::string error{ReplayUseHeuristicValidator{}(name)};
+      if (error.empty() && name.size() < str.size())
+        error = CLI::Range(0, 100)(str.substr(name.size() + 1));
+      return error;
+    };
+  }
+};
+
 struct ReplayOptions {
   ReplayOptions() {};
   bool time_replay_run{false};    // -t,--time-run
@@ -44,10 +63,24 @@ struct ReplayOptions {
   bool force_compile{false};      // -r,--recompile
   bool do_not_demangle{false};    // --no-demangle
   bool quiet{false};              // -q,--quiet
+  bool use_threads{false};        // --threads
   std::string input_file;         // -i,-infile input_file
   std::string pool_to_use;        // -p,--use-pool
   std::string heuristic_to_use{}; // --use-heuristic
   int heuristic_parm{2};          // --heuristic-parm
+  std::size_t first_block_size{0}; // --first-block-size
+  std::size_t next_block_size{0};  // --next-block-size
+
+  bool sweep{false};                                          // --sweep
+  std::vector<std::string> sweep_pools{"Quick", "List", "Mixed"}; // --sweep-pools
+  std::vector<std::size_t> sweep_first_block_sizes{};         // --sweep-first-block-sizes
+  std::vector<std::size_t> sweep_next_block_sizes{};          // --sweep-next-block-sizes
+  std::vector<std::string> sweep_heuristics{};                // --sweep-heuristics
+  unsigned int sweep_jobs{0};                                 // --sweep-jobs
+
+  // Set by ReplaySweep for the replay of each configuration
+  std::string allocator_prefix{};
+  bool pool_statistics{false};
 };
 
 #endif  // REPLAY_ReplayOptions_HPP
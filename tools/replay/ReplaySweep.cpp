@@ -0,0 +1,182 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_MSC_VER) && !defined(_LIBCPP_VERSION)
+#include "ReplayFile.hpp"
+#include "ReplayOperationManager.hpp"
+#include "ReplayOptions.hpp"
+#include "ReplaySweep.hpp"
+
+ReplaySweep::ReplaySweep( const ReplayOptions& options )
+    : m_options(options)
+{
+  std::vector<std::size_t> first_block_sizes{m_options.sweep_first_block_sizes};
+  std::vector<std::size_t> next_block_sizes{m_options.sweep_next_block_sizes};
+  std::vector<std::string> heuristics{m_options.sweep_heuristics};
+
+  if (first_block_sizes.empty())
+    first_block_sizes.push_back(m_options.first_block_size);
+  if (next_block_sizes.empty())
+    next_block_sizes.push_back(m_options.next_block_size);
+  if (heuristics.empty())
+    heuristics.push_back(m_options.heuristic_to_use.empty() ? "None" : m_options.heuristic_to_use);
+
+  for (const auto& pool : m_options.sweep_pools) {
+    for (auto first_block_size : first_block_sizes) {
+      for (auto next_block_size : next_block_sizes) {
+        for (const auto& heuristic : heuristics) {
+          Configuration configuration;
+          const std::size_t colon{heuristic.find(':')};
+
+          configuration.pool = pool;
+          configuration.first_block_size = first_block_size;
+          configuration.next_block_size = next_block_size;
+          configuration.heuristic_parm = m_options.heuristic_parm;
+
+          if (heuristic.substr(0, colon) != "None")
+            configuration.heuristic = heuristic.substr(0, colon);
+          if (colon != std::string::npos)
+            configuration.heuristic_parm = std::stoi(heuristic.substr(colon + 1));
+
+          //
+          // Replay does not give a MixedPool a coalescing heuristic, so it is
+          // only replayed once for each block size
+          //
+          if (pool == "Mixed") {
+            configuration.heuristic.clear();
+            if (&heuristic != &heuristics.front())
+              continue;
+          }
+
+          m_configurations.push_back(configuration);
+        }
+      }
+    }
+  }
+}
+
+void ReplaySweep::run()
+{
+  std::size_t num_jobs{m_options.sweep_jobs};
+
+  if (num_jobs == 0)
+    num_jobs = std::max(1u, std::thread::hardware_concurrency());
+  num_jobs = std::min(num_jobs, m_configurations.size());
+
+  std::atomic<std::size_t> next{0};
+  std::vector<std::thread> threads;
+
+  for (std::size_t i = 0; i < num_jobs; ++i) {
+    threads.emplace_back([this, &next] {
+      for (std::size_t index = next++; index < m_configurations.size(); index = next++) {
+        runConfiguration(m_configurations[index], index);
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  printResults();
+}
+
+void ReplaySweep::runConfiguration(Configuration& configuration, std::size_t index)
+{
+  ReplayOptions options{m_options};
+
+  options.pool_to_use = configuration.pool;
+  options.first_block_size = configuration.first_block_size;
+  options.next_block_size = configuration.next_block_size;
+  options.heuristic_to_use = configuration.heuristic;
+  options.heuristic_parm = configuration.heuristic_parm;
+  options.allocator_prefix = "sweep" + std::to_string(index) + "_";
+  options.pool_statistics = true;
+  options.force_compile = false;
+  options.use_threads = false;
+  options.track_stats = false;
+  options.dump_statistics = false;
+
+  try {
+    ReplayFile replay_file{options};
+    ReplayOperationManager operation_mgr{options, &replay_file, replay_file.getOperationsTable()};
+
+    auto t1 = std::chrono::high_resolution_clock::now();
+    operation_mgr.runOperations();
+    auto t2 = std::chrono::high_resolution_clock::now();
+
+    configuration.seconds = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1).count();
+    configuration.statistics = operation_mgr.getPoolStatistics();
+  }
+  catch (const std::exception& e) {
+    configuration.error = e.what();
+  }
+}
+
+void ReplaySweep::printResults()
+{
+  const int name_width{20};
+  const int num_width{18};
+
+  auto block_size = [](std::size_t size) {
+    return size == 0 ? std::string{"Recorded"} : std::to_string(size);
+  };
+
+  std::cout
+    << std::setw(name_width) << std::left << "Pool"
+    << std::setw(num_width) << std::left << "First Block"
+    << std::setw(num_width) << std::left << "Next Block"
+    << std::setw(name_width) << std::left << "Heuristic"
+    << std::setw(num_width) << std::left << "Peak Actual Size"
+    << std::setw(num_width) << std::left << "High Watermark"
+    << std::setw(num_width) << std::left << "Fragmentation"
+    << std::setw(num_width) << std::left << "Time (s)"
+    << std::endl;
+
+  for (const auto& configuration : m_configurations) {
+    std::string heuristic{"None"};
+    if (!configuration.heuristic.empty())
+      heuristic = configuration.heuristic + ":" + std::to_string(configuration.heuristic_parm);
+
+    std::cout
+      << std::setw(name_width) << std::left << configuration.pool
+      << std::setw(num_width) << std::left << block_size(configuration.first_block_size)
+      << std::setw(num_width) << std::left << block_size(configuration.next_block_size)
+      << std::setw(name_width) << std::left << heuristic;
+
+    if (!configuration.error.empty()) {
+      std::cout << "Failed: " << configuration.error << std::endl;
+      continue;
+    }
+
+    const auto& statistics = configuration.statistics;
+    std::ostringstream fragmentation;
+    if (statistics.fragmentation_samples > 0)
+      fragmentation << std::fixed << std::setprecision(4) << statistics.fragmentation;
+    else
+      fragmentation << "-";
+
+    std::cout
+      << std::setw(num_width) << std::left << statistics.peak_actual_size
+      << std::setw(num_width) << std::left << statistics.high_watermark
+      << std::setw(num_width) << std::left << fragmentation.str()
+      << std::setw(num_width) << std::left << configuration.seconds
+      << std::endl;
+  }
+}
+
+#endif // !defined(_MSC_VER) && !defined(_LIBCPP_VERSION)
@@ -0,0 +1,54 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2016-24, Lawrence Livermore National Security, LLC and Umpire
+// project contributors. See the COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (MIT)
+//////////////////////////////////////////////////////////////////////////////
+#ifndef REPLAY_ReplaySweep_HPP
+#define REPLAY_ReplaySweep_HPP
+
+#if !defined(_MSC_VER) && !defined(_LIBCPP_VERSION)
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "ReplayOperationManager.hpp"
+#include "ReplayOptions.hpp"
+
+//
+// Replays a compiled replay file once for every combination of the pools,
+// block sizes and coalescing heuristics given by the --sweep-* options, and
+// prints a table comparing the pools that each combination created.
+//
+// Each configuration is replayed from a private copy of the compiled
+// operations, so configurations may be replayed at the same time by
+// separate threads.
+//
+class ReplaySweep {
+public:
+  ReplaySweep( const ReplayOptions& options );
+
+  void run();
+
+private:
+  struct Configuration {
+    std::string pool;
+    std::size_t first_block_size{0};  // 0 for the recorded size
+    std::size_t next_block_size{0};   // 0 for the recorded size
+    std::string heuristic{};          // Empty for the recorded heuristic
+    int heuristic_parm{0};
+
+    ReplayOperationManager::PoolStatistics statistics{};
+    double seconds{0.0};
+    std::string error{};
+  };
+
+  void runConfiguration(Configuration& configuration, std::size_t index);
+  void printResults();
+
+  ReplayOptions m_options;
+  std::vector<Configuration> m_configurations;
+};
+
+#endif // !defined(_MSC_VER) && !defined(_LIBCPP_VERSION)
+#endif // REPLAY_ReplaySweep_HPP
@@ -19,10 +19,12 @@
 #include "ReplayInterpreter.hpp"
 #include "ReplayMacros.hpp"
 #include "ReplayOptions.hpp"
+#include "ReplaySweep.hpp"
 #include "umpire/CLI11/CLI11.hpp"
 
 const static ReplayUsePoolValidator ReplayValidPool;
 const static ReplayUseHeuristicValidator ReplayValidHeuristic;
+const static ReplaySweepHeuristicValidator ReplayValidSweepHeuristic;
 
 #endif // !defined(_MSC_VER) && !defined(_LIBCPP_VERSION)
 
@@ -34,15 +36,32 @@ int main(int argc, char* argv[])
   app.add_option("-i,--infile", options.input_file, "Input file")->required()->check(CLI::ExistingFile);
   app.add_flag("-q,--quiet", options.quiet, "Only errors will be displayed.");
   app.add_flag("-t,--time-run", options.time_replay_run, "Display time information for replay running operations");
-  app.add_flag("-d,--dump", options.dump_statistics, "Dump ULTRA memory usage trace for each Allocator");
+  auto dump = app.add_flag("-d,--dump", options.dump_statistics, "Dump ULTRA memory usage trace for each Allocator");
   app.add_flag("-s,--stats", options.track_stats, "Track/Display pool allocation size statistics");
   app.add_flag("--no-demangle" , options.do_not_demangle, "Disable demangling of replay file");
   app.add_flag("--skip-operations" , options.skip_operations, "Skip Umpire Operations during replays");
   app.add_flag("-r,--recompile" , options.force_compile, "Force recompile replay binary");
-  app.add_option("-p,--use-pool", options.pool_to_use, "Specify pool to use: List or Quick")->check(ReplayValidPool);
+  auto threads = app.add_flag("--threads", options.use_threads,
+               "Replay the operations of each recorded thread on its own thread")->excludes(dump);
+  app.add_option("-p,--use-pool", options.pool_to_use, "Specify pool to use: List, Quick, or Mixed")->check(ReplayValidPool);
   app.add_option("--use-heuristic", options.heuristic_to_use, 
                  "Heuristic: Block, Block_hwm, FreePercentage, or FreePercentage_hwm")->check(ReplayValidHeuristic);
   app.add_option("--heuristic-parm", options.heuristic_parm, "Heuristic parameter to use")->check(CLI::Range(0,100));
+  app.add_option("--first-block-size", options.first_block_size, "Size of the first block of each pool");
+  app.add_option("--next-block-size", options.next_block_size, "Minimum size of the later blocks of each pool");
+  auto sweep = app.add_flag("--sweep", options.sweep,
+               "Replay once for each combination of the --sweep-* options and compare the pools")
+               ->excludes(dump)->excludes(threads);
+  app.add_option("--sweep-pools", options.sweep_pools, "Pools to sweep: List, Quick, and/or Mixed", true)
+     ->check(ReplayValidPool)->needs(sweep);
+  app.add_option("--sweep-first-block-sizes", options.sweep_first_block_sizes, "First block sizes to sweep")
+     ->needs(sweep);
+  app.add_option("--sweep-next-block-sizes", options.sweep_next_block_sizes, "Next block sizes to sweep")
+     ->needs(sweep);
+  app.add_option("--sweep-heuristics", options.sweep_heuristics,
+                 "Heuristics to sweep as Name[:parm], or None")->check(ReplayValidSweepHeuristic)->needs(sweep);
+  app.add_option("--sweep-jobs", options.sweep_jobs, "Configurations replayed at once (default: one per core)")
+     ->needs(sweep);
   CLI11_PARSE(app, argc, argv);
 
   std::chrono::high_resolution_clock::time_point t1;
@@ -61,7 +80,13 @@ int main(int argc, char* argv[])
   }
 
   t1 = std::chrono::high_resolution_clock::now();
-  replay.runOperations();
+  if (options.sweep) {
+    ReplaySweep replay_sweep{options};
+    replay_sweep.run();
+  }
+  else {
+    replay.runOperations();
+  }
 
   if (options.time_replay_run) {
     t2 = std::chrono::high_resolution_clock::now();